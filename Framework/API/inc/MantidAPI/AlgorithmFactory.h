@@ -23,6 +23,16 @@ struct AlgorithmDescriptor {
   int version;          ///< version
 };
 
+/// Structure describing an algorithm provided by a plugin library that has
+/// not been opened yet, as listed in the library's manifest.
+struct DeferredAlgorithmDescriptor {
+  std::string name;                  ///< name
+  std::vector<std::string> aliases;  ///< aliases
+  std::string methodName;            ///< workspace method name, if any
+  std::string methodInputProperty;   ///< property the workspace is passed to
+  std::vector<std::string> methodOn; ///< workspace types with the method
+};
+
 //----------------------------------------------------------------------
 // Forward declarations
 //----------------------------------------------------------------------
@@ -122,6 +132,10 @@ public:
   /// Get the algorithm names and version - mangled use decodeName to separate
   const std::vector<std::string> getKeys() const override;
   const std::vector<std::string> getKeys(bool includeHidden) const;
+  /// Get the keys without opening plugin libraries whose loading was deferred
+  const std::vector<std::string> getOpenedKeys(bool includeHidden) const;
+  /// Describe the algorithms in plugin libraries that have not been opened
+  std::vector<DeferredAlgorithmDescriptor> getDeferredAlgorithms() const;
 
   /// Returns the highest version of the algorithm currently registered
   int highestVersion(const std::string &algorithmName) const;
@@ -159,6 +173,8 @@ private:
   ~AlgorithmFactoryImpl() override;
   /// creates an algorithm name convolved from an name and version
   std::string createName(const std::string &, const int &) const;
+  /// Open the plugin library providing an algorithm if it was deferred
+  void openLibraryIfDeferred(const std::string &algorithmName) const;
   /// fills a set with the hidden categories
   void fillHiddenCategories(std::unordered_set<std::string> *categorySet) const;
 
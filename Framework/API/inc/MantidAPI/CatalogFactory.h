@@ -68,7 +68,7 @@ public:
 private:
   friend struct Kernel::CreateUsingNew<CatalogFactoryImpl>;
   /// Private Constructor for singleton class
-  CatalogFactoryImpl() = default;
+  CatalogFactoryImpl() : Kernel::DynamicFactory<ICatalog>("Catalog") {}
   /// Private Destructor
   ~CatalogFactoryImpl() override = default;
   /// Stores pointers to already created Catalog instances, with their name as
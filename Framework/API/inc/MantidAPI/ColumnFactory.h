@@ -58,7 +58,7 @@ private:
   friend struct Mantid::Kernel::CreateUsingNew<ColumnFactoryImpl>;
 
   /// Private Constructor for singleton class
-  ColumnFactoryImpl() = default;
+  ColumnFactoryImpl() : Kernel::DynamicFactory<Column>("Column") {}
   /// Private Destructor
   ~ColumnFactoryImpl() override = default;
 };
@@ -18,7 +18,8 @@
   search strategies are used depending on the instrument's geometry.
 
   1) For rectangular detector geometries the InstrumentRayTracer class is used
-  to recursively search the instrument tree.
+  to recursively search the instrument tree. findDetectorIndices traces the
+  rays of all the given Qlab vectors in parallel.
 
   2) For geometries which do not use rectangular detectors ray tracing to every
   component is very expensive. In this case it is quicker to use a
@@ -63,10 +64,15 @@ public:
                    const Geometry::DetectorInfo &detInfo);
   /// Find a detector that intsects with the given Qlab vector
   DetectorSearchResult findDetectorIndex(const Kernel::V3D &q);
+  /// Find the detectors that intersect with several Qlab vectors
+  std::vector<DetectorSearchResult>
+  findDetectorIndices(const std::vector<Kernel::V3D> &qs);
 
 private:
   /// Attempt to find a detector using a full instrument ray tracing strategy
   DetectorSearchResult searchUsingInstrumentRayTracing(const Kernel::V3D &q);
+  /// Get the detector found by tracing a track with the instrument ray tracer
+  DetectorSearchResult tracedDetector(const Geometry::Track &track) const;
   /// Attempt to find a detector using a nearest neighbours search strategy
   DetectorSearchResult searchUsingNearestNeighbours(const Kernel::V3D &q);
   /// Check whether the given direction in detector space intercepts with a
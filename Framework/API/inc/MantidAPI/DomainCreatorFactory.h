@@ -56,7 +56,8 @@ private:
   friend struct Mantid::Kernel::CreateUsingNew<DomainCreatorFactoryImpl>;
 
   /// Private Constructor for singleton class
-  DomainCreatorFactoryImpl() = default;
+  DomainCreatorFactoryImpl()
+      : Kernel::DynamicFactory<IDomainCreator>("DomainCreator") {}
 
   /// Disable copy and assignment operator
   DomainCreatorFactoryImpl(const DomainCreatorFactoryImpl &) = delete;
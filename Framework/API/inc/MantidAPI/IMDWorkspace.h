@@ -72,6 +72,10 @@ public:
       const Parallel::StorageMode storageMode = Parallel::StorageMode::Cloned);
   IMDWorkspace &operator=(const IMDWorkspace &other) = delete;
 
+  /// MD workspaces have no IndexInfo, so algorithms producing them in MPI
+  /// runs set the storage mode directly.
+  using Workspace::setStorageMode;
+
   /**
    * Holds X, Y, E for a line plot
    */
@@ -59,7 +59,9 @@ public:
 
 private:
   /// Private Constructor for singleton class
-  ImplicitFunctionFactoryImpl() = default;
+  ImplicitFunctionFactoryImpl()
+      : Kernel::DynamicFactory<Mantid::Geometry::MDImplicitFunction>(
+            "ImplicitFunction") {}
   /// Private Destructor
   ~ImplicitFunctionFactoryImpl() override = default;
 };
@@ -56,7 +56,9 @@ private:
       ImplicitFunctionParameterParserFactoryImpl>;
 
   /// Private Constructor for singleton class
-  ImplicitFunctionParameterParserFactoryImpl() = default;
+  ImplicitFunctionParameterParserFactoryImpl()
+      : Kernel::DynamicFactory<ImplicitFunctionParameterParser>(
+            "ImplicitFunctionParameterParser") {}
 
   /// Private Destructor
   ~ImplicitFunctionParameterParserFactoryImpl() override = default;
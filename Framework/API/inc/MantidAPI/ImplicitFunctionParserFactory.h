@@ -61,7 +61,9 @@ private:
       ImplicitFunctionParserFactoryImpl>;
 
   /// Private Constructor for singleton class
-  ImplicitFunctionParserFactoryImpl() = default;
+  ImplicitFunctionParserFactoryImpl()
+      : Kernel::DynamicFactory<ImplicitFunctionParser>(
+            "ImplicitFunctionParser") {}
   /// Private Destructor
   ~ImplicitFunctionParserFactoryImpl() override = default;
 };
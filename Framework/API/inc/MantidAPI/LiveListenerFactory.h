@@ -68,7 +68,8 @@ private:
   friend struct Kernel::CreateUsingNew<LiveListenerFactoryImpl>;
 
   /// Private constructor for singleton class
-  LiveListenerFactoryImpl() = default;
+  LiveListenerFactoryImpl()
+      : Kernel::DynamicFactory<ILiveListener>("LiveListener") {}
 
   /// Private destructor
   ~LiveListenerFactoryImpl() override = default;
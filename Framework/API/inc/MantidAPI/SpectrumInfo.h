@@ -7,6 +7,8 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
+#include <mutex>
 #include <vector>
 
 namespace Mantid {
@@ -39,6 +41,12 @@ class ExperimentInfo;
   are no thread-safety guarantees for write operations (non-const access). Reads
   concurrent with writes or concurrent writes are not allowed.
 
+  The column accessors such as l2Column() return the values for all spectra at
+  once. The columns are computed in parallel on first use and cached until a
+  detector, the source or the sample moves or a spectrum definition changes.
+  Entries for which the corresponding single-spectrum accessor would throw,
+  e.g., 2 theta of a monitor, are NaN.
+
 
   @author Simon Heybrock
   @date 2016
@@ -99,9 +107,25 @@ public:
   Kernel::V3D samplePosition() const;
   double l1() const;
 
+  const std::vector<double> &l2Column() const;
+  const std::vector<double> &twoThetaColumn() const;
+  const std::vector<double> &signedTwoThetaColumn() const;
+  const std::vector<Kernel::V3D> &positionColumn() const;
+
   friend class ExperimentInfo;
 
 private:
+  /// Geometry of all spectra, see l2Column() etc.
+  struct GeometryColumns {
+    std::vector<double> l2;
+    std::vector<double> twoTheta;
+    std::vector<double> signedTwoTheta;
+    std::vector<Kernel::V3D> position;
+  };
+
+  const GeometryColumns &geometryColumns() const;
+  void buildGeometryColumns() const;
+  void invalidateGeometryColumns();
   const Geometry::IDetector &getDetector(const size_t index) const;
   const SpectrumDefinition &
   checkAndGetSpectrumDefinition(const size_t index) const;
@@ -112,6 +136,13 @@ private:
   mutable std::vector<boost::shared_ptr<const Geometry::IDetector>>
       m_lastDetector;
   mutable std::vector<size_t> m_lastIndex;
+
+  mutable GeometryColumns m_columns;
+  mutable std::mutex m_columnsMutex;
+  mutable std::atomic<bool> m_columnsValid{false};
+  /// DetectorInfo::geometryVersion() at the time the columns were built
+  mutable std::atomic<size_t> m_columnsDetectorVersion{0};
+  mutable std::atomic<size_t> m_columnsComponentVersion{0};
 };
 
 } // namespace API
@@ -57,7 +57,8 @@ private:
   friend struct Mantid::Kernel::CreateUsingNew<TransformScaleFactoryImpl>;
 
   /// Private Constructor for singleton class
-  TransformScaleFactoryImpl() = default;
+  TransformScaleFactoryImpl()
+      : Kernel::DynamicFactory<ITransformScale>("TransformScale") {}
   ~TransformScaleFactoryImpl() override = default;
   /// Override the DynamicFactory::createUnwrapped() method. We don't want it
   /// used here.
@@ -32,6 +32,12 @@ class SpectrumInfo;
  * ANN is available from <http://www.cs.umd.edu/~mount/ANN/> and is released
  * under the GNU LGPL.
  *
+ * The neighbour search itself runs in parallel, and its result is kept in a
+ * small process-wide cache keyed on the detector positions and the number of
+ * neighbours. Workspaces sharing the same instrument geometry, and repeated
+ * runs of algorithms such as SmoothNeighbours, therefore reuse the search
+ * rather than repeating it. Use clearCache() to release the memory.
+ *
  * Known potential issue: boost's graph has an issue that may cause compilation
  * errors in some circumstances in the current version of boost used by
  * Mantid (1.43) based on tr1::tie. This issue is fixed in later versions
@@ -72,6 +78,9 @@ public:
   // Neighbouring spectra by
   std::map<specnum_t, Mantid::Kernel::V3D> neighbours(specnum_t spectrum) const;
 
+  /// Drop all cached neighbour searches
+  static void clearCache();
+
 protected:
   std::vector<size_t> getSpectraDetectors();
 
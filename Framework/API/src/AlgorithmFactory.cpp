@@ -15,10 +15,25 @@ namespace API {
 namespace {
 /// static logger instance
 Kernel::Logger g_log("AlgorithmFactory");
+/// Kind of item of algorithms in plugin manifests
+const char *MANIFEST_KIND = "Algorithm";
+/// Kind of item of algorithm aliases, listed as alias=algorithm
+const char *MANIFEST_ALIAS_KIND = "AlgorithmAlias";
+/// Kind of item of workspace methods, listed as
+/// method=algorithm,inputProperty[,workspaceType...]
+const char *MANIFEST_METHOD_KIND = "WorkspaceMethod";
+
+/// Split a manifest item of the form key=value into its two parts
+std::pair<std::string, std::string> splitItem(const std::string &item) {
+  const auto separator = item.find('=');
+  if (separator == std::string::npos)
+    return {item, ""};
+  return {item.substr(0, separator), item.substr(separator + 1)};
+}
 }
 
 AlgorithmFactoryImpl::AlgorithmFactoryImpl()
-    : Kernel::DynamicFactory<Algorithm>(), m_vmap() {
+    : Kernel::DynamicFactory<Algorithm>(MANIFEST_KIND), m_vmap() {
   // we need to make sure the library manager has been loaded before we
   // are constructed so that it is destroyed after us and thus does
   // not close any loaded DLLs with loaded algorithms in them
@@ -36,6 +51,7 @@ AlgorithmFactoryImpl::~AlgorithmFactoryImpl() = default;
 boost::shared_ptr<Algorithm>
 AlgorithmFactoryImpl::create(const std::string &name,
                              const int &version) const {
+  openLibraryIfDeferred(name);
   int local_version = version;
   if (version < 0) {
     if (version == -1) // get latest version since not supplied
@@ -105,6 +121,7 @@ void AlgorithmFactoryImpl::unsubscribe(const std::string &algorithmName,
  */
 bool AlgorithmFactoryImpl::exists(const std::string &algorithmName,
                                   const int version) {
+  openLibraryIfDeferred(algorithmName);
   if (version == -1) // Find anything
   {
     return (m_vmap.find(algorithmName) != m_vmap.end());
@@ -114,6 +131,18 @@ bool AlgorithmFactoryImpl::exists(const std::string &algorithmName,
   }
 }
 
+/**
+ * Open the plugin library providing an algorithm if its loading was deferred.
+ * This is done even if the algorithm is registered, as the library may
+ * provide another version of it.
+ * @param algorithmName :: The name of the algorithm
+ */
+void AlgorithmFactoryImpl::openLibraryIfDeferred(
+    const std::string &algorithmName) const {
+  Kernel::LibraryManager::Instance().openLibraryProviding(MANIFEST_KIND,
+                                                          algorithmName);
+}
+
 /** Creates a mangled name for interal storage
 * @param name :: the name of the Algrorithm
 * @param version :: the version of the algroithm
@@ -171,9 +200,22 @@ const std::vector<std::string> AlgorithmFactoryImpl::getKeys() const {
 */
 const std::vector<std::string>
 AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
+  Kernel::LibraryManager::Instance().openDeferredLibraries(MANIFEST_KIND);
+  return getOpenedKeys(includeHidden);
+}
+
+/**
+* Return the keys used for identifying the algorithms registered so far,
+* without opening the plugin libraries whose loading was deferred.
+* @param includeHidden true includes the hidden algorithm names
+* @returns The strings used to identify individual algorithms
+*/
+const std::vector<std::string>
+AlgorithmFactoryImpl::getOpenedKeys(bool includeHidden) const {
   // Start with those subscribed with the factory and add the cleanly
   // constructed algorithm keys
-  std::vector<std::string> names = Kernel::DynamicFactory<Algorithm>::getKeys();
+  std::vector<std::string> names =
+      Kernel::DynamicFactory<Algorithm>::getOpenedKeys();
 
   if (includeHidden) {
     return names;
@@ -217,6 +259,42 @@ AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
   }
 }
 
+/**
+ * Describe the algorithms provided by plugin libraries whose loading was
+ * deferred, using the manifests of the libraries. The libraries are not
+ * opened.
+ * @return A descriptor for each algorithm that is not registered yet
+ */
+std::vector<DeferredAlgorithmDescriptor>
+AlgorithmFactoryImpl::getDeferredAlgorithms() const {
+  auto &libraries = Kernel::LibraryManager::Instance();
+  std::map<std::string, DeferredAlgorithmDescriptor> descriptors;
+  for (const auto &name : libraries.deferredItems(MANIFEST_KIND))
+    descriptors[name].name = name;
+  for (const auto &item : libraries.deferredItems(MANIFEST_ALIAS_KIND)) {
+    const auto alias = splitItem(item);
+    const auto descriptor = descriptors.find(alias.second);
+    if (descriptor != descriptors.end())
+      descriptor->second.aliases.push_back(alias.first);
+  }
+  for (const auto &item : libraries.deferredItems(MANIFEST_METHOD_KIND)) {
+    const auto method = splitItem(item);
+    std::vector<std::string> fields;
+    boost::split(fields, method.second, boost::is_any_of(","));
+    const auto descriptor = descriptors.find(fields.front());
+    if (fields.size() < 2 || descriptor == descriptors.end())
+      continue;
+    descriptor->second.methodName = method.first;
+    descriptor->second.methodInputProperty = fields[1];
+    descriptor->second.methodOn.assign(fields.begin() + 2, fields.end());
+  }
+  std::vector<DeferredAlgorithmDescriptor> result;
+  result.reserve(descriptors.size());
+  for (auto &descriptor : descriptors)
+    result.push_back(std::move(descriptor.second));
+  return result;
+}
+
 /**
  * @param algorithmName The name of an algorithm registered with the factory
  * @return An integer corresponding to the highest version registered
@@ -224,6 +302,7 @@ AlgorithmFactoryImpl::getKeys(bool includeHidden) const {
  */
 int AlgorithmFactoryImpl::highestVersion(
     const std::string &algorithmName) const {
+  openLibraryIfDeferred(algorithmName);
   auto viter = m_vmap.find(algorithmName);
   if (viter != m_vmap.end())
     return viter->second;
@@ -7,6 +7,7 @@ namespace Mantid {
 namespace API {
 
 /// Default constructor
-ArchiveSearchFactoryImpl::ArchiveSearchFactoryImpl() {}
+ArchiveSearchFactoryImpl::ArchiveSearchFactoryImpl()
+    : Kernel::DynamicFactory<IArchiveSearch>("ArchiveSearch") {}
 } // namespace API
 } // namespace Mantid
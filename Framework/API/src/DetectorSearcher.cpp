@@ -107,6 +107,42 @@ DetectorSearcher::findDetectorIndex(const V3D &q) {
   }
 }
 
+/** Find the indices of the detectors given several vectors in Qlab space
+ *
+ * With the ray tracing strategy the rays are traced in parallel. The nearest
+ * neighbour search is not thread safe, so it handles one vector at a time.
+ *
+ * @param qs :: the Qlab vectors to find detectors for
+ * @return the result of findDetectorIndex for each vector
+ */
+std::vector<DetectorSearcher::DetectorSearchResult>
+DetectorSearcher::findDetectorIndices(const std::vector<V3D> &qs) {
+  if (!m_usingFullRayTrace) {
+    std::vector<DetectorSearchResult> results;
+    results.reserve(qs.size());
+    for (const auto &q : qs)
+      results.push_back(findDetectorIndex(q));
+    return results;
+  }
+
+  // Null vectors have no direction and find no detector
+  std::vector<DetectorSearchResult> results(qs.size(),
+                                            std::make_tuple(false, 0));
+  const auto samplePos = m_instrument->getSample()->getPos();
+  std::vector<size_t> traced;
+  std::vector<Geometry::Track> tracks;
+  for (size_t i = 0; i < qs.size(); ++i) {
+    if (qs[i].nullVector())
+      continue;
+    traced.push_back(i);
+    tracks.emplace_back(samplePos, convertQtoDirection(qs[i]));
+  }
+  m_rayTracer->trace(tracks);
+  for (size_t i = 0; i < traced.size(); ++i)
+    results[traced[i]] = tracedDetector(tracks[i]);
+  return results;
+}
+
 /** Find the index of a detector given a vector in Qlab space using a ray
  * tracing search strategy
  *
@@ -118,9 +154,21 @@ DetectorSearcher::findDetectorIndex(const V3D &q) {
 DetectorSearcher::DetectorSearchResult
 DetectorSearcher::searchUsingInstrumentRayTracing(const V3D &q) {
   const auto direction = convertQtoDirection(q);
-  m_rayTracer->traceFromSample(direction);
-  const auto det = m_rayTracer->getDetectorResult();
+  Geometry::Track track;
+  m_rayTracer->traceFromSample(direction, track);
+  return tracedDetector(track);
+}
 
+/** Get the detector found by tracing a track with the instrument ray tracer
+ *
+ * If no detector is found the first parameter of the returned tuple is false
+ *
+ * @param track :: the traced track
+ * @return tuple with data <detector found, detector index>
+ */
+DetectorSearcher::DetectorSearchResult
+DetectorSearcher::tracedDetector(const Geometry::Track &track) const {
+  const auto det = m_rayTracer->getDetectorResult(track);
   if (!det)
     return std::make_tuple(false, 0);
 
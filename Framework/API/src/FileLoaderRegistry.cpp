@@ -1,5 +1,6 @@
 #include "MantidAPI/FileLoaderRegistry.h"
 #include "MantidAPI/IFileLoader.h"
+#include "MantidKernel/LibraryManager.h"
 
 #include <Poco/File.h>
 
@@ -100,6 +101,8 @@ FileLoaderRegistryImpl::chooseLoader(const std::string &filename) const {
   using Kernel::NexusDescriptor;
 
   m_log.debug() << "Trying to find loader for '" << filename << "'\n";
+  // All loaders are candidates, so their libraries must be open
+  Kernel::LibraryManager::Instance().openDeferredLibraries("Loader");
 
   IAlgorithm_sptr bestLoader;
   if (NexusDescriptor::isHDF(filename)) {
@@ -134,6 +137,8 @@ bool FileLoaderRegistryImpl::canLoad(const std::string &algorithmName,
   using Kernel::FileDescriptor;
   using Kernel::NexusDescriptor;
 
+  Kernel::LibraryManager::Instance().openLibraryProviding("Loader",
+                                                         algorithmName);
   // Check if it is in one of our lists
   bool nexus(false), nonHDF(false);
   if (m_names[Nexus].find(algorithmName) != m_names[Nexus].end())
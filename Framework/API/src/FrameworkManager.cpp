@@ -9,17 +9,23 @@
 #include "MantidKernel/Memory.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyManagerDataService.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/UsageService.h"
+#include "MantidKernel/make_unique.h"
 
 #include <boost/algorithm/string/split.hpp>
 
 #include <nexus/NeXusFile.hpp>
 
 #include <Poco/ActiveResult.h>
-#include <tbb/task_scheduler_init.h>
+// global_control is a preview feature before TBB 2019
+#define TBB_PREVIEW_GLOBAL_CONTROL 1
+#include <tbb/global_control.h>
 
 #include <clocale>
 #include <cstdarg>
+#include <memory>
+#include <mutex>
 
 #ifdef _WIN32
 #include <winsock2.h>
@@ -47,6 +53,8 @@ Kernel::Logger g_log("FrameworkManager");
 const char *PLUGINS_DIR_KEY = "framework.plugins.directory";
 /// Key to define the location of the plugins to exclude from loading
 const char *PLUGINS_EXCLUDE_KEY = "framework.plugins.exclude";
+/// Key to enable opening plugins with a manifest only when first used
+const char *PLUGINS_LAZY_KEY = "framework.plugins.lazyload";
 }
 
 /** This is a function called every time NeXuS raises an error.
@@ -170,13 +178,24 @@ void FrameworkManagerImpl::setNumOMPThreadsToConfigValue() {
 }
 
 /**
- * Set the number of OpenMP cores to use based on the config value
+ * Set the number of threads the framework may use at once. This is the
+ * thread budget shared by OpenMP parallel regions and ThreadPool, and also
+ * sizes the OpenMP and TBB thread pools.
  * @param nthreads :: The maximum number of threads to use
  */
 void FrameworkManagerImpl::setNumOMPThreads(const int nthreads) {
   g_log.debug() << "Setting maximum number of threads to " << nthreads << "\n";
+  Kernel::ThreadBudget::setMaxThreads(nthreads);
   PARALLEL_SET_NUM_THREADS(nthreads);
-  static tbb::task_scheduler_init m_init{nthreads};
+  // Unlike task_scheduler_init, global_control limits the TBB threads of the
+  // whole process whichever thread creates or destroys it
+  static std::mutex tbbMutex;
+  static std::unique_ptr<tbb::global_control> tbbThreads;
+  std::lock_guard<std::mutex> lock(tbbMutex);
+  tbbThreads.reset();
+  if (nthreads > 0)
+    tbbThreads = Kernel::make_unique<tbb::global_control>(
+        tbb::global_control::max_allowed_parallelism, nthreads);
 }
 
 /**
@@ -201,6 +220,11 @@ void FrameworkManagerImpl::clear() {
 
 void FrameworkManagerImpl::shutdown() {
   Kernel::UsageService::Instance().shutdown();
+  const auto threads = Kernel::ThreadBudget::counters();
+  g_log.debug() << "Parallel regions: " << threads.regions << ", nested "
+                << threads.nestedRegions << ", reduced "
+                << threads.reducedRegions << ", oversubscribed "
+                << threads.oversubscriptions << " times\n";
   clear();
 }
 
@@ -409,8 +433,14 @@ void FrameworkManagerImpl::loadPluginsUsingKey(const std::string &locationKey,
     boost::split(excludes, excludeStr, boost::is_any_of(";"));
     g_log.debug("Loading libraries from '" + pluginDir + "', excluding '" +
                 excludeStr + "'");
-    LibraryManager::Instance().openLibraries(
-        pluginDir, LibraryManagerImpl::NonRecursive, excludes);
+    int lazy(0);
+    Kernel::ConfigService::Instance().getValue(PLUGINS_LAZY_KEY, lazy);
+    if (lazy > 0)
+      LibraryManager::Instance().openLibrariesLazily(
+          pluginDir, LibraryManagerImpl::NonRecursive, excludes);
+    else
+      LibraryManager::Instance().openLibraries(
+          pluginDir, LibraryManagerImpl::NonRecursive, excludes);
   } else {
     g_log.debug("No library directory found in key \"" + locationKey + "\"");
   }
@@ -16,7 +16,7 @@ namespace Mantid {
 namespace API {
 
 FunctionFactoryImpl::FunctionFactoryImpl()
-    : Kernel::DynamicFactory<IFunction>() {
+    : Kernel::DynamicFactory<IFunction>("Function") {
   // we need to make sure the library manager has been loaded before we
   // are constructed so that it is destroyed after us and thus does
   // not close any loaded DLLs with loaded algorithms in them
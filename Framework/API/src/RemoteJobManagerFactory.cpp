@@ -12,7 +12,7 @@ Kernel::Logger g_log("RemoteJobManagerFactory");
 
 /// Private constructor, singleton class
 RemoteJobManagerFactoryImpl::RemoteJobManagerFactoryImpl()
-    : Mantid::Kernel::DynamicFactory<IRemoteJobManager>() {
+    : Mantid::Kernel::DynamicFactory<IRemoteJobManager>("RemoteJobManager") {
   g_log.debug() << "RemoteJobManager factory created.\n";
 }
 
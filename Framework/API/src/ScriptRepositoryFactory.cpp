@@ -8,7 +8,7 @@ namespace Mantid {
 namespace API {
 
 ScriptRepositoryFactoryImpl::ScriptRepositoryFactoryImpl()
-    : Kernel::DynamicFactory<ScriptRepository>() {
+    : Kernel::DynamicFactory<ScriptRepository>("ScriptRepository") {
   // we need to make sure the library manager has been loaded before we
   // are constructed so that it is destroyed after us and thus does
   // not close any loaded DLLs with loaded algorithms in them
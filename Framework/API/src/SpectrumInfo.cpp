@@ -2,6 +2,8 @@
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidGeometry/Instrument/DetectorGroup.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ReferenceFrame.h"
 #include "MantidBeamline/SpectrumInfo.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/MultiThreaded.h"
@@ -9,6 +11,7 @@
 
 #include <boost/make_shared.hpp>
 #include <algorithm>
+#include <limits>
 
 namespace Mantid {
 namespace API {
@@ -141,6 +144,133 @@ Kernel::V3D SpectrumInfo::samplePosition() const {
 /// Returns L1 (distance from source to sample).
 double SpectrumInfo::l1() const { return m_detectorInfo.l1(); }
 
+/** Returns L2 of all spectra, see l2().
+ *
+ * The reference is invalidated by moving detectors, the source or the sample
+ * and by changing spectrum definitions. Entries for spectra without detectors
+ * are NaN. */
+const std::vector<double> &SpectrumInfo::l2Column() const {
+  return geometryColumns().l2;
+}
+
+/** Returns 2 theta of all spectra, see twoTheta().
+ *
+ * The reference is invalidated as for l2Column(). Entries for monitors and
+ * spectra without detectors are NaN. */
+const std::vector<double> &SpectrumInfo::twoThetaColumn() const {
+  return geometryColumns().twoTheta;
+}
+
+/** Returns the signed 2 theta of all spectra, see signedTwoTheta().
+ *
+ * The reference is invalidated as for l2Column(). Entries for monitors and
+ * spectra without detectors are NaN. */
+const std::vector<double> &SpectrumInfo::signedTwoThetaColumn() const {
+  return geometryColumns().signedTwoTheta;
+}
+
+/** Returns the positions of all spectra, see position().
+ *
+ * The reference is invalidated as for l2Column(). Entries for spectra without
+ * detectors are NaN. */
+const std::vector<Kernel::V3D> &SpectrumInfo::positionColumn() const {
+  return geometryColumns().position;
+}
+
+/// Returns the geometry columns, rebuilding them if they are out of date.
+const SpectrumInfo::GeometryColumns &SpectrumInfo::geometryColumns() const {
+  const auto version = m_detectorInfo.geometryVersion();
+  const auto upToDate = [this, &version] {
+    return m_columnsValid && m_columnsDetectorVersion == version.first &&
+           m_columnsComponentVersion == version.second;
+  };
+  if (!upToDate()) {
+    std::lock_guard<std::mutex> lock(m_columnsMutex);
+    if (!upToDate()) {
+      m_columnsValid = false;
+      buildGeometryColumns();
+      // Versions are stored after building so that a concurrent reader that
+      // sees them also sees the new columns.
+      m_columnsDetectorVersion = version.first;
+      m_columnsComponentVersion = version.second;
+      m_columnsValid = true;
+    }
+  }
+  return m_columns;
+}
+
+/** Computes the geometry of all spectra in a single parallel pass.
+ *
+ * This gives the same results as the single-spectrum accessors, but source
+ * and sample position are looked up only once. */
+void SpectrumInfo::buildGeometryColumns() const {
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const size_t nSpectra = size();
+  m_columns.l2.resize(nSpectra);
+  m_columns.twoTheta.resize(nSpectra);
+  m_columns.signedTwoTheta.resize(nSpectra);
+  m_columns.position.resize(nSpectra);
+
+  const auto sourcePos = sourcePosition();
+  const auto samplePos = samplePosition();
+  const double l1 = this->l1();
+  const auto beamLine = samplePos - sourcePos;
+  const bool hasBeamLine = !beamLine.nullVector();
+  Kernel::V3D normToSurface;
+  bool hasThetaSign = false;
+  if (hasBeamLine && m_detectorInfo.m_instrument) {
+    if (const auto frame = m_detectorInfo.m_instrument->getReferenceFrame()) {
+      normToSurface = beamLine.cross_prod(frame->vecThetaSign());
+      hasThetaSign = true;
+    }
+  }
+
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(nSpectra); ++i) {
+    const auto &specDef = spectrumDefinition(i);
+    if (specDef.size() == 0) {
+      m_columns.l2[i] = nan;
+      m_columns.twoTheta[i] = nan;
+      m_columns.signedTwoTheta[i] = nan;
+      m_columns.position[i] = Kernel::V3D(nan, nan, nan);
+      continue;
+    }
+    double l2{0.0};
+    double twoTheta{0.0};
+    double signedTwoTheta{0.0};
+    Kernel::V3D position;
+    bool hasMonitor = false;
+    for (const auto &detIndex : specDef) {
+      const auto detPos = m_detectorInfo.position(detIndex);
+      position += detPos;
+      if (m_detectorInfo.isMonitor(detIndex)) {
+        hasMonitor = true;
+        l2 += detPos.distance(sourcePos) - l1;
+        continue;
+      }
+      l2 += detPos.distance(samplePos);
+      if (!hasBeamLine)
+        continue;
+      const auto sampleDetVec = detPos - samplePos;
+      const double angle = sampleDetVec.angle(beamLine);
+      twoTheta += angle;
+      const auto cross = beamLine.cross_prod(sampleDetVec);
+      signedTwoTheta += normToSurface.scalar_prod(cross) < 0 ? -angle : angle;
+    }
+    const auto count = static_cast<double>(specDef.size());
+    const bool hasAngles = hasBeamLine && !hasMonitor;
+    m_columns.l2[i] = l2 / count;
+    m_columns.twoTheta[i] = hasAngles ? twoTheta / count : nan;
+    m_columns.signedTwoTheta[i] =
+        hasAngles && hasThetaSign ? signedTwoTheta / count : nan;
+    m_columns.position[i] = position / count;
+  }
+}
+
+/// Marks the geometry columns as out of date, e.g., if a spectrum definition
+/// changed.
+void SpectrumInfo::invalidateGeometryColumns() { m_columnsValid = false; }
+
 const Geometry::IDetector &SpectrumInfo::getDetector(const size_t index) const {
   size_t thread = static_cast<size_t>(PARALLEL_THREAD_NUMBER);
   if (m_lastIndex[thread] == index)
@@ -20,7 +20,7 @@ using std::size_t;
 
 /// Private constructor for singleton class
 WorkspaceFactoryImpl::WorkspaceFactoryImpl()
-    : Mantid::Kernel::DynamicFactory<Workspace>() {
+    : Mantid::Kernel::DynamicFactory<Workspace>("Workspace") {
   g_log.debug() << "WorkspaceFactory created.\n";
 }
 
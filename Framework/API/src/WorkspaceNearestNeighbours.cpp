@@ -6,14 +6,117 @@
 // Nearest neighbours library
 #include "MantidKernel/ANN/ANN.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
 
+#include <list>
+#include <mutex>
+
 namespace Mantid {
 using namespace Geometry;
 namespace API {
 using Mantid::detid_t;
 using Kernel::V3D;
 
+namespace {
+/// The result of a k-nearest-neighbour search over a set of points
+struct NeighbourTable {
+  /// Number of neighbours found for each point
+  int noNeighbours;
+  /// The (scaled) points that were searched. Used as the cache key.
+  std::vector<V3D> points;
+  /// Indices of the neighbours, noNeighbours consecutive entries per point
+  std::vector<ANNidx> indices;
+};
+
+/// Maximum number of neighbour tables kept for reuse
+const size_t MAX_CACHED_TABLES = 4;
+/// Guards access to the cache
+std::mutex g_cacheMutex;
+/// Most recently used neighbour tables, at the front
+std::list<std::shared_ptr<const NeighbourTable>> g_cache;
+
+/// Compare two lists of points exactly
+bool samePoints(const std::vector<V3D> &lhs, const std::vector<V3D> &rhs) {
+  return lhs.size() == rhs.size() &&
+         std::equal(lhs.begin(), lhs.end(), rhs.begin(),
+                    [](const V3D &a, const V3D &b) {
+                      return a.X() == b.X() && a.Y() == b.Y() && a.Z() == b.Z();
+                    });
+}
+
+/**
+ * Find the nearest neighbours of every point using a kd-tree. The tree is
+ * built once and then queried from several threads.
+ * @param points :: The points to search
+ * @param noNeighbours :: The number of neighbours to find for each point
+ * @return The neighbour table
+ */
+std::shared_ptr<const NeighbourTable>
+searchNeighbours(std::vector<V3D> points, const int noNeighbours) {
+  auto table = std::make_shared<NeighbourTable>();
+  table->noNeighbours = noNeighbours;
+  table->points = std::move(points);
+  const int nPoints = static_cast<int>(table->points.size());
+
+  ANNpointArray dataPoints = annAllocPts(nPoints, 3);
+  for (int pointNo = 0; pointNo < nPoints; ++pointNo) {
+    const auto &pos = table->points[pointNo];
+    dataPoints[pointNo][0] = pos.X();
+    dataPoints[pointNo][1] = pos.Y();
+    dataPoints[pointNo][2] = pos.Z();
+  }
+
+  table->indices.resize(static_cast<size_t>(nPoints) * noNeighbours);
+  {
+    ANNkd_tree annTree(dataPoints, nPoints, 3);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int pointNo = 0; pointNo < nPoints; ++pointNo) {
+      std::vector<ANNdist> nnDistList(noNeighbours);
+      ANNidx *nnIndexList =
+          &table->indices[static_cast<size_t>(pointNo) * noNeighbours];
+      annTree.annkSearch(dataPoints[pointNo], // Point to search neighbours of
+                         noNeighbours,        // Number of neighbours to find
+                         nnIndexList,         // Index list of results
+                         nnDistList.data(),   // List of distances to each
+                         0.0                  // Error bound
+                         );
+    }
+  }
+  annDeallocPts(dataPoints);
+  annClose();
+  return table;
+}
+
+/**
+ * Return the neighbour table for the given points, from the cache if the
+ * same search has been done before.
+ * @param points :: The points to search
+ * @param noNeighbours :: The number of neighbours to find for each point
+ * @return The neighbour table
+ */
+std::shared_ptr<const NeighbourTable>
+cachedNeighbours(std::vector<V3D> points, const int noNeighbours) {
+  {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    for (auto it = g_cache.begin(); it != g_cache.end(); ++it) {
+      if ((*it)->noNeighbours == noNeighbours &&
+          samePoints((*it)->points, points)) {
+        auto table = *it;
+        g_cache.splice(g_cache.begin(), g_cache, it);
+        return table;
+      }
+    }
+  }
+  auto table = searchNeighbours(std::move(points), noNeighbours);
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.push_front(table);
+  if (g_cache.size() > MAX_CACHED_TABLES)
+    g_cache.pop_back();
+  return table;
+}
+} // namespace
+
 /**
  * Constructor
  * @param nNeighbours :: Number of neighbours to use
@@ -132,61 +235,40 @@ void WorkspaceNearestNeighbours::build(const int noNeighbours) {
   const auto &firstDet = m_spectrumInfo.detector(indices.front());
   firstDet.getBoundingBox(bbox);
   m_scale = V3D(bbox.width());
-  ANNpointArray dataPoints = annAllocPts(nspectra, 3);
-  MapIV pointNoToVertex;
 
-  int pointNo = 0;
+  std::vector<V3D> points;
+  points.reserve(indices.size());
+  std::vector<Vertex> pointNoToVertex;
+  pointNoToVertex.reserve(indices.size());
   for (const auto i : indices) {
     const specnum_t spectrum = m_spectrumNumbers[i];
-    V3D pos = m_spectrumInfo.position(i) / m_scale;
-    dataPoints[pointNo][0] = pos.X();
-    dataPoints[pointNo][1] = pos.Y();
-    dataPoints[pointNo][2] = pos.Z();
+    points.push_back(m_spectrumInfo.position(i) / m_scale);
     Vertex vertex = boost::add_vertex(spectrum, m_graph);
-    pointNoToVertex[pointNo] = vertex;
+    pointNoToVertex.push_back(vertex);
     m_specToVertex[spectrum] = vertex;
-    ++pointNo;
   }
 
-  auto annTree = new ANNkd_tree(dataPoints, nspectra, 3);
-  pointNo = 0;
-  // Run the nearest neighbour search on each detector, reusing the arrays
-  auto nnIndexList = new ANNidx[m_noNeighbours];
-  auto nnDistList = new ANNdist[m_noNeighbours];
-
-  for (const auto idx : indices) {
-    ANNpoint scaledPos = dataPoints[pointNo];
-    annTree->annkSearch(scaledPos,      // Point to search nearest neighbours of
-                        m_noNeighbours, // Number of neighbours to find (8)
-                        nnIndexList,    // Index list of results
-                        nnDistList,     // List of distances to each of these
-                        0.0 // Error bound (?) is this the radius to search in?
-                        );
-    // The distances that are returned are in our scaled coordinate
-    // system. We store the real space ones.
-    V3D realPos = V3D(scaledPos[0], scaledPos[1], scaledPos[2]) * m_scale;
+  const auto table = cachedNeighbours(std::move(points), m_noNeighbours);
+  const auto &scaledPoints = table->points;
+  for (int pointNo = 0; pointNo < nspectra; ++pointNo) {
+    // The distances are in our scaled coordinate system. We store the real
+    // space ones.
+    const V3D realPos = scaledPoints[pointNo] * m_scale;
+    const ANNidx *nnIndexList =
+        &table->indices[static_cast<size_t>(pointNo) * m_noNeighbours];
     for (int i = 0; i < m_noNeighbours; i++) {
       ANNidx index = nnIndexList[i];
-      V3D neighbour = V3D(dataPoints[index][0], dataPoints[index][1],
-                          dataPoints[index][2]) *
-                      m_scale;
+      V3D neighbour = scaledPoints[index] * m_scale;
       V3D distance = neighbour - realPos;
       double separation = distance.norm();
-      boost::add_edge(m_specToVertex[m_spectrumNumbers[idx]], // from
-                      pointNoToVertex[index],                 // to
+      boost::add_edge(pointNoToVertex[pointNo], // from
+                      pointNoToVertex[index],   // to
                       distance, m_graph);
       if (separation > m_cutoff) {
         m_cutoff = separation;
       }
     }
-    pointNo++;
   }
-  delete[] nnIndexList;
-  delete[] nnDistList;
-  delete annTree;
-  annDeallocPts(dataPoints);
-  annClose();
-  pointNoToVertex.clear();
 
   m_vertexID = get(boost::vertex_name, m_graph);
   m_edgeLength = get(boost::edge_name, m_graph);
@@ -222,6 +304,12 @@ WorkspaceNearestNeighbours::defaultNeighbours(const specnum_t spectrum) const {
   }
 }
 
+/// Drop all of the neighbour searches kept for reuse
+void WorkspaceNearestNeighbours::clearCache() {
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.clear();
+}
+
 /// Returns the list of valid spectrum indices
 std::vector<size_t> WorkspaceNearestNeighbours::getSpectraDetectors() {
   std::vector<size_t> indices;
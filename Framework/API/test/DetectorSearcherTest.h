@@ -129,6 +129,27 @@ public:
     }
   }
 
+  void test_search_rectangular_several_at_once() {
+    auto inst =
+        ComponentCreationHelper::createTestInstrumentRectangular2(1, 100);
+    ExperimentInfo expInfo;
+    expInfo.setInstrument(inst);
+    const auto &info = expInfo.detectorInfo();
+
+    DetectorSearcher searcher(inst, info);
+    std::vector<V3D> qs{V3D(0, 0, 0)};
+    for (size_t pointNo = 0; pointNo < info.size(); ++pointNo)
+      qs.push_back(convertDetectorPositionToQ(info.detector(pointNo)));
+
+    const auto results = searcher.findDetectorIndices(qs);
+    TS_ASSERT_EQUALS(results.size(), qs.size())
+    TS_ASSERT(!std::get<0>(results[0]))
+    for (size_t pointNo = 0; pointNo < info.size(); ++pointNo) {
+      TS_ASSERT(std::get<0>(results[pointNo + 1]))
+      TS_ASSERT_EQUALS(std::get<1>(results[pointNo + 1]), pointNo)
+    }
+  }
+
   V3D convertDetectorPositionToQ(const IDetector &det) {
     const auto tt1 = det.getTwoTheta(V3D(0, 0, 0), V3D(0, 0, 1)); // two theta
     const auto ph1 = det.getPhi();                                // phi
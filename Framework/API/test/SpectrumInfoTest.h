@@ -7,12 +7,15 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/make_unique.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidBeamline/SpectrumInfo.h"
 #include "MantidTestHelpers/FakeObjects.h"
 #include "MantidTestHelpers/InstrumentCreationHelper.h"
 
+#include <cmath>
+
 using namespace Mantid;
 using namespace Mantid::Geometry;
 using namespace Mantid::API;
@@ -275,6 +278,75 @@ public:
     detectorInfo.setPosition(1, oldPos);
   }
 
+  void test_columns_match_single_spectrum_accessors() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2 = spectrumInfo.l2Column();
+    const auto &twoTheta = spectrumInfo.twoThetaColumn();
+    const auto &signedTwoTheta = spectrumInfo.signedTwoThetaColumn();
+    const auto &position = spectrumInfo.positionColumn();
+    TS_ASSERT_EQUALS(l2.size(), 5);
+    for (size_t i = 0; i < 5; ++i) {
+      TS_ASSERT_EQUALS(l2[i], spectrumInfo.l2(i));
+      TS_ASSERT_EQUALS(position[i], spectrumInfo.position(i));
+    }
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(twoTheta[i], spectrumInfo.twoTheta(i));
+      TS_ASSERT_EQUALS(signedTwoTheta[i], spectrumInfo.signedTwoTheta(i));
+    }
+    // Spectra 3 and 4 are monitors
+    TS_ASSERT(std::isnan(twoTheta[3]));
+    TS_ASSERT(std::isnan(signedTwoTheta[4]));
+  }
+
+  void test_grouped_columns() {
+    const auto &spectrumInfo = m_grouped.spectrumInfo();
+    const auto &l2 = spectrumInfo.l2Column();
+    const auto &twoTheta = spectrumInfo.twoThetaColumn();
+    for (const auto i : {GroupOfDets2And3, GroupOfDets1And2}) {
+      TS_ASSERT_EQUALS(l2[i], spectrumInfo.l2(i));
+      TS_ASSERT_EQUALS(twoTheta[i], spectrumInfo.twoTheta(i));
+    }
+    // Partial monitor
+    TS_ASSERT(std::isnan(twoTheta[GroupOfDets1And4]));
+  }
+
+  void test_columns_track_detector_moves() {
+    auto &detectorInfo = m_grouped.mutableDetectorInfo();
+    const auto &spectrumInfo = m_grouped.spectrumInfo();
+    TS_ASSERT_EQUALS(spectrumInfo.positionColumn()[GroupOfDets2And3],
+                     V3D(0.0, 0.1 / 2.0, 5.0));
+    const auto oldPos = detectorInfo.position(1);
+    detectorInfo.setPosition(1, V3D(0.0, -0.1, 5.0));
+    TS_ASSERT_EQUALS(spectrumInfo.positionColumn()[GroupOfDets2And3],
+                     V3D(0.0, 0.0, 5.0));
+    TS_ASSERT_DELTA(spectrumInfo.twoThetaColumn()[0], 0.0199973, 1e-6);
+    detectorInfo.setPosition(1, oldPos);
+    TS_ASSERT_EQUALS(spectrumInfo.positionColumn()[GroupOfDets2And3],
+                     V3D(0.0, 0.1 / 2.0, 5.0));
+  }
+
+  void test_columns_track_sample_moves() {
+    auto &componentInfo = m_workspace.mutableComponentInfo();
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const double oldL2 = spectrumInfo.l2Column()[1];
+    const auto oldPos = componentInfo.samplePosition();
+    componentInfo.setPosition(componentInfo.sample(), V3D(0.0, 0.0, 1.0));
+    TS_ASSERT_EQUALS(spectrumInfo.l2Column()[1], spectrumInfo.l2(1));
+    TS_ASSERT_DIFFERS(spectrumInfo.l2Column()[1], oldL2);
+    componentInfo.setPosition(componentInfo.sample(), oldPos);
+    TS_ASSERT_EQUALS(spectrumInfo.l2Column()[1], oldL2);
+  }
+
+  void test_columns_track_spectrum_definition_changes() {
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    TS_ASSERT(!std::isnan(spectrumInfo.l2Column()[1]));
+    m_workspace.getSpectrum(1).clearDetectorIDs();
+    TS_ASSERT(std::isnan(spectrumInfo.l2Column()[1]));
+    TS_ASSERT(std::isnan(spectrumInfo.twoThetaColumn()[1]));
+    m_workspace.getSpectrum(1).setDetectorID(2);
+    TS_ASSERT_EQUALS(spectrumInfo.l2Column()[1], spectrumInfo.l2(1));
+  }
+
   void test_hasDetectors() {
     const auto &spectrumInfo = m_workspace.spectrumInfo();
     TS_ASSERT(spectrumInfo.hasDetectors(0));
@@ -560,6 +632,19 @@ public:
     TS_ASSERT_DELTA(result, 5214709.740869, 1e-6);
   }
 
+  void test_typical_columns() {
+    double result = 0.0;
+    const auto &spectrumInfo = m_workspace.spectrumInfo();
+    const auto &l2 = spectrumInfo.l2Column();
+    const auto &twoTheta = spectrumInfo.twoThetaColumn();
+    for (size_t i = 0; i < 10000; ++i) {
+      result += spectrumInfo.l1();
+      result += l2[i];
+      result += twoTheta[i];
+    }
+    TS_ASSERT_DELTA(result, 5214709.740869, 1e-6);
+  }
+
 private:
   WorkspaceTester m_workspace;
 };
@@ -199,6 +199,37 @@ public:
     TSM_ASSERT("Must have less detectors available after applying masking",
                sizeWithoutMasked < sizeWithMasked);
   }
+
+  void testSearchIsSharedBetweenWorkspacesWithSameGeometry() {
+    WorkspaceNearestNeighbours::clearCache();
+    const auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(2);
+    const auto ws1 = makeWorkspace(1, 18);
+    ws1->setInstrument(instrument);
+    // Same detectors, different spectrum numbers
+    const auto ws2 = makeWorkspace(1, 18);
+    ws2->setInstrument(instrument);
+    for (size_t i = 0; i < ws2->getNumberHistograms(); ++i)
+      ws2->getSpectrum(i).setSpectrumNo(static_cast<specnum_t>(i + 101));
+
+    WorkspaceNearestNeighbours nn1(8, ws1->spectrumInfo(),
+                                   getSpectrumNumbers(*ws1));
+    WorkspaceNearestNeighbours nn2(8, ws2->spectrumInfo(),
+                                   getSpectrumNumbers(*ws2));
+
+    const auto neighbours1 = nn1.neighbours(5);
+    const auto neighbours2 = nn2.neighbours(105);
+    TS_ASSERT_EQUALS(neighbours1.size(), 8);
+    TS_ASSERT_EQUALS(neighbours2.size(), 8);
+    for (const auto &neighbour : neighbours1) {
+      const auto other = neighbours2.find(neighbour.first + 100);
+      TS_ASSERT(other != neighbours2.end());
+      if (other != neighbours2.end()) {
+        TS_ASSERT_EQUALS(other->second, neighbour.second);
+      }
+    }
+    WorkspaceNearestNeighbours::clearCache();
+  }
 };
 
 //=====================================================================================
@@ -77,6 +77,7 @@ protected:
 
   // Overridden Algorithm methods
   void exec() override;
+  void execDistributed() override;
   void init() override;
 
   bool handleSpecialDivideMinus();
@@ -234,6 +235,9 @@ protected:
   /// Right-hand side EventWorkspace
   DataObjects::EventWorkspace_const_sptr m_erhs;
 
+  /// Copy of a MasterOnly right-hand side workspace, sent to all ranks
+  API::MatrixWorkspace_const_sptr m_broadcastRhs;
+
   /// Output workspace
   API::MatrixWorkspace_sptr m_out;
   /// Output EventWorkspace
@@ -279,6 +283,7 @@ private:
 
   void propagateBinMasks(const API::MatrixWorkspace_const_sptr rhs,
                          API::MatrixWorkspace_sptr out);
+  bool canBroadcastRhs() const;
   /// Progress reporting
   std::unique_ptr<API::Progress> m_progress = nullptr;
 };
@@ -114,12 +114,24 @@ protected:
   convertQuickly(API::MatrixWorkspace_const_sptr inputWS, const double &factor,
                  const double &power);
 
+  /// The geometry of all spectra and the Efixed of all detectors, looked up
+  /// once before looping over the spectra
+  struct DetectorColumns {
+    DetectorColumns(const API::MatrixWorkspace &ws,
+                    const API::SpectrumInfo &spectrumInfo,
+                    const bool signedTheta, const int emode);
+    const std::vector<double> &l2;
+    const std::vector<double> &twoTheta;
+    /// Efixed by detector index, only set in indirect mode
+    boost::shared_ptr<const std::vector<double>> efixed;
+  };
+
   /// Internal function to gather detector specific L2, theta and efixed values
   bool getDetectorValues(const API::SpectrumInfo &spectrumInfo,
+                         const DetectorColumns &columns,
                          const Kernel::Unit &outputUnit, int emode,
-                         const API::MatrixWorkspace &ws, const bool signedTheta,
-                         int64_t wsIndex, double &efixed, double &l2,
-                         double &twoTheta);
+                         const API::MatrixWorkspace &ws, int64_t wsIndex,
+                         double &efixed, double &l2, double &twoTheta);
 
   /// Convert the workspace units using TOF as an intermediate step in the
   /// conversion
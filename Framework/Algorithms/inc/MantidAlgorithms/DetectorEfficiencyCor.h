@@ -131,6 +131,10 @@ private:
   API::MatrixWorkspace_sptr m_outputWS;
   /// points the map that stores additional properties for detectors in that map
   const Geometry::ParameterMap *m_paraMap;
+  /// Gas pressure of each detector, indexed by detector index
+  boost::shared_ptr<const std::vector<double>> m_tubePressure;
+  /// Wall thickness of each detector, indexed by detector index
+  boost::shared_ptr<const std::vector<double>> m_tubeThickness;
 
   /// stores the user selected value for incidient energy of the neutrons
   double m_Ei;
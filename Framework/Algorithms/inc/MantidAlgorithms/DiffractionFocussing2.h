@@ -4,6 +4,8 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/SpectrumGrouping.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidIndexing/SpectrumNumber.h"
 #include "MantidKernel/System.h"
 
@@ -95,6 +97,11 @@ public:
     return "Diffraction\\Focussing";
   }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   // Overridden Algorithm methods
   void init() override;
@@ -112,6 +119,13 @@ private:
   void determineRebinParameters();
   int validateSpectrumInGroup(size_t wi);
 
+  // For distributed input workspaces
+  Indexing::IndexInfo outputIndexInfo() const;
+  void reduceHistograms(API::MatrixWorkspace &out,
+                        std::vector<MantidVec> &groupWeights,
+                        std::vector<size_t> &groupSizes) const;
+  void gatherEvents(DataObjects::EventWorkspace &out) const;
+
   /// Shared pointer to the input workspace
   API::MatrixWorkspace_const_sptr m_matrixInputW;
 
@@ -138,10 +152,12 @@ private:
   int nHist = 0;
   /// Number of points in the 2D workspace
   int nPoints = 0;
-  /// Mapping of group number to vector of inputworkspace indices.
-  std::vector<std::vector<std::size_t>> m_wsIndices;
+  /// Input workspace indices of each valid group
+  DataObjects::SpectrumGrouping m_grouping;
   /// List of valid group numbers
   std::vector<Indexing::SpectrumNumber> m_validGroups;
+  /// Whether the input is distributed and the groups are combined on rank 0
+  bool m_distributed = false;
 };
 
 } // namespace Algorithm
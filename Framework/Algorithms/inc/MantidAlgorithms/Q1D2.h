@@ -2,9 +2,12 @@
 #define MANTID_ALGORITHMS_Q1D2_H_
 
 #include "MantidAPI/Algorithm.h"
+#include "MantidGeometry/Instrument/DetectorSolidAngles.h"
 #include "MantidHistogramData/Histogram.h"
 #include "MantidKernel/cow_ptr.h"
 
+#include <memory>
+
 namespace Mantid {
 namespace API {
 class SpectrumInfo;
@@ -64,6 +67,8 @@ private:
   /// the experimental workspace with counts across the detector
   API::MatrixWorkspace_const_sptr m_dataWS;
   bool m_doSolidAngle;
+  /// the solid angles of the detectors, set if m_doSolidAngle is true
+  std::unique_ptr<const Geometry::DetectorSolidAngles> m_solidAngles;
 
   /// Initialisation code
   void init() override;
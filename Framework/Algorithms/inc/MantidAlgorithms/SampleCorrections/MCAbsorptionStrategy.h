@@ -4,6 +4,7 @@
 #include "MantidAlgorithms/DllConfig.h"
 #include "MantidAlgorithms/SampleCorrections/MCInteractionVolume.h"
 #include <tuple>
+#include <vector>
 
 namespace Mantid {
 namespace API {
@@ -25,6 +26,11 @@ class IBeamProfile;
   The error on all points is defined to be \f$\frac{1}{\sqrt{N}}\f$, where N is
   the number of events generated.
 
+  The path lengths through the volume do not depend on the wavelength. The
+  overload of calculate() taking lists of wavelengths generates one set of
+  tracks and evaluates the attenuation for all of the wavelengths from the
+  path lengths through each material.
+
   Copyright &copy; 2016 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
   National Laboratory & European Spallation Source
 
@@ -55,6 +61,13 @@ public:
                                        const Kernel::V3D &finalPos,
                                        double lambdaBefore,
                                        double lambdaAfter) const;
+  void calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                 const Kernel::V3D &finalPos,
+                 const std::vector<double> &lambdasBefore,
+                 const std::vector<double> &lambdasAfter,
+                 std::vector<double> &attenuationFactors) const;
+  /// The error on each calculated correction factor
+  double error() const { return m_error; }
 
 private:
   const IBeamProfile &m_beamProfile;
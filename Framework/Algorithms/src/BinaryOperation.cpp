@@ -9,8 +9,11 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/WorkspaceSingleValue.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/Unit.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidParallel/Communicator.h"
 
 #include <boost/make_shared.hpp>
 
@@ -22,6 +25,82 @@ using std::size_t;
 
 namespace Mantid {
 namespace Algorithms {
+namespace {
+/// True if the workspace holds a single histogram that can be sent to other
+/// ranks. Events are not sent, an EventWorkspace must be Cloned instead.
+bool isSingleHistogram(const MatrixWorkspace_const_sptr &ws) {
+  return ws && ws->getNumberHistograms() == 1 &&
+         !boost::dynamic_pointer_cast<const EventWorkspace>(ws);
+}
+
+/** Send data, units and bin masks of a single-spectrum workspace from rank 0
+ * to all other ranks. Every rank, including rank 0, gets a new workspace built
+ * from the sent data, such that the operation sees the same right-hand side
+ * everywhere. Logs and instrument are not sent.
+ * @param comm :: The communicator
+ * @param ws :: The workspace to send, only used on rank 0
+ * @return A copy of the spectrum of the workspace on rank 0
+ */
+MatrixWorkspace_sptr broadcastSpectrum(const Parallel::Communicator &comm,
+                                       const MatrixWorkspace_const_sptr &ws) {
+  const int tag = 0;
+  std::vector<int> flags(2, 0);
+  std::vector<double> x, y, e;
+  std::vector<size_t> maskIndices;
+  std::vector<double> maskWeights;
+  std::string xUnit, yUnit;
+  if (comm.rank() == 0) {
+    flags[0] = boost::dynamic_pointer_cast<const WorkspaceSingleValue>(ws)
+                   ? 1
+                   : 0;
+    flags[1] = ws->isDistribution() ? 1 : 0;
+    x = ws->x(0).rawData();
+    y = ws->y(0).rawData();
+    e = ws->e(0).rawData();
+    if (ws->hasMaskedBins(0)) {
+      for (const auto &bin : ws->maskedBins(0)) {
+        maskIndices.push_back(bin.first);
+        maskWeights.push_back(bin.second);
+      }
+    }
+    xUnit = ws->getAxis(0)->unit()->unitID();
+    yUnit = ws->YUnit();
+    for (int rank = 1; rank < comm.size(); ++rank) {
+      comm.send(rank, tag, flags);
+      comm.send(rank, tag, x);
+      comm.send(rank, tag, y);
+      comm.send(rank, tag, e);
+      comm.send(rank, tag, maskIndices);
+      comm.send(rank, tag, maskWeights);
+      comm.send(rank, tag, xUnit);
+      comm.send(rank, tag, yUnit);
+    }
+  } else {
+    comm.recv(0, tag, flags);
+    comm.recv(0, tag, x);
+    comm.recv(0, tag, y);
+    comm.recv(0, tag, e);
+    comm.recv(0, tag, maskIndices);
+    comm.recv(0, tag, maskWeights);
+    comm.recv(0, tag, xUnit);
+    comm.recv(0, tag, yUnit);
+  }
+
+  auto out = WorkspaceFactory::Instance().create(
+      flags[0] ? "WorkspaceSingleValue" : "Workspace2D", 1, x.size(),
+      y.size());
+  out->dataX(0) = x;
+  out->dataY(0) = y;
+  out->dataE(0) = e;
+  for (size_t i = 0; i < maskIndices.size(); ++i)
+    out->flagMasked(0, maskIndices[i], maskWeights[i]);
+  out->getAxis(0)->unit() = UnitFactory::Instance().create(xUnit);
+  out->setYUnit(yUnit);
+  out->setDistribution(flags[1] == 1);
+  return out;
+}
+} // namespace
+
 /** Initialisation method.
  *  Defines input and output workspaces
  *
@@ -140,6 +219,9 @@ void BinaryOperation::exec() {
   // get input workspace, dynamic cast not needed
   m_lhs = getProperty(inputPropName1());
   m_rhs = getProperty(inputPropName2());
+  // In distributed execution a MasterOnly rhs is replaced by its copy
+  if (m_broadcastRhs)
+    m_rhs = m_broadcastRhs;
   m_AllowDifferentNumberSpectra = getProperty("AllowDifferentNumberSpectra");
 
   // Special handling for 1-WS and 1/WS.
@@ -1034,6 +1116,58 @@ BinaryOperation::buildBinaryOperationTable(
   return table;
 }
 
+/** Executes the algorithm in distributed mode.
+ *
+ * The lhs is distributed. The rhs is either distributed in the same way, in
+ * which case each rank operates on its own spectra, or it is a single
+ * histogram (Cloned, or MasterOnly and sent to all ranks) that is applied to
+ * the local spectra of the lhs.
+ */
+void BinaryOperation::execDistributed() {
+  m_broadcastRhs.reset();
+  MatrixWorkspace_const_sptr lhs = getProperty(inputPropName1());
+  MatrixWorkspace_const_sptr rhs = getProperty(inputPropName2());
+  if (!rhs || rhs->storageMode() == Parallel::StorageMode::MasterOnly) {
+    m_broadcastRhs = broadcastSpectrum(communicator(), rhs);
+    rhs = m_broadcastRhs;
+  } else if (rhs->storageMode() == Parallel::StorageMode::Distributed) {
+    // Spectra are matched by workspace index, so the partitions must agree
+    if (lhs->indexInfo().globalSize() != rhs->indexInfo().globalSize() ||
+        lhs->getNumberHistograms() != rhs->getNumberHistograms())
+      throw std::runtime_error("Distributed input workspaces of " + name() +
+                               " must have the same spectra on every rank.");
+  }
+
+  if (lhs->getNumberHistograms() == 0) {
+    // Nothing to compute on this rank. The size checks and the swapping of
+    // operands in exec() would treat the empty lhs as the smaller operand.
+    MatrixWorkspace_sptr out = lhs->clone();
+    setOutputUnits(lhs, rhs, out);
+    setProperty(outputPropName(), out);
+  } else {
+    exec();
+  }
+  m_broadcastRhs.reset();
+}
+
+/** Returns true on all ranks if the rhs on rank 0 is a single histogram,
+ * i.e., if it can be sent to all ranks in execDistributed().
+ */
+bool BinaryOperation::canBroadcastRhs() const {
+  const auto &comm = communicator();
+  const int tag = 0;
+  int canBroadcast{0};
+  if (comm.rank() == 0) {
+    MatrixWorkspace_const_sptr rhs = getProperty(inputPropName2());
+    canBroadcast = isSingleHistogram(rhs) ? 1 : 0;
+    for (int rank = 1; rank < comm.size(); ++rank)
+      comm.send(rank, tag, canBroadcast);
+  } else {
+    comm.recv(0, tag, canBroadcast);
+  }
+  return canBroadcast == 1;
+}
+
 Parallel::ExecutionMode BinaryOperation::getParallelExecutionMode(
     const std::map<std::string, Parallel::StorageMode> &storageModes) const {
   if (static_cast<bool>(getProperty("AllowDifferentNumberSpectra")))
@@ -1044,11 +1178,18 @@ Parallel::ExecutionMode BinaryOperation::getParallelExecutionMode(
   if (lhs == rhs)
     return getCorrespondingExecutionMode(storageModes.begin()->second);
   // Mode <X> times Cloned is ok if the cloned workspace is WorkspaceSingleValue
+  // or has a single spectrum
   if (rhs == Parallel::StorageMode::Cloned) {
     API::MatrixWorkspace_const_sptr ws = getProperty(inputPropName2());
-    if (boost::dynamic_pointer_cast<const WorkspaceSingleValue>(ws))
+    if (boost::dynamic_pointer_cast<const WorkspaceSingleValue>(ws) ||
+        ws->getNumberHistograms() == 1)
       return getCorrespondingExecutionMode(lhs);
   }
+  // Distributed times MasterOnly is ok if the MasterOnly workspace is a single
+  // histogram, it is then sent to all ranks
+  if (lhs == Parallel::StorageMode::Distributed &&
+      rhs == Parallel::StorageMode::MasterOnly && canBroadcastRhs())
+    return Parallel::ExecutionMode::Distributed;
   // Other options are not ok (e.g., MasterOnly times Distributed)
   return Parallel::ExecutionMode::Invalid;
 }
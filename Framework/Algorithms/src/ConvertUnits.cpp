@@ -9,12 +9,16 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/Workspace2D.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/ParameterMap.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/UnitFactory.h"
 #include "MantidParallel/Communicator.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
+#include <cmath>
 #include <numeric>
 
 namespace Mantid {
@@ -387,12 +391,30 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
   return outputWS;
 }
 
+/** Look up the geometry columns of all spectra and, for indirect geometry,
+* the Efixed parameter of all detectors. The columns are computed on first
+* use and cached by the SpectrumInfo and the ParameterMap.
+* @param ws :: The workspace
+* @param spectrumInfo :: SpectrumInfo of the workspace
+* @param signedTheta :: Use twotheta with sign or without
+* @param emode :: The energy mode
+*/
+ConvertUnits::DetectorColumns::DetectorColumns(
+    const API::MatrixWorkspace &ws, const API::SpectrumInfo &spectrumInfo,
+    const bool signedTheta, const int emode)
+    : l2(spectrumInfo.l2Column()),
+      twoTheta(signedTheta ? spectrumInfo.signedTwoThetaColumn()
+                           : spectrumInfo.twoThetaColumn()) {
+  if (emode == 2)
+    efixed = ws.constInstrumentParameters().getDetectorColumn("Efixed");
+}
+
 /** Get the L2, theta and efixed values for a workspace index
 * @param spectrumInfo :: SpectrumInfo of the workspace
+* @param columns :: The geometry columns of spectrumInfo
 * @param outputUnit :: The output unit
 * @param emode :: The energy mode
 * @param ws :: The workspace
-* @param signedTheta :: Return twotheta with sign or without
 * @param wsIndex :: The workspace index
 * @param efixed :: the returned fixed energy
 * @param l2 :: The returned sample - detector distance
@@ -400,32 +422,29 @@ ConvertUnits::convertQuickly(API::MatrixWorkspace_const_sptr inputWS,
 * @returns true if lookup successful, false on error
 */
 bool ConvertUnits::getDetectorValues(const API::SpectrumInfo &spectrumInfo,
+                                     const DetectorColumns &columns,
                                      const Kernel::Unit &outputUnit, int emode,
-                                     const MatrixWorkspace &ws,
-                                     const bool signedTheta, int64_t wsIndex,
+                                     const MatrixWorkspace &ws, int64_t wsIndex,
                                      double &efixed, double &l2,
                                      double &twoTheta) {
   if (!spectrumInfo.hasDetectors(wsIndex))
     return false;
 
-  l2 = spectrumInfo.l2(wsIndex);
+  l2 = columns.l2[wsIndex];
 
   if (!spectrumInfo.isMonitor(wsIndex)) {
     // The scattering angle for this detector (in radians).
-    if (signedTheta)
-      twoTheta = spectrumInfo.signedTwoTheta(wsIndex);
-    else
-      twoTheta = spectrumInfo.twoTheta(wsIndex);
+    twoTheta = columns.twoTheta[wsIndex];
     // If an indirect instrument, try getting Efixed from the geometry
     if (emode == 2 && efixed == EMPTY_DBL()) // indirect
     {
       if (spectrumInfo.hasUniqueDetector(wsIndex)) {
-        const auto &det = spectrumInfo.detector(wsIndex);
-        auto par = ws.constInstrumentParameters().getRecursive(&det, "Efixed");
-        if (par) {
-          efixed = par->value<double>();
-          g_log.debug() << "Detector: " << det.getID() << " EFixed: " << efixed
-                        << "\n";
+        const auto detIndex = spectrumInfo.spectrumDefinition(wsIndex)[0].first;
+        if (!std::isnan((*columns.efixed)[detIndex])) {
+          efixed = (*columns.efixed)[detIndex];
+          g_log.debug() << "Detector: "
+                        << ws.detectorInfo().detectorIDs()[detIndex]
+                        << " EFixed: " << efixed << "\n";
         }
       }
       // Non-unique detector (i.e., DetectorGroup): use single provided value
@@ -513,16 +532,29 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
   auto localFromUnit = std::unique_ptr<Unit>(fromUnit->clone());
   auto localOutputUnit = std::unique_ptr<Unit>(outputUnit->clone());
 
-  // Perform Sanity Validation before creating workspace
+  // create the output workspace
+  MatrixWorkspace_sptr outputWS = this->setupOutputWorkspace(inputWS);
+  EventWorkspace_sptr eventWS =
+      boost::dynamic_pointer_cast<EventWorkspace>(outputWS);
+  assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
+
+  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
+  const DetectorColumns columns(*outputWS, outSpectrumInfo, signedTheta,
+                                emode);
+
+  // Perform Sanity Validation before converting any spectrum. The output
+  // workspace has the geometry of the input and its X values are not
+  // converted yet, so the columns are looked up only once.
   double checkefixed = efixedProp;
   double checkl2;
   double checktwoTheta;
   size_t checkIndex = 0;
-  if (getDetectorValues(spectrumInfo, *outputUnit, emode, *inputWS, signedTheta,
-                        checkIndex, checkefixed, checkl2, checktwoTheta)) {
+  if (getDetectorValues(outSpectrumInfo, columns, *outputUnit, emode,
+                        *outputWS, checkIndex, checkefixed, checkl2,
+                        checktwoTheta)) {
     const double checkdelta = 0.0;
     // copy the X values for the check
-    auto checkXValues = inputWS->readX(checkIndex);
+    auto checkXValues = outputWS->readX(checkIndex);
     // Convert the input unit to time-of-flight
     localFromUnit->toTOF(checkXValues, emptyVec, l1, checkl2, checktwoTheta,
                          emode, checkefixed, checkdelta);
@@ -531,13 +563,6 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
                              emode, checkefixed, checkdelta);
   }
 
-  // create the output workspace
-  MatrixWorkspace_sptr outputWS = this->setupOutputWorkspace(inputWS);
-  EventWorkspace_sptr eventWS =
-      boost::dynamic_pointer_cast<EventWorkspace>(outputWS);
-  assert(static_cast<bool>(eventWS) == m_inputEvents); // Sanity check
-
-  auto &outSpectrumInfo = outputWS->mutableSpectrumInfo();
   // Loop over the histograms (detector spectra)
   for (int64_t i = 0; i < numberOfSpectra_i; ++i) {
     double efixed = efixedProp;
@@ -545,8 +570,8 @@ ConvertUnits::convertViaTOF(Kernel::Unit_const_sptr fromUnit,
     // Now get the detector object for this histogram
     double l2;
     double twoTheta;
-    if (getDetectorValues(outSpectrumInfo, *outputUnit, emode, *outputWS,
-                          signedTheta, i, efixed, l2, twoTheta)) {
+    if (getDetectorValues(outSpectrumInfo, columns, *outputUnit, emode,
+                          *outputWS, i, efixed, l2, twoTheta)) {
 
       /// @todo Don't yet consider hold-off (delta)
       const double delta = 0.0;
@@ -163,6 +163,10 @@ void DetectorEfficiencyCor::retrieveProperties() {
   // these first three properties are fully checked by validators
   m_inputWS = getProperty("InputWorkspace");
   m_paraMap = &(m_inputWS->constInstrumentParameters());
+  // Look up the tube parameters of all detectors at once rather than walking
+  // up the instrument tree for each detector
+  m_tubePressure = m_paraMap->getDetectorColumn(PRESSURE_PARAM);
+  m_tubeThickness = m_paraMap->getDetectorColumn(THICKNESS_PARAM);
 
   m_Ei = getProperty("IncidentEnergy");
   // If we're not given an Ei, see if one has been set.
@@ -220,17 +224,14 @@ void DetectorEfficiencyCor::correctForEfficiency(
   for (const auto index : spectrumDefinition) {
     const auto detIndex = index.first;
     const auto &det_member = detectorInfo.detector(detIndex);
-    Parameter_sptr par =
-        m_paraMap->getRecursive(det_member.getComponentID(), PRESSURE_PARAM);
-    if (!par) {
+    const double atms = (*m_tubePressure)[detIndex];
+    if (std::isnan(atms)) {
       throw Exception::NotFoundError(PRESSURE_PARAM, spectraIn);
     }
-    const double atms = par->value<double>();
-    par = m_paraMap->getRecursive(det_member.getComponentID(), THICKNESS_PARAM);
-    if (!par) {
+    const double wallThickness = (*m_tubeThickness)[detIndex];
+    if (std::isnan(wallThickness)) {
       throw Exception::NotFoundError(THICKNESS_PARAM, spectraIn);
     }
-    const double wallThickness = par->value<double>();
     double detRadius(0.0);
     V3D detAxis;
     getDetectorGeometry(det_member, detRadius, detAxis);
@@ -14,16 +14,22 @@
 #include "MantidIndexing/Group.h"
 #include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/VectorHelper.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
+#include "MantidTypes/SpectrumDefinition.h"
 
+#include <algorithm>
 #include <cfloat>
 #include <iterator>
 #include <numeric>
+#include <set>
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
 using namespace Mantid::DataObjects;
 using std::vector;
 using Mantid::HistogramData::BinEdges;
+using Mantid::Types::Event::TofEvent;
 
 namespace Mantid {
 
@@ -32,6 +38,129 @@ namespace Algorithms {
 // Register the class into the algorithm factory
 DECLARE_ALGORITHM(DiffractionFocussing2)
 
+namespace {
+/// Map from group number to its X range <Xmin,Xmax>
+using group2minmaxmap = std::map<int, std::pair<double, double>>;
+
+void sendRanges(const Parallel::Communicator &comm, const int dest,
+                const group2minmaxmap &group2minmax) {
+  const int tag = 0;
+  std::vector<int> groups;
+  std::vector<double> ranges;
+  for (const auto &item : group2minmax) {
+    groups.push_back(item.first);
+    ranges.push_back(item.second.first);
+    ranges.push_back(item.second.second);
+  }
+  const auto count = static_cast<int>(groups.size());
+  comm.send(dest, tag, count);
+  if (count > 0) {
+    comm.send(dest, tag, groups.data(), count);
+    comm.send(dest, tag, ranges.data(), 2 * count);
+  }
+}
+
+group2minmaxmap receiveRanges(const Parallel::Communicator &comm,
+                              const int source) {
+  const int tag = 0;
+  int count;
+  comm.recv(source, tag, count);
+  std::vector<int> groups(count);
+  std::vector<double> ranges(2 * count);
+  if (count > 0) {
+    comm.recv(source, tag, groups.data(), count);
+    comm.recv(source, tag, ranges.data(), 2 * count);
+  }
+  group2minmaxmap group2minmax;
+  for (int i = 0; i < count; ++i)
+    group2minmax.emplace(groups[i],
+                         std::make_pair(ranges[2 * i], ranges[2 * i + 1]));
+  return group2minmax;
+}
+
+/** Combine the group X ranges found on all ranks, such that every rank uses
+ * the same groups and the same bin edges.
+ * @param comm :: The communicator
+ * @param group2minmax :: The local ranges, replaced by the combined ranges
+ */
+void reduceRanges(const Parallel::Communicator &comm,
+                  group2minmaxmap &group2minmax) {
+  if (comm.rank() != 0) {
+    sendRanges(comm, 0, group2minmax);
+    group2minmax = receiveRanges(comm, 0);
+    return;
+  }
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    for (const auto &item : receiveRanges(comm, rank)) {
+      auto it = group2minmax.emplace(item).first;
+      it->second.first = std::min(it->second.first, item.second.first);
+      it->second.second = std::max(it->second.second, item.second.second);
+    }
+  }
+  for (int rank = 1; rank < comm.size(); ++rank)
+    sendRanges(comm, rank, group2minmax);
+}
+
+/// Largest number of bytes of events sent in one message, as MPI counts are
+/// int
+const size_t MAX_MESSAGE_BYTES = size_t{1} << 30;
+
+/// Send the events of a list as raw bytes, like the MPI event loader does.
+/// The number of events is sent first, then the events in chunks.
+template <class T>
+void sendEvents(const Parallel::Communicator &comm, const int dest,
+                const std::vector<T> &events) {
+  const int tag = 0;
+  const size_t count = events.size();
+  comm.send(dest, tag, count);
+  const size_t chunk = MAX_MESSAGE_BYTES / sizeof(T);
+  for (size_t begin = 0; begin < count; begin += chunk) {
+    const size_t size = std::min(chunk, count - begin) * sizeof(T);
+    comm.send(dest, tag, reinterpret_cast<const char *>(&events[begin]),
+              static_cast<int>(size));
+  }
+}
+
+template <class T>
+void receiveEvents(const Parallel::Communicator &comm, const int source,
+                   EventList &eventList) {
+  const int tag = 0;
+  size_t count;
+  comm.recv(source, tag, count);
+  if (count == 0)
+    return;
+  std::vector<T> events(count);
+  const size_t chunk = MAX_MESSAGE_BYTES / sizeof(T);
+  for (size_t begin = 0; begin < count; begin += chunk) {
+    const size_t size = std::min(chunk, count - begin) * sizeof(T);
+    comm.recv(source, tag, reinterpret_cast<char *>(&events[begin]),
+              static_cast<int>(size));
+  }
+  eventList += events;
+}
+
+void sendDetectorIDs(const Parallel::Communicator &comm, const int dest,
+                     const std::set<detid_t> &detIdSet) {
+  const int tag = 0;
+  std::vector<detid_t> detIds(detIdSet.begin(), detIdSet.end());
+  const auto size = static_cast<int>(detIds.size());
+  comm.send(dest, tag, size);
+  if (size > 0)
+    comm.send(dest, tag, detIds.data(), size);
+}
+
+void receiveDetectorIDs(const Parallel::Communicator &comm, const int source,
+                        API::ISpectrum &spectrum) {
+  const int tag = 0;
+  int size;
+  comm.recv(source, tag, size);
+  std::vector<detid_t> detIds(size);
+  if (size > 0)
+    comm.recv(source, tag, detIds.data(), size);
+  spectrum.addDetectorIDs(detIds);
+}
+} // namespace
+
 /** Initialisation method. Declares properties to be used in algorithm.
  *
  */
@@ -73,7 +202,7 @@ void DiffractionFocussing2::cleanup() {
   group2xvector.clear();
   group2wgtvector.clear();
   this->m_validGroups.clear();
-  this->m_wsIndices.clear();
+  m_grouping = SpectrumGrouping();
 }
 
 //=============================================================================
@@ -98,8 +227,19 @@ void DiffractionFocussing2::exec() {
 
   // Get the input workspace
   m_matrixInputW = getProperty("InputWorkspace");
-  nPoints = static_cast<int>(m_matrixInputW->blocksize());
+  m_distributed =
+      m_matrixInputW->storageMode() == Parallel::StorageMode::Distributed;
   nHist = static_cast<int>(m_matrixInputW->getNumberHistograms());
+  if (m_distributed) {
+    // Ranks may hold no spectra, use the same number of points everywhere
+    const int localPoints =
+        nHist > 0 ? static_cast<int>(m_matrixInputW->blocksize()) : 0;
+    std::vector<int> allPoints(communicator().size());
+    Parallel::all_gather(communicator(), localPoints, allPoints);
+    nPoints = *std::max_element(allPoints.begin(), allPoints.end());
+  } else {
+    nPoints = static_cast<int>(m_matrixInputW->blocksize());
+  }
 
   // Validate UnitID (spacing)
   Axis *axis = m_matrixInputW->getAxis(0);
@@ -150,6 +290,15 @@ void DiffractionFocussing2::exec() {
       // get the full d-spacing range
       m_eventW->sortAll(DataObjects::TOF_SORT, nullptr);
       m_matrixInputW->getXMinMax(eventXMin, eventXMax);
+      if (m_distributed) {
+        // Rebin every rank onto the limits of the whole workspace
+        double localMin = eventXMin;
+        double localMax = eventXMax;
+        Parallel::all_reduce(communicator(), &localMin, 1, &eventXMin,
+                             [](double a, double b) { return std::min(a, b); });
+        Parallel::all_reduce(communicator(), &localMax, 1, &eventXMax,
+                             [](double a, double b) { return std::max(a, b); });
+      }
     }
   }
 
@@ -163,55 +312,61 @@ void DiffractionFocussing2::exec() {
   if (nPoints <= 0) {
     throw std::runtime_error("No points found in the data range.");
   }
-  API::MatrixWorkspace_sptr out = API::WorkspaceFactory::Instance().create(
-      m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
+  API::MatrixWorkspace_sptr out;
+  if (m_distributed)
+    out = create<HistoWorkspace>(*m_matrixInputW, outputIndexInfo(),
+                                 BinEdges(nPoints + 1));
+  else
+    out = API::WorkspaceFactory::Instance().create(
+        m_matrixInputW, m_validGroups.size(), nPoints + 1, nPoints);
   // Caching containers that are either only read from or unused. Initialize
   // them once.
   // Helgrind will show a race-condition but the data is completely unused so it
   // is irrelevant
   MantidVec weights_default(1, 1.0), emptyVec(1, 0.0), EOutDummy(nPoints);
+  // The summed weights and number of spectra of each group, needed to
+  // normalise once all contributions (from all ranks) have been added
+  std::vector<MantidVec> groupWeights(m_validGroups.size());
+  std::vector<size_t> groupSizes(m_validGroups.size());
 
   Progress prog(this, 0.2, 1.0, static_cast<int>(totalHistProcess) + nGroups);
 
+  // Assign the new X axis of each group and the detectors of its spectra
   PARALLEL_FOR_IF(Kernel::threadSafe(*m_matrixInputW, *out))
   for (int outWorkspaceIndex = 0;
        outWorkspaceIndex < static_cast<int>(m_validGroups.size());
        outWorkspaceIndex++) {
     PARALLEL_START_INTERUPT_REGION
+    const size_t index = static_cast<size_t>(outWorkspaceIndex);
     int group = static_cast<int>(m_validGroups[outWorkspaceIndex]);
-
-    // Get the group
-    auto &Xout = group2xvector.at(group);
-
-    // Assign the new X axis only once (i.e when this group is encountered the
-    // first time)
-    out->setBinEdges(outWorkspaceIndex, Xout);
-
-    // This is the output spectrum
-    auto &outSpec = out->getSpectrum(outWorkspaceIndex);
+    out->setBinEdges(index, group2xvector.at(group));
+    auto &outSpec = out->getSpectrum(index);
     outSpec.setSpectrumNo(group);
+    m_grouping.addDetectorIDs(
+        {index, m_grouping.groupBegin(index), m_grouping.groupEnd(index)},
+        *m_matrixInputW, outSpec);
+    // Initialize the group's weight vector
+    groupWeights[index].assign(nPoints, 0.0);
+    groupSizes[index] = m_grouping.groupSize(index);
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
 
-    // Get the references to Y and E output and rebin
-    // TODO can only be changed once rebin implemented in HistogramData
-    auto &Yout = outSpec.dataY();
-    auto &Eout = outSpec.dataE();
-
-    // Initialize the group's weight vector here and the dummy vector used for
-    // accumulating errors.
-    MantidVec groupWgt(nPoints, 0.0);
-
-    // loop through the contributing histograms
-    const std::vector<size_t> &indices = m_wsIndices[outWorkspaceIndex];
-    const size_t groupSize = indices.size();
-    for (size_t i = 0; i < groupSize; i++) {
-      size_t inWorkspaceIndex = indices[i];
+  /* Rebin the contributing histograms of part of a group, adding them to
+   * Yout and Eout (squared) and their weights to groupWgt. */
+  const auto focusChunk = [&](const SpectrumGrouping::Chunk &chunk,
+                              MantidVec &Yout, MantidVec &Eout,
+                              MantidVec &groupWgt) {
+    const auto &Xout =
+        group2xvector.at(static_cast<int>(m_validGroups[chunk.group]));
+    for (size_t i = chunk.begin; i < chunk.end; i++) {
+      size_t inWorkspaceIndex = m_grouping.indices()[i];
       // This is the input spectrum
       const auto &inSpec = m_matrixInputW->getSpectrum(inWorkspaceIndex);
       // Get reference to its old X,Y,and E.
       auto &Xin = inSpec.x();
       auto &Yin = inSpec.y();
       auto &Ein = inSpec.e();
-      outSpec.addDetectorIDs(inSpec.getDetectorIDs());
 
       try {
         // TODO This should be implemented in Histogram as rebin
@@ -227,12 +382,12 @@ void DiffractionFocussing2::exec() {
       }
 
       // Check for masked bins in this spectrum
-      if (m_matrixInputW->hasMaskedBins(i)) {
+      if (m_matrixInputW->hasMaskedBins(inWorkspaceIndex)) {
         MantidVec weight_bins, weights;
         weight_bins.push_back(Xin.front());
         // If there are masked bins, get a reference to the list of them
         const API::MatrixWorkspace::MaskList &mask =
-            m_matrixInputW->maskedBins(i);
+            m_matrixInputW->maskedBins(inWorkspaceIndex);
         // Now iterate over the list, adjusting the weights for the affected
         // bins
         for (const auto &bin : mask) {
@@ -282,6 +437,67 @@ void DiffractionFocussing2::exec() {
       }
       prog.report();
     } // end of loop for input spectra
+  };
+
+  // Large groups are split into several chunks, each summed separately and
+  // added to the group once all chunks are done
+  const auto chunks = m_grouping.chunks();
+  std::vector<MantidVec> partY(chunks.size()), partE(chunks.size()),
+      partWgt(chunks.size());
+  PRAGMA_OMP(parallel for schedule(dynamic)
+             if (Kernel::threadSafe(*m_matrixInputW, *out))
+             num_threads(PARALLEL_TEAM_SIZE_IF(
+                 Kernel::threadSafe(*m_matrixInputW, *out))))
+  for (int i = 0; i < static_cast<int>(chunks.size()); i++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &chunk = chunks[i];
+    if (m_grouping.isWholeGroup(chunk)) {
+      auto &outSpec = out->getSpectrum(chunk.group);
+      focusChunk(chunk, outSpec.dataY(), outSpec.dataE(),
+                 groupWeights[chunk.group]);
+    } else {
+      partY[i].assign(nPoints, 0.0);
+      partE[i].assign(nPoints, 0.0);
+      partWgt[i].assign(nPoints, 0.0);
+      focusChunk(chunk, partY[i], partE[i], partWgt[i]);
+    }
+    PARALLEL_END_INTERUPT_REGION
+  } // end of loop for chunks
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  const auto addTo = [](MantidVec &sum, MantidVec &part) {
+    std::transform(sum.begin(), sum.end(), part.begin(), sum.begin(),
+                   std::plus<double>());
+    MantidVec().swap(part);
+  };
+  for (size_t i = 0; i < chunks.size(); i++) {
+    if (partY[i].empty())
+      continue;
+    auto &outSpec = out->getSpectrum(chunks[i].group);
+    addTo(outSpec.dataY(), partY[i]);
+    addTo(outSpec.dataE(), partE[i]);
+    addTo(groupWeights[chunks[i].group], partWgt[i]);
+  }
+
+  if (m_distributed) {
+    reduceHistograms(*out, groupWeights, groupSizes);
+    // The output is only kept on rank 0
+    if (communicator().rank() != 0) {
+      this->cleanup();
+      return;
+    }
+  }
+
+  PARALLEL_FOR_IF(Kernel::threadSafe(*out))
+  for (int outWorkspaceIndex = 0;
+       outWorkspaceIndex < static_cast<int>(m_validGroups.size());
+       outWorkspaceIndex++) {
+    PARALLEL_START_INTERUPT_REGION
+    const auto &Xout = out->x(outWorkspaceIndex);
+    auto &Yout = out->dataY(outWorkspaceIndex);
+    auto &Eout = out->dataE(outWorkspaceIndex);
+    const MantidVec &groupWgt = groupWeights[outWorkspaceIndex];
+    const size_t groupSize = groupSizes[outWorkspaceIndex];
 
     // Calculate the bin widths
     std::vector<double> widths(Xout.size());
@@ -331,8 +547,13 @@ void DiffractionFocussing2::exec() {
  */
 void DiffractionFocussing2::execEvent() {
   // Create a new outputworkspace with not much in it
-  auto out = create<EventWorkspace>(*m_matrixInputW, m_validGroups.size(),
-                                    m_matrixInputW->binEdges(0));
+  std::unique_ptr<EventWorkspace> out;
+  if (m_distributed)
+    out = create<EventWorkspace>(*m_matrixInputW, outputIndexInfo(),
+                                 group2xvector.begin()->second);
+  else
+    out = create<EventWorkspace>(*m_matrixInputW, m_validGroups.size(),
+                                 m_matrixInputW->binEdges(0));
 
   MatrixWorkspace_const_sptr outputWS = getProperty("OutputWorkspace");
   bool inPlace = (m_matrixInputW == outputWS);
@@ -350,10 +571,10 @@ void DiffractionFocussing2::execEvent() {
   vector<size_t> size_required(this->m_validGroups.size(), 0);
   int totalHistProcess = 0;
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
-    const vector<size_t> &indices = this->m_wsIndices[iGroup];
-
-    totalHistProcess += static_cast<int>(indices.size());
-    for (auto index : indices) {
+    totalHistProcess += static_cast<int>(m_grouping.groupSize(iGroup));
+    for (size_t i = m_grouping.groupBegin(iGroup);
+         i < m_grouping.groupEnd(iGroup); i++) {
+      const size_t index = m_grouping.indices()[i];
       size_required[iGroup] += m_eventW->getSpectrum(index).getNumberEvents();
     }
     prog->report(1, "Pre-counting");
@@ -363,12 +584,14 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = make_unique<Progress>(this, 0.25, 0.3, totalHistProcess);
 
-  // This creates and reserves the space required
+  // This creates and reserves the space required, unless focussing in place:
+  // the input events are then freed as the output grows
   for (size_t iGroup = 0; iGroup < this->m_validGroups.size(); iGroup++) {
     const int group = static_cast<int>(m_validGroups[iGroup]);
     EventList &groupEL = out->getSpectrum(iGroup);
     groupEL.switchTo(eventWtype);
-    groupEL.reserve(size_required[iGroup]);
+    if (!inPlace)
+      groupEL.reserve(size_required[iGroup]);
     groupEL.clearDetectorIDs();
     groupEL.setSpectrumNo(group);
     prog->reportIncrement(1, "Allocating");
@@ -378,71 +601,21 @@ void DiffractionFocussing2::execEvent() {
   prog.reset();
   prog = make_unique<Progress>(this, 0.3, 0.9, totalHistProcess);
 
-  if (this->m_validGroups.size() == 1) {
-    g_log.information() << "Performing focussing on a single group\n";
-    // Special case of a single group - parallelize differently
-    EventList &groupEL = out->getSpectrum(0);
-    const std::vector<size_t> &indices = this->m_wsIndices[0];
-
-    int chunkSize = 200;
-
-    int end = (totalHistProcess / chunkSize) + 1;
-    // cppcheck-suppress syntaxError
-    PRAGMA_OMP(parallel for schedule(dynamic, 1) )
-    for (int wiChunk = 0; wiChunk < end; wiChunk++) {
-      PARALLEL_START_INTERUPT_REGION
-
-      // Perform in chunks for more efficiency
-      int max = (wiChunk + 1) * chunkSize;
-      if (max > totalHistProcess)
-        max = totalHistProcess;
-
-      // Make a blank EventList that will accumulate the chunk.
-      EventList chunkEL;
-      chunkEL.switchTo(eventWtype);
-      // chunkEL.reserve(numEventsInChunk);
-
-      // process the chunk
-      for (int i = wiChunk * chunkSize; i < max; i++) {
-        // Accumulate the chunk
-        size_t wi = indices[i];
-        chunkEL += m_eventW->getSpectrum(wi);
-      }
-
-      // Rejoin the chunk with the rest.
-      PARALLEL_CRITICAL(DiffractionFocussing2_JoinChunks) {
-        groupEL += chunkEL;
-      }
-
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } else {
-    // ------ PARALLELIZE BY GROUPS -------------------------
-
-    int nValidGroups = static_cast<int>(this->m_validGroups.size());
-    PARALLEL_FOR_IF(Kernel::threadSafe(*m_eventW))
-    for (int iGroup = 0; iGroup < nValidGroups; iGroup++) {
-      PARALLEL_START_INTERUPT_REGION
-      const std::vector<size_t> &indices = this->m_wsIndices[iGroup];
-      for (auto wi : indices) {
-        // In workspace index iGroup, put what was in the OLD workspace index wi
-        out->getSpectrum(iGroup) += m_eventW->getSpectrum(wi);
-
-        prog->reportIncrement(1, "Appending Lists");
-
-        // When focussing in place, you can clear out old memory from the input
-        // one!
-        if (inPlace) {
-          boost::const_pointer_cast<EventWorkspace>(m_eventW)
-              ->getSpectrum(wi)
-              .clear();
-        }
-      }
-      PARALLEL_END_INTERUPT_REGION
-    }
-    PARALLEL_CHECK_INTERUPT_REGION
-  } // (done with parallel by groups)
+  // Groups are appended in parallel, a single large group being split between
+  // threads and joined without locking. When focussing in place, the input
+  // spectra are cleared out as soon as they are appended.
+  if (inPlace)
+    m_grouping.moveEvents(*boost::const_pointer_cast<EventWorkspace>(m_eventW),
+                          *out, prog.get());
+  else
+    m_grouping.concatenateEvents(*m_eventW, *out, prog.get());
+
+  if (m_distributed) {
+    gatherEvents(*out);
+    // The output is only kept on rank 0
+    if (communicator().rank() != 0)
+      return;
+  }
 
   // Now that the data is cleaned up, go through it and set the X vectors to the
   // input workspace we first talked about.
@@ -531,8 +704,6 @@ int DiffractionFocussing2::validateSpectrumInGroup(size_t wi) {
 void DiffractionFocussing2::determineRebinParameters() {
   std::ostringstream mess;
 
-  // typedef for the storage of the group ranges
-  typedef std::map<int, std::pair<double, double>> group2minmaxmap;
   // Map from group number to its associated range parameters <Xmin,Xmax,step>
   group2minmaxmap group2minmax;
   group2minmaxmap::iterator gpit;
@@ -581,6 +752,10 @@ void DiffractionFocussing2::determineRebinParameters() {
       (gpit->second).second = temp;
   }
 
+  // Every rank must focus onto the same groups and bin edges
+  if (m_distributed)
+    reduceRanges(communicator(), group2minmax);
+
   nGroups = group2minmax.size(); // Number of unique groups
 
   double Xmin, Xmax, step;
@@ -649,6 +824,11 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
     wsIndices[group].push_back(wi);
   }
 
+  // With distributed input some groups may have no spectra on this rank
+  if (!group2xvector.empty() &&
+      wsIndices.size() < static_cast<size_t>(group2xvector.rbegin()->first + 1))
+    wsIndices.resize(group2xvector.rbegin()->first + 1);
+
   // initialize a vector of the valid group numbers
   size_t totalHistProcess = 0;
   for (const auto &item : group2xvector) {
@@ -657,11 +837,132 @@ size_t DiffractionFocussing2::setupGroupToWSIndices() {
     totalHistProcess += wsIndices[group].size();
   }
 
+  m_grouping = SpectrumGrouping();
   for (const auto &group : m_validGroups)
-    m_wsIndices.push_back(std::move(wsIndices[static_cast<int>(group)]));
+    m_grouping.addGroup(wsIndices[static_cast<int>(group)]);
 
   return totalHistProcess;
 }
 
+/** Index info of the output when focussing a distributed input workspace. The
+ * output has one spectrum per group and is only kept on rank 0, all other
+ * ranks use a temporary copy for their partial sums.
+ */
+Indexing::IndexInfo DiffractionFocussing2::outputIndexInfo() const {
+  Indexing::IndexInfo indexInfo(m_validGroups.size(),
+                                communicator().rank() == 0
+                                    ? Parallel::StorageMode::MasterOnly
+                                    : Parallel::StorageMode::Cloned,
+                                communicator());
+  indexInfo.setSpectrumNumbers(
+      std::vector<Indexing::SpectrumNumber>(m_validGroups));
+  indexInfo.setSpectrumDefinitions(
+      std::vector<SpectrumDefinition>(m_validGroups.size()));
+  return indexInfo;
+}
+
+/** Sum the partially focussed histograms of all ranks on rank 0. Y and the
+ * squared errors have not been normalised yet, so they can simply be added,
+ * as can the weights and the number of spectra in each group.
+ * @param out :: The focussed workspace
+ * @param groupWeights :: The summed weights of each group
+ * @param groupSizes :: The number of spectra in each group
+ */
+void DiffractionFocussing2::reduceHistograms(
+    MatrixWorkspace &out, std::vector<MantidVec> &groupWeights,
+    std::vector<size_t> &groupSizes) const {
+  const auto &comm = communicator();
+  const int tag = 0;
+  const int nValidGroups = static_cast<int>(m_validGroups.size());
+  if (comm.rank() == 0) {
+    MantidVec buffer(nPoints);
+    const auto add = [&buffer](MantidVec &sum) {
+      std::transform(sum.begin(), sum.end(), buffer.begin(), sum.begin(),
+                     std::plus<double>());
+    };
+    for (int rank = 1; rank < comm.size(); ++rank) {
+      for (int i = 0; i < nValidGroups; ++i) {
+        auto &spectrum = out.getSpectrum(i);
+        comm.recv(rank, tag, buffer.data(), nPoints);
+        add(spectrum.dataY());
+        comm.recv(rank, tag, buffer.data(), nPoints);
+        add(spectrum.dataE());
+        comm.recv(rank, tag, buffer.data(), nPoints);
+        add(groupWeights[i]);
+        int groupSize;
+        comm.recv(rank, tag, groupSize);
+        groupSizes[i] += groupSize;
+        receiveDetectorIDs(comm, rank, spectrum);
+      }
+    }
+  } else {
+    for (int i = 0; i < nValidGroups; ++i) {
+      const auto &spectrum = out.getSpectrum(i);
+      comm.send(0, tag, spectrum.dataY().data(), nPoints);
+      comm.send(0, tag, spectrum.dataE().data(), nPoints);
+      comm.send(0, tag, groupWeights[i].data(), nPoints);
+      comm.send(0, tag, static_cast<int>(groupSizes[i]));
+      sendDetectorIDs(comm, 0, spectrum.getDetectorIDs());
+    }
+  }
+}
+
+/** Concatenate the focussed event lists of all ranks on rank 0.
+ * @param out :: The focussed workspace
+ */
+void DiffractionFocussing2::gatherEvents(EventWorkspace &out) const {
+  const auto &comm = communicator();
+  const int tag = 0;
+  const int nValidGroups = static_cast<int>(m_validGroups.size());
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    for (int i = 0; i < nValidGroups; ++i) {
+      if (comm.rank() == 0) {
+        auto &eventList = out.getSpectrum(i);
+        int type;
+        comm.recv(rank, tag, type);
+        switch (static_cast<EventType>(type)) {
+        case TOF:
+          receiveEvents<TofEvent>(comm, rank, eventList);
+          break;
+        case WEIGHTED:
+          receiveEvents<WeightedEvent>(comm, rank, eventList);
+          break;
+        case WEIGHTED_NOTIME:
+          receiveEvents<WeightedEventNoTime>(comm, rank, eventList);
+          break;
+        }
+        receiveDetectorIDs(comm, rank, eventList);
+      } else if (comm.rank() == rank) {
+        const auto &eventList = out.getSpectrum(i);
+        const auto type = eventList.getEventType();
+        comm.send(0, tag, static_cast<int>(type));
+        switch (type) {
+        case TOF:
+          sendEvents(comm, 0, eventList.getEvents());
+          break;
+        case WEIGHTED:
+          sendEvents(comm, 0, eventList.getWeightedEvents());
+          break;
+        case WEIGHTED_NOTIME:
+          sendEvents(comm, 0, eventList.getWeightedEventsNoTime());
+          break;
+        }
+        sendDetectorIDs(comm, 0, eventList.getDetectorIDs());
+      }
+    }
+  }
+}
+
+Parallel::ExecutionMode DiffractionFocussing2::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  if (storageModes.count("GroupingWorkspace") &&
+      storageModes.at("GroupingWorkspace") != Parallel::StorageMode::Cloned)
+    throw std::runtime_error(
+        "GroupingWorkspace must have " +
+        Parallel::toString(Parallel::StorageMode::Cloned));
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
+
 } // namespace Algorithm
 } // namespace Mantid
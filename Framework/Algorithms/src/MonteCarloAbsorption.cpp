@@ -141,6 +141,13 @@ void MonteCarloAbsorption::init() {
                   "If a scattering point cannot be generated by increasing "
                   "this value then there is most likely a problem with "
                   "the sample geometry.");
+  declareProperty("ResimulateTracksForDifferentWavelengths", true,
+                  "If true, a new set of tracks is generated for every "
+                  "simulated wavelength point. If false, the tracks for each "
+                  "detector are generated once and the path lengths are "
+                  "reused to calculate the attenuation at every wavelength "
+                  "point, in which case NumberOfWavelengthPoints is only "
+                  "used for the sparse instrument.");
 }
 
 /**
@@ -155,9 +162,12 @@ void MonteCarloAbsorption::exec() {
   interpolateOpt.set(getPropertyValue("Interpolation"));
   const bool useSparseInstrument = getProperty("SparseInstrument");
   const int maxScatterPtAttempts = getProperty("MaxScatterPtAttempts");
+  const bool resimulateTracks =
+      getProperty("ResimulateTracksForDifferentWavelengths");
   auto outputWS = doSimulation(*inputWS, static_cast<size_t>(nevents), nlambda,
                                seed, interpolateOpt, useSparseInstrument,
-                               static_cast<size_t>(maxScatterPtAttempts));
+                               static_cast<size_t>(maxScatterPtAttempts),
+                               resimulateTracks);
 
   setProperty("OutputWorkspace", std::move(outputWS));
 }
@@ -190,12 +200,15 @@ std::map<std::string, std::string> MonteCarloAbsorption::validateInputs() {
  * @param useSparseInstrument If true, use sparse instrument in simulation
  * @param maxScatterPtAttempts The maximum number of tries to generate a
  * scatter point within the object
+ * @param resimulateTracks If true, generate new tracks for every wavelength
+ * point, otherwise reuse the tracks of each detector for all wavelengths
  * @return A new workspace containing the correction factors & errors
  */
 MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
     const MatrixWorkspace &inputWS, const size_t nevents, int nlambda,
     const int seed, const InterpolationOption &interpolateOpt,
-    const bool useSparseInstrument, const size_t maxScatterPtAttempts) {
+    const bool useSparseInstrument, const size_t maxScatterPtAttempts,
+    const bool resimulateTracks) {
   auto outputWS = createOutputWorkspace(inputWS);
   const auto inputNbins = static_cast<int>(inputWS.blocksize());
   if (isEmpty(nlambda) || nlambda > inputNbins) {
@@ -227,8 +240,9 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
   EFixedProvider efixed(instrumentWS);
   auto beamProfile = createBeamProfile(*instrument, inputWS.sample());
 
-  // Configure progress
-  const int lambdaStepSize = nbins / nlambda;
+  // Configure progress. When the tracks are reused every point is cheap to
+  // evaluate so there is no need to interpolate.
+  const int lambdaStepSize = resimulateTracks ? nbins / nlambda : 1;
   Progress prog(this, 0.0, 1.0, nhists * nbins / lambdaStepSize);
   prog.setNotifyStep(0.01);
   const std::string reportMsg = "Computing corrections";
@@ -258,6 +272,21 @@ MatrixWorkspace_uptr MonteCarloAbsorption::doSimulation(
 
     auto &outY = simulationWS.mutableY(i);
     const auto lambdas = simulationWS.points(i);
+    if (!resimulateTracks) {
+      // One set of tracks for all wavelength points
+      std::vector<double> lambdasIn(lambdas.cbegin(), lambdas.cend());
+      std::vector<double> lambdasOut(lambdasIn);
+      if (efixed.emode() == DeltaEMode::Direct) {
+        std::fill(lambdasIn.begin(), lambdasIn.end(), lambdaFixed);
+      } else if (efixed.emode() == DeltaEMode::Indirect) {
+        std::fill(lambdasOut.begin(), lambdasOut.end(), lambdaFixed);
+      }
+      std::vector<double> factors;
+      strategy.calculate(rng, detPos, lambdasIn, lambdasOut, factors);
+      std::copy(factors.cbegin(), factors.cend(), outY.begin());
+      prog.reportIncrement(nbins, reportMsg);
+      continue;
+    }
     // Simulation for each requested wavelength point
     for (int j = 0; j < nbins; j += lambdaStepSize) {
       prog.report(reportMsg);
@@ -126,6 +126,10 @@ void Q1D2::exec() {
 
   const bool doGravity = getProperty("AccountForGravity");
   m_doSolidAngle = getProperty("SolidAngleWeighting");
+  if (m_doSolidAngle) {
+    m_solidAngles = make_unique<DetectorSolidAngles>(
+        m_dataWS->componentInfo(), m_dataWS->detectorInfo().samplePosition());
+  }
 
   // throws if we don't have common binning or another incompatibility
   Qhelper helper;
@@ -440,14 +444,13 @@ void Q1D2::pixelWeight(API::MatrixWorkspace_const_sptr pixelAdj,
                        const size_t wsIndex, double &weight,
                        double &error) const {
   const auto &detectorInfo = m_dataWS->detectorInfo();
-  const V3D samplePos = detectorInfo.samplePosition();
 
   if (m_doSolidAngle) {
     weight = 0.0;
     for (const auto detID : m_dataWS->getSpectrum(wsIndex).getDetectorIDs()) {
       const auto index = detectorInfo.indexOf(detID);
       if (!detectorInfo.isMasked(index))
-        weight += detectorInfo.detector(index).solidAngle(samplePos);
+        weight += (*m_solidAngles)[index];
     }
   } else
     weight = 1.0;
@@ -10,6 +10,7 @@
 #include "MantidAlgorithms/GravitySANSHelper.h"
 #include "MantidAlgorithms/Qhelper.h"
 #include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/DetectorSolidAngles.h"
 #include "MantidHistogramData/LinearGenerator.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -131,6 +132,10 @@ void Qxy::exec() {
   // the samplePos is often not (0, 0, 0) because the instruments components are
   // moved to account for the beam centre
   const V3D samplePos = spectrumInfo.samplePosition();
+  std::unique_ptr<const DetectorSolidAngles> solidAngles;
+  if (doSolidAngle)
+    solidAngles = make_unique<DetectorSolidAngles>(
+        inputWorkspace->componentInfo(), samplePos);
 
   for (int64_t i = 0; i < int64_t(numSpec); ++i) {
     if (!spectrumInfo.hasDetectors(i)) {
@@ -172,10 +177,13 @@ void Qxy::exec() {
     // the solid angle of the detector as seen by the sample is used for
     // normalisation later on
     double angle = 0.0;
-    for (const auto detID : inputWorkspace->getSpectrum(i).getDetectorIDs()) {
-      const auto index = detectorInfo.indexOf(detID);
-      if (!detectorInfo.isMasked(index))
-        angle += detectorInfo.detector(index).solidAngle(samplePos);
+    if (doSolidAngle) {
+      for (const auto detID :
+           inputWorkspace->getSpectrum(i).getDetectorIDs()) {
+        const auto index = detectorInfo.indexOf(detID);
+        if (!detectorInfo.isMasked(index))
+          angle += (*solidAngles)[index];
+      }
     }
 
     // some bins are masked completely or partially, the following vector will
@@ -5,12 +5,70 @@
 
 #include "MantidAlgorithms/SampleCorrections/RectangularBeamProfile.h"
 #include "MantidGeometry/Objects/CSGObject.h"
+#include "MantidGeometry/Objects/Track.h"
+#include "MantidKernel/Material.h"
+
+#include <algorithm>
+#include <cmath>
 
 namespace Mantid {
 using Kernel::PseudoRandomNumberGenerator;
 
 namespace Algorithms {
 
+namespace {
+/// Total lengths of a pair of tracks through each object
+struct ObjectPathLengths {
+  std::vector<double> before;
+  std::vector<double> after;
+};
+
+/**
+ * Add the length of each segment of a track to the total for its object
+ * @param path The track
+ * @param objects The distinct objects met so far. New ones are appended.
+ * @param lengths The total length in each object, indexed as objects
+ */
+void accumulatePathLengths(const Geometry::Track &path,
+                           std::vector<const Geometry::IObject *> &objects,
+                           std::vector<double> &lengths) {
+  for (const auto &segment : path) {
+    const auto found =
+        std::find(objects.begin(), objects.end(), segment.object);
+    const auto index = static_cast<size_t>(found - objects.begin());
+    if (found == objects.end())
+      objects.push_back(segment.object);
+    if (lengths.size() <= index)
+      lengths.resize(index + 1, 0.0);
+    lengths[index] += segment.distInsideObject;
+  }
+}
+
+/**
+ * Compute the attenuation coefficient, 100*rho*sigma, of the material of each
+ * object for each wavelength
+ * @param objects The objects
+ * @param lambdas The wavelengths, in angstroms
+ * @return Coefficients indexed as [object][wavelength]
+ */
+std::vector<std::vector<double>>
+attenuationCoefficients(const std::vector<const Geometry::IObject *> &objects,
+                        const std::vector<double> &lambdas) {
+  std::vector<std::vector<double>> coefficients(objects.size());
+  for (size_t m = 0; m < objects.size(); ++m) {
+    const auto material = objects[m]->material();
+    auto &materialCoefficients = coefficients[m];
+    materialCoefficients.reserve(lambdas.size());
+    for (const double lambda : lambdas) {
+      materialCoefficients.push_back(100 * material.numberDensity() *
+                                     (material.totalScatterXSection(lambda) +
+                                      material.absorbXSection(lambda)));
+    }
+  }
+  return coefficients;
+}
+} // namespace
+
 /**
  * Constructor
  * @param beamProfile A reference to the object the beam profile
@@ -72,5 +130,84 @@ MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
   return make_tuple(factor / static_cast<double>(m_nevents), m_error);
 }
 
+/**
+ * Compute the corrections for a final position of the neutron and a list of
+ * wavelengths. A single set of tracks is generated and the path lengths
+ * through each object are reused for every wavelength.
+ * @param rng A reference to a PseudoRandomNumberGenerator
+ * @param finalPos Defines the final position of the neutron, assumed to be
+ * where it is detected
+ * @param lambdasBefore Wavelengths, in \f$\\A^-1\f$, before scattering
+ * @param lambdasAfter Wavelengths, in \f$\\A^-1\f$, after scattering. Must
+ * be the same size as lambdasBefore.
+ * @param attenuationFactors Set to the correction factor for each wavelength.
+ * The error on each factor is given by error().
+ */
+void MCAbsorptionStrategy::calculate(Kernel::PseudoRandomNumberGenerator &rng,
+                                     const Kernel::V3D &finalPos,
+                                     const std::vector<double> &lambdasBefore,
+                                     const std::vector<double> &lambdasAfter,
+                                     std::vector<double> &attenuationFactors)
+    const {
+  if (lambdasBefore.size() != lambdasAfter.size()) {
+    throw std::invalid_argument("MCAbsorptionStrategy::calculate() - the "
+                                "number of wavelengths before and after "
+                                "scattering must be the same.");
+  }
+  const auto scatterBounds = m_scatterVol.getBoundingBox();
+  std::vector<const Geometry::IObject *> objects;
+  std::vector<ObjectPathLengths> pathLengths(m_nevents);
+  Geometry::Track beforeScatter;
+  Geometry::Track afterScatter;
+  for (size_t i = 0; i < m_nevents; ++i) {
+    size_t attempts(0);
+    do {
+      const auto neutron = m_beamProfile.generatePoint(rng, scatterBounds);
+      if (m_scatterVol.calculateBeforeAfterTrack(
+              rng, neutron.startPos, finalPos, beforeScatter, afterScatter)) {
+        accumulatePathLengths(beforeScatter, objects, pathLengths[i].before);
+        accumulatePathLengths(afterScatter, objects, pathLengths[i].after);
+        break;
+      }
+      ++attempts;
+      if (attempts == m_maxScatterAttempts) {
+        throw std::runtime_error("Unable to generate valid track through "
+                                 "sample interaction volume after " +
+                                 std::to_string(m_maxScatterAttempts) +
+                                 " attempts. Try increasing the maximum "
+                                 "threshold or if this does not help then "
+                                 "please check the defined shape.");
+      }
+    } while (true);
+  }
+
+  // Evaluate the attenuation for all wavelengths at once from the lengths
+  const size_t nlambda = lambdasBefore.size();
+  const auto coeffsBefore = attenuationCoefficients(objects, lambdasBefore);
+  const auto coeffsAfter = attenuationCoefficients(objects, lambdasAfter);
+  attenuationFactors.assign(nlambda, 0.0);
+  std::vector<double> exponent(nlambda);
+  for (const auto &lengths : pathLengths) {
+    std::fill(exponent.begin(), exponent.end(), 0.0);
+    for (size_t m = 0; m < lengths.before.size(); ++m) {
+      const double length = lengths.before[m];
+      const auto &coeffs = coeffsBefore[m];
+      for (size_t j = 0; j < nlambda; ++j)
+        exponent[j] += coeffs[j] * length;
+    }
+    for (size_t m = 0; m < lengths.after.size(); ++m) {
+      const double length = lengths.after[m];
+      const auto &coeffs = coeffsAfter[m];
+      for (size_t j = 0; j < nlambda; ++j)
+        exponent[j] += coeffs[j] * length;
+    }
+    for (size_t j = 0; j < nlambda; ++j)
+      attenuationFactors[j] += std::exp(-exponent[j]);
+  }
+  const double norm = 1.0 / static_cast<double>(m_nevents);
+  for (auto &factor : attenuationFactors)
+    factor *= norm;
+}
+
 } // namespace Algorithms
 } // namespace Mantid
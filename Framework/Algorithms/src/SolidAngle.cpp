@@ -1,11 +1,13 @@
 #include "MantidAlgorithms/SolidAngle.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorSolidAngles.h"
 #include "MantidAPI/InstrumentValidator.h"
 #include "MantidAPI/MatrixWorkspace.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidKernel/UnitFactory.h"
+#include "MantidKernel/make_unique.h"
 #include "MantidGeometry/IComponent.h"
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/IDetector.h"
@@ -85,6 +87,12 @@ void SolidAngle::exec() {
   const auto &detectorInfo = inputWS->detectorInfo();
   const Kernel::V3D samplePos = spectrumInfo.samplePosition();
   g_log.debug() << "Sample position is " << samplePos << '\n';
+  // Solid angles of all detectors, reused if the geometry is unchanged. A
+  // range of spectra only computes the solid angles of its own detectors.
+  std::unique_ptr<const Geometry::DetectorSolidAngles> solidAngles;
+  if (m_MinSpec == 0 && m_MaxSpec == numberOfSpectra - 1)
+    solidAngles = Kernel::make_unique<Geometry::DetectorSolidAngles>(
+        inputWS->componentInfo(), samplePos);
 
   const int loopIterations = m_MaxSpec - m_MinSpec;
   int failCount = 0;
@@ -99,9 +107,13 @@ void SolidAngle::exec() {
       // Copy over the spectrum number & detector IDs
       outputWS->getSpectrum(j).copyInfoFrom(inputWS->getSpectrum(i));
       double solidAngle = 0.0;
-      for (const auto detID : inputWS->getSpectrum(j).getDetectorIDs()) {
+      for (const auto detID : inputWS->getSpectrum(i).getDetectorIDs()) {
         const auto index = detectorInfo.indexOf(detID);
-        if (!detectorInfo.isMasked(index))
+        if (detectorInfo.isMasked(index))
+          continue;
+        if (solidAngles)
+          solidAngle += (*solidAngles)[index];
+        else
           solidAngle += detectorInfo.detector(index).solidAngle(samplePos);
       }
 
@@ -8,6 +8,7 @@
 #include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidAlgorithms/BinaryOperation.h"
+#include "MantidAlgorithms/Plus.h"
 #include "MantidAPI/AnalysisDataService.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
@@ -137,6 +138,46 @@ void run_parallel_single_value(const Parallel::Communicator &comm,
   }
 }
 
+void run_parallel_single_spectrum(const Parallel::Communicator &comm,
+                                  const Parallel::StorageMode storageModeB) {
+  using namespace Parallel;
+  using namespace HistogramData;
+  auto alg = ParallelTestHelpers::create<Plus>(comm);
+  Indexing::IndexInfo indexInfo(100, StorageMode::Distributed, comm);
+  alg->setProperty("LHSWorkspace",
+                   create<Workspace2D>(indexInfo,
+                                       Histogram(Points(2), Counts{1.0, 2.0})));
+  if (comm.rank() == 0 || storageModeB != StorageMode::MasterOnly) {
+    Indexing::IndexInfo rhsIndexInfo(1, storageModeB, comm);
+    alg->setProperty(
+        "RHSWorkspace",
+        create<Workspace2D>(rhsIndexInfo,
+                            Histogram(Points(2), Counts{10.0, 20.0})));
+  }
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  MatrixWorkspace_const_sptr out = alg->getProperty("OutputWorkspace");
+  TS_ASSERT_EQUALS(out->storageMode(), StorageMode::Distributed);
+  TS_ASSERT_EQUALS(out->indexInfo().globalSize(), 100);
+  for (size_t i = 0; i < out->getNumberHistograms(); ++i)
+    TS_ASSERT_EQUALS(out->y(i).rawData(), std::vector<double>({11.0, 22.0}));
+}
+
+void run_parallel_misaligned_fail(const Parallel::Communicator &comm) {
+  using namespace Parallel;
+  auto alg = ParallelTestHelpers::create<BinaryOpHelper>(comm);
+  Indexing::IndexInfo lhsIndexInfo(100, StorageMode::Distributed, comm);
+  alg->setProperty("LHSWorkspace", create<Workspace2D>(
+                                       lhsIndexInfo, HistogramData::Points(1)));
+  Indexing::IndexInfo rhsIndexInfo(99, StorageMode::Distributed, comm);
+  alg->setProperty("RHSWorkspace", create<Workspace2D>(
+                                       rhsIndexInfo, HistogramData::Points(1)));
+  if (comm.size() > 1) {
+    TS_ASSERT_THROWS(alg->execute(), const std::runtime_error &);
+  } else {
+    TS_ASSERT_THROWS(alg->execute(), const std::invalid_argument &);
+  }
+}
+
 void run_parallel_AllowDifferentNumberSpectra_fail(
     const Parallel::Communicator &comm,
     const Parallel::StorageMode storageMode) {
@@ -439,6 +480,20 @@ public:
                                      Parallel::StorageMode::Cloned);
   }
 
+  void test_parallel_Distributed_ClonedSingleSpectrum() {
+    ParallelTestHelpers::runParallel(run_parallel_single_spectrum,
+                                     Parallel::StorageMode::Cloned);
+  }
+
+  void test_parallel_Distributed_MasterOnlySingleSpectrum() {
+    ParallelTestHelpers::runParallel(run_parallel_single_spectrum,
+                                     Parallel::StorageMode::MasterOnly);
+  }
+
+  void test_parallel_Distributed_misaligned_fail() {
+    ParallelTestHelpers::runParallel(run_parallel_misaligned_fail);
+  }
+
   void test_parallel_AllowDifferentNumberSpectra_fail() {
     using ParallelTestHelpers::runParallel;
     runParallel(run_parallel_AllowDifferentNumberSpectra_fail,
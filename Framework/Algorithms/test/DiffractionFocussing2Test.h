@@ -10,9 +10,16 @@
 #include "MantidDataHandling/LoadNexus.h"
 #include "MantidDataHandling/LoadRaw3.h"
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/UnitFactory.h"
 #include <cxxtest/TestSuite.h>
 #include "MantidKernel/cow_ptr.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 #include "MantidAPI/FrameworkManager.h"
 
@@ -23,8 +30,88 @@ using namespace Mantid::Kernel;
 using namespace Mantid::Algorithms;
 using namespace Mantid::DataObjects;
 using Mantid::HistogramData::BinEdges;
+using Mantid::HistogramData::Counts;
 using Mantid::Types::Event::TofEvent;
 
+namespace {
+MatrixWorkspace_sptr createFocusInput(const Parallel::Communicator &comm,
+                                      const Parallel::StorageMode storageMode,
+                                      const bool events) {
+  // Two banks with 9 detectors each
+  auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(2);
+  Indexing::IndexInfo indexInfo(18, storageMode, comm);
+  MatrixWorkspace_sptr ws;
+  if (events)
+    ws = create<EventWorkspace>(instrument, indexInfo,
+                                BinEdges{1.0, 2.0, 3.0, 4.0});
+  else
+    ws = create<Workspace2D>(
+        instrument, indexInfo,
+        HistogramData::Histogram(BinEdges{1.0, 2.0, 3.0, 4.0},
+                                 Counts{1.0, 2.0, 3.0}));
+  ws->getAxis(0)->unit() = UnitFactory::Instance().create("dSpacing");
+  // Shift the X range of each spectrum so the ranks see different ranges
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    const double x =
+        1.0 + 0.1 * static_cast<int>(ws->indexInfo().spectrumNumber(i));
+    ws->setBinEdges(i, BinEdges{x, x + 1.0, x + 2.0, x + 3.0});
+    if (events) {
+      auto &eventList = dynamic_cast<EventWorkspace &>(*ws).getSpectrum(i);
+      eventList.addEventQuickly(TofEvent(x + 0.5));
+      eventList.addEventQuickly(TofEvent(x + 2.5));
+    }
+  }
+  return ws;
+}
+
+MatrixWorkspace_sptr runFocus(const Parallel::Communicator &comm,
+                              const MatrixWorkspace_sptr &input,
+                              const bool preserveEvents) {
+  auto grouping =
+      boost::make_shared<GroupingWorkspace>(input->getInstrument());
+  for (size_t i = 0; i < grouping->getNumberHistograms(); ++i)
+    grouping->mutableY(i)[0] = i < 9 ? 1.0 : 2.0;
+  auto alg = ParallelTestHelpers::create<DiffractionFocussing2>(comm);
+  alg->setProperty("InputWorkspace", input);
+  alg->setProperty("GroupingWorkspace", grouping);
+  alg->setProperty("PreserveEvents", preserveEvents);
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  return alg->getProperty("OutputWorkspace");
+}
+
+void run_distributed(const Parallel::Communicator &comm, const bool events,
+                     const bool preserveEvents) {
+  const auto reference = runFocus(
+      Parallel::Communicator(),
+      createFocusInput(Parallel::Communicator(),
+                       Parallel::StorageMode::Cloned, events),
+      preserveEvents);
+  const auto out = runFocus(
+      comm, createFocusInput(comm, Parallel::StorageMode::Distributed, events),
+      preserveEvents);
+  // Only rank 0 keeps the focussed workspace
+  if (comm.rank() != 0)
+    return;
+  TS_ASSERT_EQUALS(out->storageMode(), Parallel::StorageMode::MasterOnly);
+  TS_ASSERT_EQUALS(out->getNumberHistograms(), 2);
+  for (size_t i = 0; i < 2; ++i) {
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getSpectrumNo(),
+                     reference->getSpectrum(i).getSpectrumNo());
+    TS_ASSERT_EQUALS(out->getSpectrum(i).getDetectorIDs(),
+                     reference->getSpectrum(i).getDetectorIDs());
+    TS_ASSERT_EQUALS(out->x(i).rawData(), reference->x(i).rawData());
+    for (size_t bin = 0; bin < reference->y(i).size(); ++bin) {
+      TS_ASSERT_DELTA(out->y(i)[bin], reference->y(i)[bin], 1e-12);
+      TS_ASSERT_DELTA(out->e(i)[bin], reference->e(i)[bin], 1e-12);
+    }
+  }
+  if (preserveEvents)
+    TS_ASSERT_EQUALS(
+        boost::dynamic_pointer_cast<EventWorkspace>(out)->getNumberEvents(),
+        36);
+}
+}
+
 class DiffractionFocussing2Test : public CxxTest::TestSuite {
 public:
   void testName() { TS_ASSERT_EQUALS(focus.name(), "DiffractionFocussing"); }
@@ -96,6 +183,19 @@ public:
     dotestEventWorkspace(false, 1, false);
   }
 
+  void test_parallel_histograms() {
+    ParallelTestHelpers::runParallel(run_distributed, false, false);
+  }
+
+  void test_parallel_events() {
+    ParallelTestHelpers::runParallel(run_distributed, true, true);
+  }
+
+  void test_parallel_events_dontPreserveEvents() {
+    // The events are rebinned onto the X range of all ranks
+    ParallelTestHelpers::runParallel(run_distributed, true, false);
+  }
+
   void dotestEventWorkspace(bool inplace, size_t numgroups,
                             bool preserveEvents = true,
                             int bankWidthInPixels = 16) {
@@ -58,6 +58,42 @@ public:
     TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), error, 1e-08);
   }
 
+  void test_Simulation_For_Many_Wavelengths_Reuses_Tracks() {
+    using Mantid::Kernel::V3D;
+    using namespace MonteCarloTesting;
+    using namespace ::testing;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    MockBeamProfile testBeamProfile;
+    EXPECT_CALL(testBeamProfile, defineActiveRegion(_))
+        .WillOnce(Return(testSampleSphere.getShape().getBoundingBox()));
+    const size_t nevents(10), maxTries(100);
+    MCAbsorptionStrategy mcabsorb(testBeamProfile, testSampleSphere, nevents,
+                                  maxTries);
+    // Still 3 random numbers per event, independent of the wavelengths
+    MockRNG rng;
+    EXPECT_CALL(rng, nextValue())
+        .Times(Exactly(30))
+        .WillRepeatedly(Return(0.5));
+    const Mantid::Algorithms::IBeamProfile::Ray testRay = {V3D(-2, 0, 0),
+                                                           V3D(1, 0, 0)};
+    EXPECT_CALL(testBeamProfile, generatePoint(_, _))
+        .Times(Exactly(static_cast<int>(nevents)))
+        .WillRepeatedly(Return(testRay));
+    const V3D endPos(0.7, 0.7, 1.4);
+    const std::vector<double> lambdasBefore = {2.5, 2.5, 1.0};
+    const std::vector<double> lambdasAfter = {3.5, 3.5, 1.0};
+
+    std::vector<double> factors;
+    mcabsorb.calculate(rng, endPos, lambdasBefore, lambdasAfter, factors);
+    TS_ASSERT_EQUALS(3, factors.size());
+    TS_ASSERT_DELTA(0.0043828472, factors[0], 1e-08);
+    TS_ASSERT_DELTA(factors[0], factors[1], 1e-12);
+    TS_ASSERT(factors[2] > factors[0]);
+    TS_ASSERT_DELTA(1.0 / std::sqrt(nevents), mcabsorb.error(), 1e-08);
+  }
+
   //----------------------------------------------------------------------------
   // Failure cases
   //----------------------------------------------------------------------------
@@ -84,6 +120,26 @@ public:
                      std::runtime_error)
   }
 
+  void test_mismatched_wavelength_lists_throws() {
+    using Mantid::Algorithms::RectangularBeamProfile;
+    using namespace Mantid::Geometry;
+    using namespace Mantid::Kernel;
+
+    auto testSampleSphere = MonteCarloTesting::createTestSample(
+        MonteCarloTesting::TestSampleType::SolidSphere);
+    RectangularBeamProfile testBeamProfile(
+        ReferenceFrame(Y, Z, Right, "source"), V3D(), 1, 1);
+    MCAbsorptionStrategy mcabs(testBeamProfile, testSampleSphere, 10, 100);
+    MersenneTwister rng;
+    rng.setSeed(1);
+    const std::vector<double> lambdasBefore = {2.5, 3.0};
+    const std::vector<double> lambdasAfter = {3.5};
+    std::vector<double> factors;
+    TS_ASSERT_THROWS(mcabs.calculate(rng, V3D(0.7, 0.7, 1.4), lambdasBefore,
+                                     lambdasAfter, factors),
+                     std::invalid_argument)
+  }
+
 private:
   class MockBeamProfile final : public Mantid::Algorithms::IBeamProfile {
   public:
@@ -214,6 +214,30 @@ public:
     TS_ASSERT_DELTA(2.8600668e-05, outputWS->y(0).back(), delta);
   }
 
+  void test_Reusing_Tracks_Matches_First_Simulated_Point() {
+    using Mantid::Kernel::DeltaEMode;
+    TestWorkspaceDescriptor wsProps = {5, 10, Environment::SampleOnly,
+                                       DeltaEMode::Elastic, -1, -1};
+    auto inputWS = setUpWS(wsProps);
+    auto mcabs = createAlgorithm();
+    TS_ASSERT_THROWS_NOTHING(mcabs->setProperty("InputWorkspace", inputWS));
+    TS_ASSERT_THROWS_NOTHING(
+        mcabs->setProperty("ResimulateTracksForDifferentWavelengths", false));
+    mcabs->execute();
+    auto outputWS = getOutputWorkspace(mcabs);
+
+    verifyDimensions(wsProps, outputWS);
+    // The first point sees the same random sequence as the default mode
+    const double delta(1e-05);
+    TS_ASSERT_DELTA(0.0074366635, outputWS->y(0).front(), delta);
+    TS_ASSERT_DELTA(0.0073977126, outputWS->y(2).front(), delta);
+    const auto &y = outputWS->y(0);
+    for (size_t i = 1; i < y.size(); ++i) {
+      TS_ASSERT(y[i] > 0.0);
+      TS_ASSERT(y[i] < y[i - 1]);
+    }
+  }
+
   //---------------------------------------------------------------------------
   // Failure cases
   //---------------------------------------------------------------------------
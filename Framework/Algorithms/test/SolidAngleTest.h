@@ -151,7 +151,32 @@ public:
     }
   }
 
+  void test_subset_gives_the_values_of_the_whole_workspace() {
+    const auto whole = runSolidAngle(0, Nhist - 1);
+    const auto subset = runSolidAngle(140, Nhist - 1);
+    TS_ASSERT_EQUALS(subset->getNumberHistograms(), 4);
+    for (size_t i = 0; i < subset->getNumberHistograms(); ++i) {
+      TS_ASSERT_EQUALS(subset->getSpectrum(i).getSpectrumNo(),
+                       whole->getSpectrum(140 + i).getSpectrumNo());
+      TS_ASSERT_DELTA(subset->y(i)[0], whole->y(140 + i)[0], 1e-12);
+    }
+    // The masked detector still gives zero solid angle
+    TS_ASSERT_EQUALS(subset->y(3).front(), 0);
+  }
+
 private:
+  MatrixWorkspace_sptr runSolidAngle(const int start, const int end) {
+    SolidAngle solidAngle;
+    solidAngle.initialize();
+    solidAngle.setChild(true);
+    solidAngle.setPropertyValue("InputWorkspace", inputSpace);
+    solidAngle.setPropertyValue("OutputWorkspace", "unused");
+    solidAngle.setProperty("StartWorkspaceIndex", start);
+    solidAngle.setProperty("EndWorkspaceIndex", end);
+    solidAngle.execute();
+    return solidAngle.getProperty("OutputWorkspace");
+  }
+
   SolidAngle alg;
   std::string inputSpace;
   std::string outputSpace;
@@ -71,6 +71,9 @@ private:
   Kernel::cow_ptr<std::vector<std::vector<size_t>>> m_indexMap{nullptr};
   /// For linear index -> (detector index, time index) conversions
   Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
+  /// Changes whenever a position or rotation changes, see geometryVersion()
+  size_t m_geometryVersion{nextGeometryVersion()};
+  static size_t nextGeometryVersion();
   void failIfDetectorInfoScanning() const;
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void initScanIntervals();
@@ -161,6 +164,7 @@ public:
   scanInterval(const std::pair<size_t, size_t> &index) const;
   void setScanInterval(const std::pair<int64_t, int64_t> &interval);
   void merge(const ComponentInfo &other);
+  size_t geometryVersion() const;
 
   class Range {
   private:
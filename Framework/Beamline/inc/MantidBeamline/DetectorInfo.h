@@ -108,8 +108,10 @@ public:
   double l1() const;
   Eigen::Vector3d sourcePosition() const;
   Eigen::Vector3d samplePosition() const;
+  std::pair<size_t, size_t> geometryVersion() const;
 
 private:
+  static size_t nextGeometryVersion();
   size_t linearIndex(const std::pair<size_t, size_t> &index) const;
   void checkNoTimeDependence() const;
   void initScanCounts();
@@ -137,6 +139,8 @@ private:
   /// For linear index -> (detector index, time index) conversions
   Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> m_indices{nullptr};
   ComponentInfo *m_componentInfo = nullptr; // Geometry::ComponentInfo owner
+  /// Changes whenever a position or rotation changes, see geometryVersion()
+  size_t m_geometryVersion{nextGeometryVersion()};
 };
 
 /** Returns the number of detectors in the instrument.
@@ -194,12 +198,14 @@ inline void DetectorInfo::setPosition(const size_t index,
                                       const Eigen::Vector3d &position) {
   checkNoTimeDependence();
   m_positions.access()[index] = position;
+  m_geometryVersion = nextGeometryVersion();
 }
 
 /// Set the position of the detector with given index.
 inline void DetectorInfo::setPosition(const std::pair<size_t, size_t> &index,
                                       const Eigen::Vector3d &position) {
   m_positions.access()[linearIndex(index)] = position;
+  m_geometryVersion = nextGeometryVersion();
 }
 
 /** Set the rotation of the detector with given detector index.
@@ -210,12 +216,14 @@ inline void DetectorInfo::setRotation(const size_t index,
                                       const Eigen::Quaterniond &rotation) {
   checkNoTimeDependence();
   m_rotations.access()[index] = rotation.normalized();
+  m_geometryVersion = nextGeometryVersion();
 }
 
 /// Set the rotation of the detector with given index.
 inline void DetectorInfo::setRotation(const std::pair<size_t, size_t> &index,
                                       const Eigen::Quaterniond &rotation) {
   m_rotations.access()[linearIndex(index)] = rotation.normalized();
+  m_geometryVersion = nextGeometryVersion();
 }
 
 /// Throws if this has time-dependent data.
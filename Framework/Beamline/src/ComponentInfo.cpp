@@ -2,6 +2,7 @@
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidKernel/make_cow.h"
 #include <algorithm>
+#include <atomic>
 #include <boost/make_shared.hpp>
 #include <iterator>
 #include <numeric>
@@ -12,6 +13,9 @@ namespace Mantid {
 namespace Beamline {
 
 namespace {
+/// Source of geometry versions, see DetectorInfo.cpp
+std::atomic<size_t> g_geometryVersion{0};
+
 void failMerge(const std::string &what) {
   throw std::runtime_error(std::string("Cannot merge ComponentInfo: ") + what);
 }
@@ -237,6 +241,7 @@ void ComponentInfo::doSetPosition(const std::pair<size_t, size_t> &index,
                                   const Eigen::Vector3d &newPosition,
                                   const ComponentInfo::Range &detectorRange) {
 
+  m_geometryVersion = nextGeometryVersion();
   const auto componentIndex = index.first;
   const auto timeIndex = index.second;
   const Eigen::Vector3d offset = newPosition - position(componentIndex);
@@ -256,6 +261,7 @@ void ComponentInfo::doSetRotation(const std::pair<size_t, size_t> &index,
                                   const Eigen::Quaterniond &newRotation,
                                   const ComponentInfo::Range &detectorRange) {
 
+  m_geometryVersion = nextGeometryVersion();
   const auto componentIndex = index.first;
   const auto timeIndex = index.second;
   const Eigen::Vector3d compPos = position(index);
@@ -621,6 +627,7 @@ this has no time dependence prior to this operation.
 **/
 void ComponentInfo::merge(const ComponentInfo &other) {
   checkNoTimeDependence();
+  m_geometryVersion = nextGeometryVersion();
   const auto &toMerge = buildMergeIndicesSync(other);
   for (size_t timeIndex = 0; timeIndex < other.m_scanIntervals->size();
        ++timeIndex) {
@@ -642,6 +649,14 @@ void ComponentInfo::merge(const ComponentInfo &other) {
   m_detectorInfo->merge(*other.m_detectorInfo);
 }
 
+/** Returns a number that changes whenever the position or rotation of any
+ * non-detector component changes. Moving detectors changes
+ * DetectorInfo::geometryVersion() instead. */
+size_t ComponentInfo::geometryVersion() const { return m_geometryVersion; }
+
+/// Returns a geometry version that has not been used before.
+size_t ComponentInfo::nextGeometryVersion() { return ++g_geometryVersion; }
+
 std::vector<bool>
 ComponentInfo::buildMergeIndicesSync(const ComponentInfo &other) const {
   checkSizes(other);
@@ -3,10 +3,17 @@
 #include "MantidKernel/make_cow.h"
 
 #include <algorithm>
+#include <atomic>
 
 namespace Mantid {
 namespace Beamline {
 
+namespace {
+/// Source of geometry versions, shared by all instances so that versions of
+/// different instances never coincide after assignment.
+std::atomic<size_t> g_geometryVersion{0};
+} // namespace
+
 DetectorInfo::DetectorInfo(
     std::vector<Eigen::Vector3d> positions,
     std::vector<Eigen::Quaterniond,
@@ -258,6 +265,7 @@ getIndex(const Kernel::cow_ptr<std::vector<std::pair<size_t, size_t>>> &indices,
  * index in `other` is identical to a corresponding interval in `this`, it is
  * ignored, i.e., no time index is added. */
 void DetectorInfo::merge(const DetectorInfo &other) {
+  m_geometryVersion = nextGeometryVersion();
   if (!m_scanCounts)
     initScanCounts();
   if (m_isSyncScan) {
@@ -341,6 +349,22 @@ Eigen::Vector3d DetectorInfo::samplePosition() const {
   return m_componentInfo->samplePosition();
 }
 
+/** Returns a pair of numbers that changes whenever the position or rotation
+ * of any detector, or of any other component such as the sample or source,
+ * changes.
+ *
+ * Copies share the version of the original until either is modified, so
+ * clients can use this to validate caches of quantities derived from the
+ * detector positions, such as L2 or 2 theta. */
+std::pair<size_t, size_t> DetectorInfo::geometryVersion() const {
+  if (!hasComponentInfo())
+    return {m_geometryVersion, 0};
+  return {m_geometryVersion, m_componentInfo->geometryVersion()};
+}
+
+/// Returns a geometry version that has not been used before.
+size_t DetectorInfo::nextGeometryVersion() { return ++g_geometryVersion; }
+
 void DetectorInfo::initScanCounts() {
   checkNoTimeDependence();
   if (m_isSyncScan)
@@ -271,6 +271,23 @@ public:
     TS_ASSERT_EQUALS(info.rotation(0).coeffs(), rot.normalized().coeffs());
   }
 
+  void test_geometryVersion() {
+    DetectorInfo info(PosVec(1), RotVec(1));
+    const DetectorInfo copy(info);
+    const DetectorInfo other(PosVec(1), RotVec(1));
+    TS_ASSERT_EQUALS(copy.geometryVersion(), info.geometryVersion());
+    TS_ASSERT_DIFFERS(other.geometryVersion(), info.geometryVersion());
+    info.setPosition(0, {1, 2, 3});
+    const auto moved = info.geometryVersion();
+    TS_ASSERT_DIFFERS(moved, copy.geometryVersion());
+    info.setRotation(0, Eigen::Quaterniond(1, 2, 3, 4));
+    TS_ASSERT_DIFFERS(info.geometryVersion(), moved);
+    // Masking is not geometry
+    const auto rotated = info.geometryVersion();
+    info.setMasked(0, true);
+    TS_ASSERT_EQUALS(info.geometryVersion(), rotated);
+  }
+
   void test_scanCount() {
     DetectorInfo info(PosVec(1), RotVec(1));
     TS_ASSERT_EQUALS(info.scanCount(0), 1);
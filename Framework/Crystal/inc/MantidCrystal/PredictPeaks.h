@@ -62,11 +62,15 @@ private:
 
   void setStructureFactorCalculatorFromSample(const API::Sample &sample);
 
-  void calculateQAndAddToOutput(const Kernel::V3D &hkl,
-                                const Kernel::DblMatrix &orientedUB,
-                                const Kernel::DblMatrix &goniometerMatrix);
+  void calculateQAndAddToOutput(
+      const Kernel::V3D &hkl, const Kernel::DblMatrix &orientedUB,
+      const Kernel::DblMatrix &goniometerMatrix,
+      const API::DetectorSearcher::DetectorSearchResult &result);
 
 private:
+  /// Get the Q vector in the lab frame of a peak
+  Kernel::V3D calculateQ(const Kernel::V3D &hkl,
+                         const Kernel::DblMatrix &orientedUB) const;
   /// Get the predicted detector direction from Q
   std::tuple<Kernel::V3D, double>
   getPeakParametersFromQ(const Kernel::V3D &q) const;
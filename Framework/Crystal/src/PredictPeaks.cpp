@@ -273,8 +273,6 @@ void PredictPeaks::exec() {
      * allowed peaks with a counter. */
     HKLFilterWavelength lambdaFilter(orientedUB, lambdaMin, lambdaMax);
 
-    size_t allowedPeakCount = 0;
-
     bool useExtendedDetectorSpace = getProperty("PredictPeaksOutsideDetectors");
     if (useExtendedDetectorSpace &&
         !m_inst->getComponentByName("extended-detector-space")) {
@@ -282,11 +280,25 @@ void PredictPeaks::exec() {
                          "no extended detector space has been defined\n";
     }
 
+    std::vector<V3D> allowedHKLs;
     for (auto &possibleHKL : possibleHKLs) {
-      if (lambdaFilter.isAllowed(possibleHKL)) {
-        ++allowedPeakCount;
-        calculateQAndAddToOutput(possibleHKL, orientedUB, goniometerMatrix);
-      }
+      if (lambdaFilter.isAllowed(possibleHKL))
+        allowedHKLs.push_back(possibleHKL);
+    }
+    const size_t allowedPeakCount = allowedHKLs.size();
+    prog.reportIncrement(possibleHKLs.size() - allowedPeakCount);
+
+    // Search for the detectors of all the peaks at once, so that the rays can
+    // be traced in parallel
+    std::vector<V3D> qs;
+    qs.reserve(allowedPeakCount);
+    for (const auto &hkl : allowedHKLs)
+      qs.push_back(calculateQ(hkl, orientedUB));
+    const auto results = m_detectorCacheSearch->findDetectorIndices(qs);
+
+    for (size_t i = 0; i < allowedPeakCount; ++i) {
+      calculateQAndAddToOutput(allowedHKLs[i], orientedUB, goniometerMatrix,
+                               results[i]);
       prog.report();
     }
 
@@ -471,21 +483,19 @@ void PredictPeaks::setStructureFactorCalculatorFromSample(
  * @param hkl
  * @param orientedUB
  * @param goniometerMatrix
+ * @param result :: the detector found for the Q of the peak
  */
-void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl,
-                                            const DblMatrix &orientedUB,
-                                            const DblMatrix &goniometerMatrix) {
-  // The q-vector direction of the peak is = goniometer * ub * hkl_vector
-  // This is in inelastic convention: momentum transfer of the LATTICE!
-  // Also, q does have a 2pi factor = it is equal to 2pi/wavelength.
-  const auto q = orientedUB * hkl * (2.0 * M_PI * m_qConventionFactor);
+void PredictPeaks::calculateQAndAddToOutput(
+    const V3D &hkl, const DblMatrix &orientedUB,
+    const DblMatrix &goniometerMatrix,
+    const DetectorSearcher::DetectorSearchResult &result) {
+  const auto q = calculateQ(hkl, orientedUB);
   const auto params = getPeakParametersFromQ(q);
   const auto detectorDir = std::get<0>(params);
   const auto wl = std::get<1>(params);
 
   const bool useExtendedDetectorSpace =
       getProperty("PredictPeaksOutsideDetectors");
-  const auto result = m_detectorCacheSearch->findDetectorIndex(q);
   const auto hitDetector = std::get<0>(result);
   const auto index = std::get<1>(result);
 
@@ -544,6 +554,20 @@ void PredictPeaks::calculateQAndAddToOutput(const V3D &hkl,
   m_pw->addPeak(*peak);
 }
 
+/** Get the Q vector in the lab frame of a peak
+ *
+ * @param hkl :: the Miller indices of the peak
+ * @param orientedUB :: the UB matrix multiplied by the goniometer matrix
+ * @return the Q lab vector
+ */
+V3D PredictPeaks::calculateQ(const V3D &hkl,
+                             const DblMatrix &orientedUB) const {
+  // The q-vector direction of the peak is = goniometer * ub * hkl_vector
+  // This is in inelastic convention: momentum transfer of the LATTICE!
+  // Also, q does have a 2pi factor = it is equal to 2pi/wavelength.
+  return orientedUB * hkl * (2.0 * M_PI * m_qConventionFactor);
+}
+
 /** Get the detector direction and wavelength of a peak from it's QLab vector
  *
  * @param q :: the q lab vector for this peak
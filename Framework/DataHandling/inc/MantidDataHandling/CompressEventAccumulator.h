@@ -0,0 +1,93 @@
+#ifndef MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATOR_H_
+#define MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATOR_H_
+
+#include "MantidDataHandling/DllConfig.h"
+#include "MantidDataObjects/Events.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace DataHandling {
+
+/** CompressEventAccumulator : Compresses the events of one spectrum while
+  they are read, so that its memory grows with the number of distinct
+  time-of-flight bins rather than with the number of events.
+
+  Events are summed into bins one tolerance wide in time-of-flight, or of
+  identical time-of-flight if the tolerance is zero. New events are kept in a
+  buffer which is sorted and merged into the bins once it holds as many
+  events as there are bins. Each bin gives a WeightedEventNoTime with the
+  average time-of-flight of its events and the sums of their weights and
+  squared errors, as CompressEvents does for events within the tolerance of
+  each other.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAHANDLING_DLL CompressEventAccumulator {
+public:
+  explicit CompressEventAccumulator(const double tolerance);
+
+  /// Add an event, buffering it until the next merge into the bins
+  void addEvent(const double tof, const double weight = 1.0,
+                const double errorSquared = 1.0) {
+    m_buffer.push_back({tof, weight, errorSquared});
+    if (m_buffer.size() >= MinBufferSize && m_buffer.size() >= m_bins.size())
+      mergeBuffer();
+  }
+
+  bool empty() const;
+  size_t numberOfBins();
+  void moveEventsTo(std::vector<DataObjects::WeightedEventNoTime> &events);
+
+private:
+  /// An event waiting to be merged into the bins
+  struct BufferedEvent {
+    double tof;
+    double weight;
+    double errorSquared;
+  };
+  /// The sums over the events of one bin
+  struct Bin {
+    double key;
+    double tofSum;
+    double weight;
+    double errorSquared;
+    size_t count;
+  };
+
+  double binKey(const double tof) const;
+  void mergeBuffer();
+
+  /// Number of buffered events below which no merge happens
+  static const size_t MinBufferSize = 16;
+  /// Width of the bins in time-of-flight
+  double m_tolerance;
+  /// Bins holding events, sorted by key
+  std::vector<Bin> m_bins;
+  /// Events added since the last merge
+  std::vector<BufferedEvent> m_buffer;
+};
+
+} // namespace DataHandling
+} // namespace Mantid
+
+#endif /* MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATOR_H_ */
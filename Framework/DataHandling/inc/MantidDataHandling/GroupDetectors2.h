@@ -4,6 +4,7 @@
 #include "MantidAPI/Algorithm.h"
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/GroupingWorkspace.h"
+#include "MantidDataObjects/SpectrumGrouping.h"
 #include "MantidKernel/StringTokenizer.h"
 
 #include <map>
@@ -147,22 +148,23 @@ private:
     };
   };
 
-  /// used to store the lists of WORKSPACE INDICES that will be grouped, the
-  /// keys are not used
-  typedef std::map<specnum_t, std::vector<size_t>> storage_map;
-
   /// An estimate of the percentage of the algorithm runtimes that has been
   /// completed
   double m_FracCompl = 0.0;
-  /// stores lists of spectra indexes to group, although we never do an index
-  /// search on it
-  storage_map m_GroupWsInds;
+  /// the spectrum number of each group
+  std::vector<specnum_t> m_groupSpectrumNumbers;
+  /// the lists of WORKSPACE INDICES that will be grouped
+  DataObjects::SpectrumGrouping m_grouping;
 
   // Implement abstract Algorithm methods
   void init() override;
   void exec() override;
   void execEvent();
 
+  /// add a group of workspace indices after the existing ones
+  void addGroup(const specnum_t spectrumNo, const std::vector<size_t> &indices);
+  /// order the groups by spectrum number, merging groups of the same number
+  void sortGroups();
   /// read in the input parameters and see what findout what will be to grouped
   void getGroups(API::MatrixWorkspace_const_sptr workspace,
                  std::vector<int64_t> &unUsedSpec);
@@ -198,9 +200,7 @@ private:
 
   /// Estimate how much what has been read from the input file constitutes
   /// progress for the algorithm
-  double fileReadProg(
-      DataHandling::GroupDetectors2::storage_map::size_type numGroupsRead,
-      DataHandling::GroupDetectors2::storage_map::size_type numInHists);
+  double fileReadProg(size_t numGroupsRead, size_t numInHists);
 
   /// Copy the and combine the histograms that the user requested from the input
   /// into the output workspace
@@ -214,6 +214,10 @@ private:
                          DataObjects::EventWorkspace_sptr outputWS,
                          const double prog4Copy);
 
+  /// Progress reporting for moving the given number of spectra into groups
+  std::unique_ptr<API::Progress> copyProgress(const size_t numSpectra,
+                                              const double prog4Copy);
+
   /// Returns true if detectors exists and is masked
   bool isMaskedDetector(const API::SpectrumInfo &detector,
                         const size_t index) const;
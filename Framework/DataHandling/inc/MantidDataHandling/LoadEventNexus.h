@@ -159,6 +159,8 @@ public:
 
   /// Tolerance for CompressEvents; use -1 to mean don't compress.
   double compressTolerance;
+  /// Compress the events while reading them rather than after each bank
+  bool compressOnTheFly;
 
   /// Pulse times for ALL banks, taken from proton_charge log.
   boost::shared_ptr<BankPulseTimes> m_allBanksPulseTimes;
@@ -9,7 +9,11 @@
 #include <boost/shared_array.hpp>
 
 namespace Mantid {
+namespace DataObjects {
+class EventList;
+}
 namespace DataHandling {
+class CompressEventAccumulator;
 class DefaultEventLoader;
 
 /** This task does the disk IO from loading the NXS file,
@@ -47,6 +51,8 @@ public:
 
 private:
   size_t getWorkspaceIndexFromPixelID(const detid_t pixID);
+  void addCompressedEvents(CompressEventAccumulator &accumulator,
+                           DataObjects::EventList &el);
 
   /// Algorithm being run
   DefaultEventLoader &m_loader;
@@ -73,8 +73,21 @@ public:
 protected:
   /// Override process groups
   bool processGroups() override;
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+  /// Save a distributed workspace, every rank writing its own spectra
+  void execDistributed() override;
 
 private:
+  /// Optional datasets written when saving a distributed workspace
+  struct DistributedFields {
+    bool uniformSpectra{true};
+    bool xErrors{false};
+    bool pulsetimes{false};
+    bool weights{false};
+  };
+
   /// Overwrites Algorithm method.
   void init() override;
   /// Overwrites Algorithm method
@@ -87,6 +100,9 @@ private:
   static void appendEventListData(const std::vector<T> &events, size_t offset,
                                   double *tofs, float *weights,
                                   float *errorSquareds, int64_t *pulsetimes);
+  static void appendEventListData(const DataObjects::EventList &eventList,
+                                  size_t offset, double *tofs, float *weights,
+                                  float *errorSquareds, int64_t *pulsetimes);
 
   void execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
                  const bool uniformSpectra, const std::vector<int> &spec);
@@ -99,6 +115,17 @@ private:
               boost::shared_ptr<Mantid::NeXus::NexusFileIO> &nexusFile,
               const bool keepFile = false,
               boost::optional<size_t> entryNumber = boost::optional<size_t>());
+  /// save the algorithm history of the workspace
+  void saveHistory(const API::Workspace_sptr &inputWorkspace,
+                   ::NeXus::File *file);
+  void writeDistributedMetadata(const API::Workspace_sptr &inputWorkspace,
+                                const API::MatrixWorkspace_const_sptr &skeleton,
+                                const DistributedFields &fields,
+                                const std::vector<int64_t> &eventIndices);
+  void writeDistributedSlabs(const API::MatrixWorkspace &ws,
+                             const std::vector<int64_t> &globalIndices,
+                             const DistributedFields &fields,
+                             const std::vector<int64_t> &eventOffsets);
 
   /// The name and path of the input file
   std::string m_filename;
@@ -0,0 +1,86 @@
+#include "MantidDataHandling/CompressEventAccumulator.h"
+
+#include <algorithm>
+#include <cmath>
+
+using Mantid::DataObjects::WeightedEventNoTime;
+
+namespace Mantid {
+namespace DataHandling {
+
+/**
+ * @param tolerance :: width of the bins in time-of-flight, zero to only
+ * combine events with identical time-of-flight
+ */
+CompressEventAccumulator::CompressEventAccumulator(const double tolerance)
+    : m_tolerance(tolerance) {}
+
+/// @return true if no event was added since the events were last moved out
+bool CompressEventAccumulator::empty() const {
+  return m_bins.empty() && m_buffer.empty();
+}
+
+/// @return the number of bins holding events, i.e. of compressed events
+size_t CompressEventAccumulator::numberOfBins() {
+  mergeBuffer();
+  return m_bins.size();
+}
+
+/**
+ * Append one compressed event per bin, sorted by time-of-flight, and empty
+ * the accumulator.
+ * @param events :: vector to append the compressed events to
+ */
+void CompressEventAccumulator::moveEventsTo(
+    std::vector<WeightedEventNoTime> &events) {
+  mergeBuffer();
+  events.reserve(events.size() + m_bins.size());
+  for (const auto &bin : m_bins)
+    events.emplace_back(bin.tofSum / static_cast<double>(bin.count),
+                        bin.weight, bin.errorSquared);
+  std::vector<Bin>().swap(m_bins);
+  std::vector<BufferedEvent>().swap(m_buffer);
+}
+
+/// @return the key of the bin holding events of the given time-of-flight
+double CompressEventAccumulator::binKey(const double tof) const {
+  return m_tolerance > 0. ? std::floor(tof / m_tolerance) : tof;
+}
+
+/** Sort the buffered events and merge them into the bins. The keys are
+ * monotonic in time-of-flight, so both sequences are walked once.
+ */
+void CompressEventAccumulator::mergeBuffer() {
+  if (m_buffer.empty())
+    return;
+  std::sort(m_buffer.begin(), m_buffer.end(),
+            [](const BufferedEvent &lhs, const BufferedEvent &rhs) {
+              return lhs.tof < rhs.tof;
+            });
+
+  std::vector<Bin> merged;
+  merged.reserve(m_bins.size() + m_buffer.size());
+  auto bin = m_bins.cbegin();
+  for (const auto &event : m_buffer) {
+    const double key = binKey(event.tof);
+    while (bin != m_bins.cend() && bin->key < key)
+      merged.push_back(*bin++);
+    if (merged.empty() || merged.back().key != key) {
+      if (bin != m_bins.cend() && bin->key == key)
+        merged.push_back(*bin++);
+      else
+        merged.push_back({key, 0., 0., 0., 0});
+    }
+    Bin &target = merged.back();
+    target.tofSum += event.tof;
+    target.weight += event.weight;
+    target.errorSquared += event.errorSquared;
+    ++target.count;
+  }
+  merged.insert(merged.end(), bin, m_bins.cend());
+  m_bins.swap(merged);
+  m_buffer.clear();
+}
+
+} // namespace DataHandling
+} // namespace Mantid
@@ -3,10 +3,12 @@
 #include "MantidAPI/CommonBinsValidator.h"
 #include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidAPI/FileProperty.h"
+#include "MantidAPI/Progress.h"
 #include "MantidAPI/SpectraAxis.h"
 #include "MantidAPI/SpectrumInfo.h"
 #include "MantidAPI/WorkspaceFactory.h"
 #include "MantidDataHandling/LoadDetectorsGroupingFile.h"
+#include "MantidDataObjects/SpectrumGrouping.h"
 #include "MantidHistogramData/HistogramMath.h"
 #include "MantidIndexing/Group.h"
 #include "MantidIndexing/IndexInfo.h"
@@ -22,6 +24,10 @@
 #include <boost/algorithm/string/split.hpp>
 #include <boost/algorithm/string/trim.hpp>
 
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
 namespace Mantid {
 namespace DataHandling {
 // Register the algorithm into the algorithm factory
@@ -290,8 +296,8 @@ void GroupDetectors2::exec() {
 
   auto outputWS = boost::dynamic_pointer_cast<Workspace2D>(
       WorkspaceFactory::Instance().create(
-          inputWS, m_GroupWsInds.size() + numUnGrouped, inputWS->x(0).size(),
-          inputWS->blocksize()));
+          inputWS, m_grouping.numberOfGroups() + numUnGrouped,
+          inputWS->x(0).size(), inputWS->blocksize()));
   // The cast might fail if the input is a WorkspaceSingleValue. That does not
   // seem to make sense for this algorithm, so we throw.
   if (!outputWS)
@@ -365,7 +371,7 @@ void GroupDetectors2::execEvent() {
   // Make a brand new EventWorkspace
   EventWorkspace_sptr outputWS = boost::dynamic_pointer_cast<EventWorkspace>(
       WorkspaceFactory::Instance().create(
-          "EventWorkspace", m_GroupWsInds.size() + numUnGrouped,
+          "EventWorkspace", m_grouping.numberOfGroups() + numUnGrouped,
           inputWS->x(0).size(), inputWS->blocksize()));
   // Copy geometry over.
   WorkspaceFactory::Instance().initializeFromParent(*inputWS, *outputWS, true);
@@ -406,8 +412,9 @@ void GroupDetectors2::execEvent() {
 */
 void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
                                 std::vector<int64_t> &unUsedSpec) {
-  // this is the map that we are going to fill
-  m_GroupWsInds.clear();
+  // these are the groups that we are going to fill
+  m_groupSpectrumNumbers.clear();
+  m_grouping = SpectrumGrouping();
 
   // There are several properties that may contain the user data go through them
   // in order of precedence
@@ -475,6 +482,7 @@ void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
     size_t lineNum = 0;
     readFile(specs2index, commandsSS, lineNum, unUsedSpec,
              /* don't ignore group numbers */ false);
+    sortGroups();
     return;
   }
 
@@ -484,8 +492,9 @@ void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
   const std::vector<size_t> indexList = getProperty("WorkspaceIndexList");
 
   // only look at these other parameters if the file wasn't set
+  std::vector<size_t> indices0;
   if (!spectraList.empty()) {
-    m_GroupWsInds[0] = workspace->getIndicesFromSpectra(spectraList);
+    indices0 = workspace->getIndicesFromSpectra(spectraList);
     g_log.debug() << "Converted " << spectraList.size()
                   << " spectra numbers into spectra indices to be combined\n";
   } else { // go through the rest of the properties in order of decreasing
@@ -493,18 +502,17 @@ void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
     if (!detectorList.empty()) {
       // we are going to group on the basis of detector IDs, convert from
       // detectors to workspace indices
-      m_GroupWsInds[0] = workspace->getIndicesFromDetectorIDs(detectorList);
-      g_log.debug() << "Found " << m_GroupWsInds[0].size()
+      indices0 = workspace->getIndicesFromDetectorIDs(detectorList);
+      g_log.debug() << "Found " << indices0.size()
                     << " spectra indices from the list of "
                     << detectorList.size() << " detectors\n";
     } else if (!indexList.empty()) {
-      m_GroupWsInds[0] = indexList;
-      g_log.debug() << "Read in " << m_GroupWsInds[0].size()
+      indices0 = indexList;
+      g_log.debug() << "Read in " << indices0.size()
                     << " spectra indices to be combined\n";
     }
     // check we don't have an index that is too high for the workspace
     size_t maxIn = static_cast<size_t>(workspace->getNumberHistograms() - 1);
-    auto indices0 = m_GroupWsInds[0];
     auto it = indices0.begin();
     for (; it != indices0.end(); ++it) {
       if (*it > maxIn) {
@@ -517,7 +525,7 @@ void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
     }
   }
 
-  if (m_GroupWsInds[0].empty()) {
+  if (indices0.empty()) {
     g_log.information() << name() << ": File, WorkspaceIndexList, SpectraList, "
                                      "and DetectorList properties are all "
                                      "empty\n";
@@ -527,16 +535,62 @@ void GroupDetectors2::getGroups(API::MatrixWorkspace_const_sptr workspace,
 
   // up date unUsedSpec, this is used to find duplicates and when the user has
   // set KeepUngroupedSpectra
-  auto indices0 = m_GroupWsInds[0];
   auto index = indices0.begin();
   for (; index != indices0.end();
-       ++index) { // the vector<int> m_GroupWsInds[0] must not index contain
+       ++index) { // the vector<int> indices0 must not index contain
                   // numbers that don't exist in the workspaace
     if (unUsedSpec[*index] != USED) {
       unUsedSpec[*index] = USED;
     } else
       g_log.warning() << "Duplicate index, " << *index << ", found\n";
   }
+  addGroup(0, indices0);
+}
+
+/** Add a group after the existing ones
+ * @param spectrumNo :: the spectrum number of the group
+ * @param indices :: the workspace indices of the spectra in the group
+ */
+void GroupDetectors2::addGroup(const specnum_t spectrumNo,
+                               const std::vector<size_t> &indices) {
+  m_groupSpectrumNumbers.push_back(spectrumNo);
+  m_grouping.addGroup(indices);
+}
+
+/** Order the groups by spectrum number, as a map file may list them in any
+ * order. Groups with the same spectrum number are merged, keeping the order
+ * of their workspace indices.
+ */
+void GroupDetectors2::sortGroups() {
+  if (std::adjacent_find(m_groupSpectrumNumbers.cbegin(),
+                         m_groupSpectrumNumbers.cend(),
+                         std::greater_equal<specnum_t>()) ==
+      m_groupSpectrumNumbers.cend())
+    return;
+
+  std::vector<size_t> order(m_groupSpectrumNumbers.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [this](size_t a, size_t b) {
+    return m_groupSpectrumNumbers[a] < m_groupSpectrumNumbers[b];
+  });
+
+  std::vector<specnum_t> spectrumNumbers;
+  SpectrumGrouping grouping;
+  const auto &indices = m_grouping.indices();
+  for (auto group = order.cbegin(); group != order.cend();) {
+    const specnum_t spectrumNo = m_groupSpectrumNumbers[*group];
+    std::vector<size_t> merged;
+    for (; group != order.cend() &&
+           m_groupSpectrumNumbers[*group] == spectrumNo;
+         ++group)
+      merged.insert(merged.end(),
+                    indices.begin() + m_grouping.groupBegin(*group),
+                    indices.begin() + m_grouping.groupEnd(*group));
+    spectrumNumbers.push_back(spectrumNo);
+    grouping.addGroup(merged);
+  }
+  m_groupSpectrumNumbers.swap(spectrumNumbers);
+  m_grouping = std::move(grouping);
 }
 /** Read the spectra numbers in from the input file (the file format is in the
 *  source file "GroupDetectors2.h" and make an array of spectra indexes to group
@@ -594,11 +648,13 @@ void GroupDetectors2::processFile(std::string fname,
 
     bool ignoreGroupNo = getProperty("IgnoreGroupNumber");
     readFile(specs2index, File, lineNum, unUsedSpec, ignoreGroupNo);
+    sortGroups();
 
-    if (m_GroupWsInds.size() != static_cast<size_t>(totalNumberOfGroups)) {
+    if (m_grouping.numberOfGroups() !=
+        static_cast<size_t>(totalNumberOfGroups)) {
       g_log.warning() << "The input file header states there are "
                       << totalNumberOfGroups << " but the file contains "
-                      << m_GroupWsInds.size() << " groups\n";
+                      << m_grouping.numberOfGroups() << " groups\n";
     }
   }
   // add some more info to the error messages, including the line number, to
@@ -626,8 +682,9 @@ void GroupDetectors2::processFile(std::string fname,
   }
   File.close();
   g_log.debug() << "Closed file " << fname << " after reading in "
-                << m_GroupWsInds.size() << " groups\n";
-  m_FracCompl += fileReadProg(m_GroupWsInds.size(), specs2index.size());
+                << m_grouping.numberOfGroups() << " groups\n";
+  m_FracCompl +=
+      fileReadProg(m_grouping.numberOfGroups(), specs2index.size());
 }
 
 /** Get groupings from XML file
@@ -661,22 +718,13 @@ void GroupDetectors2::processXMLFile(std::string fname,
   std::map<int, std::vector<int>> mGroupSpectraMap =
       loader.getGroupSpectraMap();
 
-  // 3. Build m_GroupWsInds
-  for (const auto &det : mGroupDetectorsMap) {
-    m_GroupWsInds.emplace(det.first, std::vector<size_t>());
-  }
-
-  // 4. Detector IDs
+  // 3. Build the groups, from their detector IDs and then spectrum numbers
   for (const auto &det : mGroupDetectorsMap) {
     int groupid = det.first;
     const std::vector<detid_t> &detids = det.second;
+    std::vector<size_t> wsindexes;
 
-    auto sit = m_GroupWsInds.find(groupid);
-    if (sit == m_GroupWsInds.end())
-      continue;
-
-    std::vector<size_t> &wsindexes = sit->second;
-
+    // 4. Detector IDs
     for (auto detid : detids) {
       auto ind = detIdToWiMap.find(detid);
       if (ind != detIdToWiMap.end()) {
@@ -690,33 +738,27 @@ void GroupDetectors2::processXMLFile(std::string fname,
                       << " is not found in instrument \n";
       }
     } // for index
-  }   // for group
-
-  // 5. Spectrum Nos
-  for (const auto &pit : mGroupSpectraMap) {
-    int groupid = pit.first;
-    const std::vector<int> &spectra = pit.second;
-
-    auto sit = m_GroupWsInds.find(groupid);
-    if (sit == m_GroupWsInds.end())
-      continue;
 
-    std::vector<size_t> &wsindexes = sit->second;
-
-    for (auto specNum : spectra) {
-      auto ind = specs2index.find(specNum);
-      if (ind != specs2index.end()) {
-        size_t wsid = ind->second;
-        wsindexes.push_back(wsid);
-        if (unUsedSpec[wsid] != (USED)) {
-          unUsedSpec[wsid] = (USED);
+    // 5. Spectrum Nos
+    auto pit = mGroupSpectraMap.find(groupid);
+    if (pit != mGroupSpectraMap.end()) {
+      for (auto specNum : pit->second) {
+        auto ind = specs2index.find(specNum);
+        if (ind != specs2index.end()) {
+          size_t wsid = ind->second;
+          wsindexes.push_back(wsid);
+          if (unUsedSpec[wsid] != (USED)) {
+            unUsedSpec[wsid] = (USED);
+          }
+        } else {
+          g_log.error() << "Spectrum with ID " << specNum
+                        << " is not found in instrument \n";
         }
-      } else {
-        g_log.error() << "Spectrum with ID " << specNum
-                      << " is not found in instrument \n";
-      }
-    } // for index
-  }   // for group
+      } // for index
+    }
+
+    addGroup(groupid, wsindexes);
+  } // for group
 }
 
 /** Get groupings from groupingworkspace
@@ -762,11 +804,11 @@ void GroupDetectors2::processGroupingWorkspace(
     }
   }
 
-  // Build m_GroupWsInds (group -> list of ws indices)
+  // Build the groups (group -> list of ws indices)
   for (auto &dit : group2WSIndexSetmap) {
     size_t groupid = dit.first;
     std::set<size_t> &targetWSIndexSet = dit.second;
-    m_GroupWsInds.emplace(
+    addGroup(
         static_cast<specnum_t>(groupid),
         std::vector<size_t>(targetWSIndexSet.begin(), targetWSIndexSet.end()));
   }
@@ -817,15 +859,14 @@ void GroupDetectors2::processMatrixWorkspace(
     }
   }
 
-  // Build m_GroupWsInds (group -> list of ws indices)
+  // Build the groups (group -> list of ws indices)
   for (auto &dit : group2WSIndexSetmap) {
     size_t groupid = dit.first;
     std::set<size_t> &targetWSIndexSet = dit.second;
     if (!targetWSIndexSet.empty()) {
       std::vector<size_t> tempv;
       tempv.assign(targetWSIndexSet.begin(), targetWSIndexSet.end());
-      m_GroupWsInds.insert(
-          std::make_pair(static_cast<specnum_t>(groupid), tempv));
+      addGroup(static_cast<specnum_t>(groupid), tempv);
     }
   }
 }
@@ -917,9 +958,9 @@ void GroupDetectors2::readFile(spec2index_map &specs2index, std::istream &File,
       throw std::invalid_argument("The number of spectra is zero or negative");
     }
 
-    // the value of this map is the list of spectra numbers that will be
-    // combined into a group
-    m_GroupWsInds[spectrumNo].reserve(numberOfSpectra);
+    // the list of spectra numbers that will be combined into a group
+    std::vector<size_t> indices;
+    indices.reserve(numberOfSpectra);
     do {
       if (!File)
         throw std::invalid_argument("Premature end of file, found number of "
@@ -927,11 +968,9 @@ void GroupDetectors2::readFile(spec2index_map &specs2index, std::istream &File,
                                     "list");
       std::getline(File, thisLine), lineNum++;
       // the spectra numbers that will be included in the group
-      readSpectraIndexes(thisLine, specs2index, m_GroupWsInds[spectrumNo],
-                         unUsedSpec);
-    } while (static_cast<int>(m_GroupWsInds[spectrumNo].size()) <
-             numberOfSpectra);
-    if (static_cast<int>(m_GroupWsInds[spectrumNo].size()) !=
+      readSpectraIndexes(thisLine, specs2index, indices, unUsedSpec);
+    } while (static_cast<int>(indices.size()) < numberOfSpectra);
+    if (static_cast<int>(indices.size()) !=
         numberOfSpectra) { // it makes no sense to continue reading the file,
       // we'll stop here
       throw std::invalid_argument(std::string("Bad number of spectra "
@@ -939,9 +978,10 @@ void GroupDetectors2::readFile(spec2index_map &specs2index, std::istream &File,
                                               "near line number ") +
                                   std::to_string(lineNum));
     }
+    addGroup(spectrumNo, indices);
     // make regular progress reports and check for a cancellation notification
-    if ((m_GroupWsInds.size() % INTERVAL) == 1) {
-      fileReadProg(m_GroupWsInds.size(), specs2index.size());
+    if ((m_grouping.numberOfGroups() % INTERVAL) == 1) {
+      fileReadProg(m_grouping.numberOfGroups(), specs2index.size());
     }
   }
 }
@@ -1004,9 +1044,8 @@ void GroupDetectors2::readSpectraIndexes(std::string line,
 *  @return estimate of the amount of algorithm progress obtained by reading from
 * the file
 */
-double GroupDetectors2::fileReadProg(
-    DataHandling::GroupDetectors2::storage_map::size_type numGroupsRead,
-    DataHandling::GroupDetectors2::storage_map::size_type numInHists) {
+double GroupDetectors2::fileReadProg(size_t numGroupsRead,
+                                     size_t numInHists) {
   // I'm going to guess that there are half as many groups as spectra
   double progEstim =
       2. * static_cast<double>(numGroupsRead) / static_cast<double>(numInHists);
@@ -1045,10 +1084,10 @@ size_t GroupDetectors2::formGroups(API::MatrixWorkspace_const_sptr inputWS,
     bhv = 1;
 
   API::MatrixWorkspace_sptr beh = API::WorkspaceFactory::Instance().create(
-      "Workspace2D", static_cast<int>(m_GroupWsInds.size()), 1, 1);
+      "Workspace2D", static_cast<int>(m_grouping.numberOfGroups()), 1, 1);
 
   g_log.debug() << name() << ": Preparing to group spectra into "
-                << m_GroupWsInds.size() << " groups\n";
+                << m_grouping.numberOfGroups() << " groups\n";
 
   // where we are copying spectra to, we start copying to the start of the
   // output workspace
@@ -1060,42 +1099,30 @@ size_t GroupDetectors2::formGroups(API::MatrixWorkspace_const_sptr inputWS,
 
   auto spectrumGroups = std::vector<std::vector<size_t>>();
   auto spectrumNumbers = std::vector<Indexing::SpectrumNumber>();
+  const auto &indices = m_grouping.indices();
 
-  for (storage_map::const_iterator it = m_GroupWsInds.begin();
-       it != m_GroupWsInds.end(); ++it) {
+  for (; outIndex < m_grouping.numberOfGroups(); ++outIndex) {
     // This is the grouped spectrum
     auto &outSpec = outputWS->getSpectrum(outIndex);
+    const auto groupBegin = indices.begin() + m_grouping.groupBegin(outIndex);
+    const auto groupEnd = indices.begin() + m_grouping.groupEnd(outIndex);
 
-    // The spectrum number of the group is the key
-    spectrumNumbers.push_back(it->first);
+    spectrumNumbers.push_back(m_groupSpectrumNumbers[outIndex]);
     // Start fresh with no detector IDs
     outSpec.clearDetectorIDs();
 
     // Copy over X data from first spectrum, the bin boundaries for all spectra
     // are assumed to be the same here
     outSpec.setSharedX(inputWS->sharedX(0));
-    auto outputHistogram = outSpec.histogram();
 
     // Keep track of number of detectors required for masking
     size_t nonMaskedSpectra(0);
-    auto spectrumGroup = std::vector<size_t>();
-
-    for (auto originalWI : it->second) {
-      // detectors to add to firstSpecNum
-      const auto &inputSpectrum = inputWS->getSpectrum(originalWI);
-
-      outputHistogram += inputSpectrum.histogram();
-      outSpec.addDetectorIDs(inputSpectrum.getDetectorIDs());
-
-      if (!isMaskedDetector(spectrumInfo, originalWI))
+    for (auto originalWI = groupBegin; originalWI != groupEnd; ++originalWI) {
+      if (!isMaskedDetector(spectrumInfo, *originalWI))
         ++nonMaskedSpectra;
-
-      spectrumGroup.push_back(originalWI);
     }
 
-    spectrumGroups.push_back(spectrumGroup);
-
-    outSpec.setHistogram(outputHistogram);
+    spectrumGroups.emplace_back(groupBegin, groupEnd);
 
     if (nonMaskedSpectra == 0)
       ++nonMaskedSpectra; // Avoid possible divide by zero
@@ -1103,18 +1130,17 @@ size_t GroupDetectors2::formGroups(API::MatrixWorkspace_const_sptr inputWS,
       requireDivide = (nonMaskedSpectra > 1);
     beh->mutableY(outIndex)[0] = static_cast<double>(nonMaskedSpectra);
 
-    // make regular progress reports and check for cancelling the algorithm
-    if (outIndex % INTERVAL == 0) {
-      m_FracCompl += INTERVAL * prog4Copy;
-      if (m_FracCompl > 1.0)
-        m_FracCompl = 1.0;
-      progress(m_FracCompl);
+    // check for cancelling the algorithm
+    if (outIndex % INTERVAL == 0)
       interruption_point();
-    }
-
-    outIndex++;
   }
 
+  // The histograms of all groups are summed in parallel, a single large group
+  // being split between threads
+  auto sumProgress = copyProgress(indices.size(), prog4Copy);
+  m_grouping.sumHistograms(*inputWS, *outputWS, sumProgress.get());
+  interruption_point();
+
   // Add the ungrouped spectra to IndexInfo, if they are being kept
   if (keepAll) {
     for (const auto originalWI : unGroupedSet) {
@@ -1171,10 +1197,10 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
     bhv = 1;
 
   API::MatrixWorkspace_sptr beh = API::WorkspaceFactory::Instance().create(
-      "Workspace2D", static_cast<int>(m_GroupWsInds.size()), 1, 1);
+      "Workspace2D", static_cast<int>(m_grouping.numberOfGroups()), 1, 1);
 
   g_log.debug() << name() << ": Preparing to group spectra into "
-                << m_GroupWsInds.size() << " groups\n";
+                << m_grouping.numberOfGroups() << " groups\n";
 
   // where we are copying spectra to, we start copying to the start of the
   // output workspace
@@ -1183,30 +1209,24 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
   // would be waste as it would be just dividing by 1
   bool requireDivide(false);
   const auto &spectrumInfo = inputWS->spectrumInfo();
-  for (storage_map::const_iterator it = m_GroupWsInds.begin();
-       it != m_GroupWsInds.end(); ++it) {
+  const auto &indices = m_grouping.indices();
+  for (; outIndex < m_grouping.numberOfGroups(); ++outIndex) {
     // This is the grouped spectrum
     EventList &outEL = outputWS->getSpectrum(outIndex);
 
-    // The spectrum number of the group is the key
-    outEL.setSpectrumNo(it->first);
+    outEL.setSpectrumNo(m_groupSpectrumNumbers[outIndex]);
     // Start fresh with no detector IDs
     outEL.clearDetectorIDs();
 
-    // the Y values and errors from spectra being grouped are combined in the
-    // output spectrum
+    // the events and detector IDs of the spectra being grouped are appended
+    // to the output spectrum below
     // Keep track of number of detectors required for masking
     size_t nonMaskedSpectra(0);
     beh->mutableX(outIndex)[0] = 0.0;
     beh->mutableE(outIndex)[0] = 0.0;
-    for (auto originalWI : it->second) {
-      const EventList &fromEL = inputWS->getSpectrum(originalWI);
-      // Add the event lists with the operator
-      outEL += fromEL;
-
-      // detectors to add to the output spectrum
-      outEL.addDetectorIDs(fromEL.getDetectorIDs());
-      if (!isMaskedDetector(spectrumInfo, originalWI)) {
+    for (size_t i = m_grouping.groupBegin(outIndex);
+         i < m_grouping.groupEnd(outIndex); ++i) {
+      if (!isMaskedDetector(spectrumInfo, indices[i])) {
         ++nonMaskedSpectra;
       }
     }
@@ -1216,17 +1236,17 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
       requireDivide = (nonMaskedSpectra > 1);
     beh->mutableY(outIndex)[0] = static_cast<double>(nonMaskedSpectra);
 
-    // make regular progress reports and check for cancelling the algorithm
-    if (outIndex % INTERVAL == 0) {
-      m_FracCompl += INTERVAL * prog4Copy;
-      if (m_FracCompl > 1.0)
-        m_FracCompl = 1.0;
-      progress(m_FracCompl);
+    // check for cancelling the algorithm
+    if (outIndex % INTERVAL == 0)
       interruption_point();
-    }
-    outIndex++;
   }
 
+  // The event lists of all groups are concatenated in parallel, a single large
+  // group being split between threads
+  auto copyEventsProgress = copyProgress(indices.size(), prog4Copy);
+  m_grouping.concatenateEvents(*inputWS, *outputWS, copyEventsProgress.get());
+  interruption_point();
+
   if (bhv == 1 && requireDivide) {
     g_log.debug() << "Running Divide algorithm to perform averaging.\n";
     Mantid::API::IAlgorithm_sptr divide = createChildAlgorithm("Divide");
@@ -1242,6 +1262,24 @@ GroupDetectors2::formGroupsEvent(DataObjects::EventWorkspace_const_sptr inputWS,
   return outIndex;
 }
 
+/**
+*  Progress reporting for moving spectra into groups, advancing m_FracCompl
+* past it
+*  @param numSpectra :: the number of spectra that will be moved
+*  @param prog4Copy :: the amount of algorithm progress to attribute to moving a
+* single spectra
+*  @return the progress reporting, null if there is no progress left to report
+*/
+std::unique_ptr<Progress> GroupDetectors2::copyProgress(const size_t numSpectra,
+                                                       const double prog4Copy) {
+  const double start = m_FracCompl;
+  m_FracCompl = std::min(
+      1.0, m_FracCompl + static_cast<double>(numSpectra) * prog4Copy);
+  if (m_FracCompl <= start)
+    return nullptr;
+  return Kernel::make_unique<Progress>(this, start, m_FracCompl, numSpectra);
+}
+
 bool GroupDetectors2::isMaskedDetector(const API::SpectrumInfo &spectrum,
                                        const size_t index) const {
   if (spectrum.hasDetectors(index)) {
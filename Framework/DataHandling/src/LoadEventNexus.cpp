@@ -78,9 +78,9 @@ void copyLogs(const Mantid::DataHandling::EventWorkspaceCollection_sptr &from,
 LoadEventNexus::LoadEventNexus()
     : filter_tof_min(0), filter_tof_max(0), m_specMin(0), m_specMax(0),
       longest_tof(0), shortest_tof(0), bad_tofs(0), discarded_events(0),
-      compressTolerance(0), m_instrument_loaded_correctly(false),
-      loadlogs(false), m_logs_loaded_correctly(false), event_id_is_spec(false) {
-}
+      compressTolerance(0), compressOnTheFly(false),
+      m_instrument_loaded_correctly(false), loadlogs(false),
+      m_logs_loaded_correctly(false), event_id_is_spec(false) {}
 
 //----------------------------------------------------------------------------------------------
 /**
@@ -186,6 +186,17 @@ void LoadEventNexus::init() {
                   "negative to not do). "
                   "This specified the tolerance to use (in microseconds) when "
                   "compressing.");
+  declareProperty(
+      make_unique<PropertyWithValue<bool>>("CompressOnTheFly", false,
+                                           Direction::Input),
+      "Compress the events of each spectrum into bins of CompressTolerance "
+      "while they are read, rather than once all the events of a bank are "
+      "loaded (optional, default False). This keeps the memory used "
+      "proportional to the number of bins instead of the number of events, "
+      "but the events are not grouped exactly as CompressEvents does.");
+  setPropertySettings("CompressOnTheFly",
+                      make_unique<VisibleWhenProperty>("CompressTolerance",
+                                                       IS_NOT_DEFAULT));
 
   auto mustBePositive = boost::make_shared<BoundedValidator<int>>();
   mustBePositive->setLower(1);
@@ -204,6 +215,7 @@ void LoadEventNexus::init() {
   std::string grp3 = "Reduce Memory Use";
   setPropertyGroup("Precount", grp3);
   setPropertyGroup("CompressTolerance", grp3);
+  setPropertyGroup("CompressOnTheFly", grp3);
   setPropertyGroup("ChunkNumber", grp3);
   setPropertyGroup("TotalChunks", grp3);
 
@@ -384,6 +396,7 @@ void LoadEventNexus::exec() {
   m_filename = getPropertyValue("Filename");
 
   compressTolerance = getProperty("CompressTolerance");
+  compressOnTheFly = getProperty("CompressOnTheFly");
 
   loadlogs = getProperty("LoadLogs");
 
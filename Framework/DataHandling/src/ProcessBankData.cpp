@@ -1,3 +1,4 @@
+#include "MantidDataHandling/CompressEventAccumulator.h"
 #include "MantidDataHandling/DefaultEventLoader.h"
 #include "MantidDataHandling/LoadEventNexus.h"
 #include "MantidDataHandling/ProcessBankData.h"
@@ -44,7 +45,11 @@ void ProcessBankData::run() { // override {
   // ---- Pre-counting events per pixel ID ----
   auto &outputWS = m_loader.m_ws;
   auto *alg = m_loader.alg;
-  if (m_loader.precount) {
+  // Compressing on the fly keeps the events out of the event lists until the
+  // end, so there is nothing to pre-allocate.
+  const bool compressOnTheFly =
+      alg->compressTolerance >= 0 && alg->compressOnTheFly;
+  if (m_loader.precount && !compressOnTheFly) {
 
     std::vector<size_t> counts(m_max_id - m_min_id + 1, 0);
     for (size_t i = 0; i < numEvents; i++) {
@@ -108,6 +113,15 @@ void ProcessBankData::run() { // override {
   if (compress)
     usedDetIds.assign(m_max_id - m_min_id + 1, false);
 
+  // The compressed events of each period and detector ID
+  std::vector<std::vector<CompressEventAccumulator>> accumulators;
+  if (compressOnTheFly)
+    accumulators.assign(
+        outputWS.nPeriods(),
+        std::vector<CompressEventAccumulator>(
+            m_max_id - m_min_id + 1,
+            CompressEventAccumulator(alg->compressTolerance)));
+
   // Go through all events in the list
   for (std::size_t i = 0; i < numEvents; i++) {
     //------ Find the pulse time for this event index ---------
@@ -159,7 +173,10 @@ void ProcessBankData::run() { // override {
           double errorSq = weight * weight;
           auto *eventVector = m_loader.weightedEventVectors[periodIndex][detId];
           // NULL eventVector indicates a bad spectrum lookup
-          if (eventVector) {
+          if (eventVector && compressOnTheFly) {
+            accumulators[periodIndex][detId - m_min_id].addEvent(tof, weight,
+                                                                 errorSq);
+          } else if (eventVector) {
             eventVector->emplace_back(tof, pulsetime, weight, errorSq);
           } else {
             ++my_discarded_events;
@@ -168,7 +185,9 @@ void ProcessBankData::run() { // override {
           // We have cached the vector of events for this detector ID
           auto *eventVector = m_loader.eventVectors[periodIndex][detId];
           // NULL eventVector indicates a bad spectrum lookup
-          if (eventVector) {
+          if (eventVector && compressOnTheFly) {
+            accumulators[periodIndex][detId - m_min_id].addEvent(tof);
+          } else if (eventVector) {
             eventVector->emplace_back(tof, pulsetime);
           } else {
             ++my_discarded_events;
@@ -204,6 +223,12 @@ void ProcessBankData::run() { // override {
       if (usedDetIds[pixID - m_min_id]) {
         // Find the the workspace index corresponding to that pixel ID
         size_t wi = getWorkspaceIndexFromPixelID(pixID);
+        if (compressOnTheFly) {
+          for (size_t period = 0; period < accumulators.size(); period++)
+            addCompressedEvents(accumulators[period][pixID - m_min_id],
+                                outputWS.getSpectrum(wi, period));
+          continue;
+        }
         auto &el = outputWS.getSpectrum(wi);
         if (compress)
           el.compressEvents(alg->compressTolerance, &el);
@@ -243,6 +268,27 @@ void ProcessBankData::run() { // override {
 #endif
 } // END-OF-RUN()
 
+/**
+ * Move the events compressed on the fly for a detector into its event list.
+ * If another detector of the same spectrum already filled the list, the list
+ * is compressed again.
+ *
+ * @param accumulator :: The compressed events of the detector
+ * @param el :: The event list of the detector's spectrum
+ */
+void ProcessBankData::addCompressedEvents(
+    CompressEventAccumulator &accumulator, DataObjects::EventList &el) {
+  if (accumulator.empty())
+    return;
+  const bool alreadyFilled = el.getNumberEvents() > 0;
+  el.switchTo(API::WEIGHTED_NOTIME);
+  accumulator.moveEventsTo(el.getWeightedEventsNoTime());
+  if (alreadyFilled)
+    el.compressEvents(m_loader.alg->compressTolerance, &el);
+  else
+    el.setSortOrder(DataObjects::TOF_SORT);
+}
+
 /**
  * Get the workspace index for a given pixel ID. Throws if the pixel ID is
  * not in the expected range.
@@ -1,6 +1,7 @@
 // SaveNexusProcessed
 // @author Ronald Fowler, based on SaveNexus
 #include "MantidDataHandling/SaveNexusProcessed.h"
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/EnabledWhenWorkspaceIsType.h"
 #include "MantidAPI/FileProperty.h"
 #include "MantidAPI/IMDEventWorkspace.h"
@@ -10,14 +11,23 @@
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/OffsetsWorkspace.h"
 #include "MantidDataObjects/PeaksWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Crystal/AngleUnits.h"
+#include "MantidIndexing/GlobalSpectrumIndex.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/BoundedValidator.h"
 #include "MantidNexus/NexusFileIO.h"
+#include "MantidParallel/Communicator.h"
+#include "MantidTypes/SpectrumDefinition.h"
 #include <Poco/File.h>
 #include <boost/regex.hpp>
 #include <boost/shared_ptr.hpp>
 
+#include <algorithm>
+#include <numeric>
+
 using namespace Mantid::API;
 
 namespace Mantid {
@@ -33,6 +43,278 @@ typedef NeXus::NexusFileIO::optional_size_t optional_size_t;
 // Register the algorithm into the algorithm factory
 DECLARE_ALGORITHM(SaveNexusProcessed)
 
+namespace {
+/// Name of the entry written when saving a distributed workspace
+const std::string DISTRIBUTED_ENTRY = "mantid_workspace_1";
+/// Maximum chunk size of compressed event datasets in a distributed save
+const int64_t DISTRIBUTED_EVENT_CHUNK = 1 << 16;
+
+/// The spectra of one rank, as needed by rank 0 to write the file structure
+struct SpectraLayout {
+  std::vector<int64_t> globalIndices;
+  std::vector<int32_t> spectrumNumbers;
+  /// Number of (detector index, time index) pairs for every spectrum
+  std::vector<int64_t> definitionSizes;
+  /// Flattened (detector index, time index) pairs of all spectra
+  std::vector<int64_t> definitions;
+  std::vector<int64_t> eventCounts;
+  /// Flattened (global index, bin index) pairs of all masked bins
+  std::vector<int64_t> maskedBins;
+  std::vector<double> maskWeights;
+  /// X values of the first spectrum
+  std::vector<double> x;
+  bool commonBoundaries{true};
+  int64_t numberOfBins{0};
+  bool xErrors{false};
+  bool pulsetimes{true};
+  bool weights{false};
+};
+
+std::vector<int64_t> localGlobalIndices(const Indexing::IndexInfo &indexInfo) {
+  std::vector<int64_t> globalIndices;
+  globalIndices.reserve(indexInfo.size());
+  for (size_t i = 0; i < indexInfo.globalSize(); ++i)
+    if (indexInfo.isOnThisPartition(Indexing::GlobalSpectrumIndex(i)))
+      globalIndices.push_back(static_cast<int64_t>(i));
+  return globalIndices;
+}
+
+SpectraLayout makeLayout(const MatrixWorkspace &ws,
+                         const std::vector<int64_t> &globalIndices,
+                         const EventWorkspace *eventWorkspace) {
+  SpectraLayout layout;
+  layout.globalIndices = globalIndices;
+  const auto &indexInfo = ws.indexInfo();
+  const auto &definitions = indexInfo.spectrumDefinitions();
+  for (size_t i = 0; i < ws.getNumberHistograms(); ++i) {
+    layout.spectrumNumbers.push_back(
+        static_cast<int32_t>(indexInfo.spectrumNumber(i)));
+    const auto size = definitions ? (*definitions)[i].size() : 0;
+    layout.definitionSizes.push_back(static_cast<int64_t>(size));
+    for (size_t j = 0; j < size; ++j) {
+      layout.definitions.push_back((*definitions)[i][j].first);
+      layout.definitions.push_back((*definitions)[i][j].second);
+    }
+    if (eventWorkspace)
+      layout.eventCounts.push_back(
+          eventWorkspace->getSpectrum(i).getNumberEvents());
+    if (ws.hasMaskedBins(i)) {
+      for (const auto &mask : ws.maskedBins(i)) {
+        layout.maskedBins.push_back(globalIndices[i]);
+        layout.maskedBins.push_back(static_cast<int64_t>(mask.first));
+        layout.maskWeights.push_back(mask.second);
+      }
+    }
+  }
+  if (ws.getNumberHistograms() > 0) {
+    layout.x = ws.x(0).rawData();
+    layout.commonBoundaries = WorkspaceHelpers::commonBoundaries(ws);
+    layout.numberOfBins = static_cast<int64_t>(ws.y(0).size());
+    layout.xErrors = ws.hasDx(0);
+  }
+  if (eventWorkspace) {
+    const auto type = eventWorkspace->getEventType();
+    layout.pulsetimes = type != WEIGHTED_NOTIME;
+    layout.weights = type != TOF;
+  }
+  return layout;
+}
+
+void sendLayout(const Parallel::Communicator &comm,
+                const SpectraLayout &layout) {
+  const int tag = 0;
+  comm.send(0, tag, layout.globalIndices);
+  comm.send(0, tag, layout.spectrumNumbers);
+  comm.send(0, tag, layout.definitionSizes);
+  comm.send(0, tag, layout.definitions);
+  comm.send(0, tag, layout.eventCounts);
+  comm.send(0, tag, layout.maskedBins);
+  comm.send(0, tag, layout.maskWeights);
+  comm.send(0, tag, layout.x);
+  const std::vector<int64_t> flags{layout.commonBoundaries,
+                                   layout.numberOfBins, layout.xErrors,
+                                   layout.pulsetimes, layout.weights};
+  comm.send(0, tag, flags);
+}
+
+SpectraLayout receiveLayout(const Parallel::Communicator &comm,
+                            const int source) {
+  const int tag = 0;
+  SpectraLayout layout;
+  comm.recv(source, tag, layout.globalIndices);
+  comm.recv(source, tag, layout.spectrumNumbers);
+  comm.recv(source, tag, layout.definitionSizes);
+  comm.recv(source, tag, layout.definitions);
+  comm.recv(source, tag, layout.eventCounts);
+  comm.recv(source, tag, layout.maskedBins);
+  comm.recv(source, tag, layout.maskWeights);
+  comm.recv(source, tag, layout.x);
+  std::vector<int64_t> flags;
+  comm.recv(source, tag, flags);
+  layout.commonBoundaries = flags[0] != 0;
+  layout.numberOfBins = flags[1];
+  layout.xErrors = flags[2] != 0;
+  layout.pulsetimes = flags[3] != 0;
+  layout.weights = flags[4] != 0;
+  return layout;
+}
+
+/** Create a workspace with all spectra of the distributed workspace and the
+ * metadata of the local workspace on rank 0. Its data is zero, the file
+ * structure is written from it and the data is filled in by the ranks later.
+ * @param ws :: The local workspace on rank 0, must not be empty
+ * @param layouts :: The spectra of all ranks
+ * @return The workspace
+ */
+MatrixWorkspace_sptr makeSkeleton(const MatrixWorkspace &ws,
+                                  const std::vector<SpectraLayout> &layouts) {
+  const size_t globalSize = ws.indexInfo().globalSize();
+  std::vector<Indexing::SpectrumNumber> spectrumNumbers(globalSize);
+  std::vector<SpectrumDefinition> definitions(globalSize);
+  for (const auto &layout : layouts) {
+    auto definition = layout.definitions.cbegin();
+    for (size_t i = 0; i < layout.globalIndices.size(); ++i) {
+      const auto globalIndex = static_cast<size_t>(layout.globalIndices[i]);
+      spectrumNumbers[globalIndex] = layout.spectrumNumbers[i];
+      for (int64_t j = 0; j < layout.definitionSizes[i]; ++j) {
+        definitions[globalIndex].add(static_cast<size_t>(*definition),
+                                     static_cast<size_t>(*(definition + 1)));
+        definition += 2;
+      }
+    }
+  }
+  // All spectra are held on this rank. The storage mode must match that of
+  // the parent workspace, so a serial communicator is used.
+  Indexing::IndexInfo indexInfo(std::move(spectrumNumbers),
+                                Parallel::StorageMode::Distributed,
+                                Parallel::Communicator());
+  indexInfo.setSpectrumDefinitions(std::move(definitions));
+
+  auto histogram = ws.histogram(0);
+  histogram.mutableY() = 0.0;
+  histogram.mutableE() = 0.0;
+  if (ws.hasDx(0))
+    histogram.mutableDx() = 0.0;
+  MatrixWorkspace_sptr skeleton =
+      create<Workspace2D>(ws, indexInfo, histogram);
+
+  for (const auto &layout : layouts)
+    for (size_t i = 0; i < layout.maskWeights.size(); ++i)
+      skeleton->flagMasked(static_cast<size_t>(layout.maskedBins[2 * i]),
+                           static_cast<size_t>(layout.maskedBins[2 * i + 1]),
+                           layout.maskWeights[i]);
+  return skeleton;
+}
+
+/** Create the datasets of a Workspace2D, without writing any data. They are
+ * compressed in chunks of one spectrum, like those of a serial save. X errors
+ * are given per point, so all datasets have the same size.
+ */
+void makeHistogramDatasets(::NeXus::File &file, const MatrixWorkspace &ws,
+                           const bool xErrors) {
+  std::vector<int64_t> dims{static_cast<int64_t>(ws.getNumberHistograms()),
+                            static_cast<int64_t>(ws.y(0).size())};
+  std::vector<int64_t> chunk{1, dims[1]};
+  file.makeCompData("values", ::NeXus::FLOAT64, dims, ::NeXus::LZW, chunk,
+                    true);
+  file.putAttr("signal", 1);
+  file.putAttr("axes", "axis2,axis1");
+  file.putAttr("units", ws.YUnit());
+  file.putAttr("unit_label", ws.YUnitLabel());
+  file.closeData();
+  file.makeCompData("errors", ::NeXus::FLOAT64, dims, ::NeXus::LZW, chunk);
+  if (xErrors)
+    file.makeCompData("xerrors", ::NeXus::FLOAT64, dims, ::NeXus::LZW, chunk);
+}
+
+/// Create a 1D event dataset, compressed in bounded chunks if requested
+void makeEventDataset(::NeXus::File &file, const std::string &name,
+                      const ::NeXus::NXnumtype type, const int64_t size,
+                      const bool compress) {
+  std::vector<int64_t> dims{size};
+  if (compress) {
+    std::vector<int64_t> chunk{
+        std::max(std::min(size, DISTRIBUTED_EVENT_CHUNK), int64_t{1})};
+    file.makeCompData(name, type, dims, ::NeXus::LZW, chunk);
+  } else {
+    file.makeData(name, type, dims);
+  }
+}
+
+/** Write the event indices and create the event datasets without data. As in
+ * a serial save, they are compressed if CompressNexus is set. The chunks are
+ * bounded so that the ranks do not rewrite one huge compressed chunk.
+ */
+void makeEventDatasets(::NeXus::File &file, const MatrixWorkspace &ws,
+                       const std::vector<int64_t> &indices,
+                       const bool pulsetimes, const bool weights,
+                       const bool compress) {
+  makeEventDataset(file, "indices", ::NeXus::INT64,
+                   static_cast<int64_t>(indices.size()), compress);
+  file.openData("indices");
+  file.putData(indices);
+  file.putAttr("units", ws.YUnit());
+  file.putAttr("unit_label", ws.YUnitLabel());
+  file.closeData();
+  const int64_t numEvents = indices.back();
+  makeEventDataset(file, "tof", ::NeXus::FLOAT64, numEvents, compress);
+  if (pulsetimes)
+    makeEventDataset(file, "pulsetime", ::NeXus::INT64, numEvents, compress);
+  if (weights) {
+    makeEventDataset(file, "weight", ::NeXus::FLOAT32, numEvents, compress);
+    makeEventDataset(file, "error_squared", ::NeXus::FLOAT32, numEvents,
+                     compress);
+  }
+}
+
+/** Write one row of a 2D dataset for every local spectrum.
+ * @param file :: The file, with the parent group of the dataset open
+ * @param name :: The name of the dataset
+ * @param rows :: The global index, i.e., the row, of every local spectrum
+ * @param getRow :: Returns the data of the spectrum with given local index
+ */
+template <class Getter>
+void putRows(::NeXus::File &file, const std::string &name,
+             const std::vector<int64_t> &rows, Getter getRow) {
+  file.openData(name);
+  std::vector<int64_t> start{0, 0};
+  std::vector<int64_t> size{1, 0};
+  for (size_t i = 0; i < rows.size(); ++i) {
+    const std::vector<double> &row = getRow(i);
+    start[0] = rows[i];
+    size[1] = static_cast<int64_t>(row.size());
+    // putSlab does not modify the data but takes a non-const pointer
+    file.putSlab(const_cast<double *>(row.data()), start, size);
+  }
+  file.closeData();
+}
+
+/** Write the events of every local spectrum into a 1D event dataset.
+ * @param file :: The file, with the parent group of the dataset open
+ * @param name :: The name of the dataset
+ * @param data :: The local data, spectrum after spectrum
+ * @param localIndices :: Start of each spectrum in data, and the total size
+ * @param globalOffsets :: Start of each spectrum in the dataset
+ */
+template <class T>
+void putEvents(::NeXus::File &file, const std::string &name,
+               const std::vector<T> &data,
+               const std::vector<int64_t> &localIndices,
+               const std::vector<int64_t> &globalOffsets) {
+  file.openData(name);
+  std::vector<int64_t> start(1);
+  std::vector<int64_t> size(1);
+  for (size_t i = 0; i < globalOffsets.size(); ++i) {
+    start[0] = globalOffsets[i];
+    size[0] = localIndices[i + 1] - localIndices[i];
+    if (size[0] > 0)
+      file.putSlab(const_cast<T *>(data.data() + localIndices[i]), start,
+                   size);
+  }
+  file.closeData();
+}
+} // namespace
+
 /** Initialisation method.
  *
  */
@@ -279,6 +561,16 @@ void SaveNexusProcessed::doExec(
     nexusFile->writeNexusTableWorkspace(tableWorkspace, "table_workspace");
   } // finish table workspace specifics
 
+  saveHistory(inputWorkspace, cppFile);
+  nexusFile->closeGroup();
+}
+
+/** Save the algorithm history of a workspace, including this algorithm.
+ * @param inputWorkspace :: The workspace being saved
+ * @param file :: The open NeXus file
+ */
+void SaveNexusProcessed::saveHistory(const Workspace_sptr &inputWorkspace,
+                                     ::NeXus::File *file) {
   // Switch to the Cpp API for the algorithm history
   if (trackingHistory()) {
     m_history->fillAlgorithmHistory(
@@ -293,8 +585,7 @@ void SaveNexusProcessed::doExec(
     }
   }
 
-  inputWorkspace->history().saveNexus(cppFile);
-  nexusFile->closeGroup();
+  inputWorkspace->history().saveNexus(file);
 }
 
 //-----------------------------------------------------------------------------------------------
@@ -357,6 +648,34 @@ void SaveNexusProcessed::appendEventListData(const std::vector<T> &events,
   }
 }
 
+/** Append out each field of an event list to separate arrays, whatever the
+ * type of its events.
+ *
+ * @param eventList :: the event list
+ * @param offset :: where the first event goes in the array
+ * @param tofs, weights, errorSquareds, pulsetimes :: arrays to write to.
+ */
+void SaveNexusProcessed::appendEventListData(const EventList &eventList,
+                                             size_t offset, double *tofs,
+                                             float *weights,
+                                             float *errorSquareds,
+                                             int64_t *pulsetimes) {
+  switch (eventList.getEventType()) {
+  case TOF:
+    appendEventListData(eventList.getEvents(), offset, tofs, weights,
+                        errorSquareds, pulsetimes);
+    break;
+  case WEIGHTED:
+    appendEventListData(eventList.getWeightedEvents(), offset, tofs, weights,
+                        errorSquareds, pulsetimes);
+    break;
+  case WEIGHTED_NOTIME:
+    appendEventListData(eventList.getWeightedEventsNoTime(), offset, tofs,
+                        weights, errorSquareds, pulsetimes);
+    break;
+  }
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Execute the saving of event data.
  * This will make one long event list for all events contained.
@@ -434,20 +753,7 @@ void SaveNexusProcessed::execEvent(Mantid::NeXus::NexusFileIO *nexusFile,
     // It is okay to write in parallel since none should step on each other.
     size_t offset = indices[wi];
 
-    switch (el.getEventType()) {
-    case TOF:
-      appendEventListData(el.getEvents(), offset, tofs, weights, errorSquareds,
-                          pulsetimes);
-      break;
-    case WEIGHTED:
-      appendEventListData(el.getWeightedEvents(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    case WEIGHTED_NOTIME:
-      appendEventListData(el.getWeightedEventsNoTime(), offset, tofs, weights,
-                          errorSquareds, pulsetimes);
-      break;
-    }
+    appendEventListData(el, offset, tofs, weights, errorSquareds, pulsetimes);
     m_progress->reportIncrement(el.getNumberEvents(), "Copying EventList");
 
     PARALLEL_END_INTERUPT_REGION
@@ -643,5 +949,289 @@ void SaveNexusProcessed::saveSpectraMapNexus(
   file->closeGroup();
 }
 
+Parallel::ExecutionMode SaveNexusProcessed::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  if (storageModes.at("InputWorkspace") == Parallel::StorageMode::Distributed)
+    return Parallel::ExecutionMode::Distributed;
+  return SerialAlgorithm::getParallelExecutionMode(storageModes);
+}
+
+/** Save a distributed Workspace2D or EventWorkspace into a single file with
+ * the same layout as written by exec().
+ *
+ * Rank 0 collects the spectrum numbers, detector groupings, masking and event
+ * counts of all ranks and writes the file structure, experiment info and
+ * history. It creates the datasets for the data without writing to them. The
+ * ranks then take turns to open the file and write the rows (or event ranges)
+ * of their spectra, so no rank ever holds more than its own data.
+ */
+void SaveNexusProcessed::execDistributed() {
+  Workspace_sptr inputWorkspace = getProperty("InputWorkspace");
+  const auto ws =
+      boost::dynamic_pointer_cast<const MatrixWorkspace>(inputWorkspace);
+  if (!ws || (ws->id() != "Workspace2D" && ws->id() != "EventWorkspace"))
+    throw std::runtime_error("SaveNexusProcessed: Only Workspace2D and "
+                             "EventWorkspace can be saved in distributed "
+                             "mode.");
+  if (static_cast<bool>(getProperty("Append")))
+    throw std::runtime_error(
+        "SaveNexusProcessed: Append is not supported in distributed mode.");
+  if (!isDefault("WorkspaceIndexMin") || !isDefault("WorkspaceIndexMax") ||
+      !isDefault("WorkspaceIndexList"))
+    throw std::runtime_error("SaveNexusProcessed: Only complete workspaces "
+                             "can be saved in distributed mode.");
+  if (!ws->getAxis(1)->isSpectra() || ws->indexInfo().globalSize() == 0)
+    throw std::runtime_error("SaveNexusProcessed: The workspace must have "
+                             "spectra and a spectra axis to be saved in "
+                             "distributed mode.");
+  const bool preserveEvents = getProperty("PreserveEvents");
+  if (preserveEvents)
+    m_eventWorkspace = boost::dynamic_pointer_cast<const EventWorkspace>(ws);
+  m_filename = getPropertyValue("Filename");
+
+  const auto &comm = communicator();
+  const int tag = 0;
+  const auto globalIndices = localGlobalIndices(ws->indexInfo());
+  auto layout = makeLayout(*ws, globalIndices, m_eventWorkspace.get());
+
+  // Rank 0 writes the file structure. Errors are forwarded to all ranks so
+  // that no rank is left waiting.
+  std::string error;
+  DistributedFields fields;
+  std::vector<int64_t> eventOffsets;
+  if (comm.rank() == 0) {
+    std::vector<SpectraLayout> layouts;
+    layouts.push_back(std::move(layout));
+    for (int rank = 1; rank < comm.size(); ++rank)
+      layouts.push_back(receiveLayout(comm, rank));
+    std::vector<std::vector<int64_t>> offsets(comm.size());
+    try {
+      if (layouts.front().globalIndices.empty())
+        throw std::runtime_error("SaveNexusProcessed: Rank 0 must hold at "
+                                 "least one spectrum in distributed mode.");
+      fields.pulsetimes = m_eventWorkspace != nullptr;
+      for (const auto &item : layouts) {
+        if (item.globalIndices.empty())
+          continue;
+        if (item.numberOfBins != layouts.front().numberOfBins)
+          throw std::runtime_error("SaveNexusProcessed: All spectra must have "
+                                   "the same number of bins.");
+        fields.uniformSpectra = fields.uniformSpectra &&
+                                item.commonBoundaries &&
+                                item.x == layouts.front().x;
+        fields.xErrors = fields.xErrors || item.xErrors;
+        fields.pulsetimes = fields.pulsetimes && item.pulsetimes;
+        fields.weights = fields.weights || item.weights;
+      }
+      std::vector<int64_t> eventIndices;
+      if (m_eventWorkspace) {
+        std::vector<int64_t> eventCounts(ws->indexInfo().globalSize());
+        for (const auto &item : layouts)
+          for (size_t i = 0; i < item.globalIndices.size(); ++i)
+            eventCounts[item.globalIndices[i]] = item.eventCounts[i];
+        eventIndices.push_back(0);
+        std::partial_sum(eventCounts.begin(), eventCounts.end(),
+                         std::back_inserter(eventIndices));
+        for (size_t rank = 0; rank < layouts.size(); ++rank)
+          for (const auto globalIndex : layouts[rank].globalIndices)
+            offsets[rank].push_back(eventIndices[globalIndex]);
+      }
+      writeDistributedMetadata(inputWorkspace, makeSkeleton(*ws, layouts),
+                               fields, eventIndices);
+    } catch (std::exception &e) {
+      error = e.what();
+    }
+    const std::vector<int> flags{fields.uniformSpectra, fields.xErrors,
+                                 fields.pulsetimes, fields.weights};
+    for (int rank = 1; rank < comm.size(); ++rank) {
+      comm.send(rank, tag, error);
+      if (error.empty()) {
+        comm.send(rank, tag, flags);
+        comm.send(rank, tag, offsets[rank]);
+      }
+    }
+    eventOffsets = std::move(offsets[0]);
+  } else {
+    sendLayout(comm, layout);
+    comm.recv(0, tag, error);
+    if (error.empty()) {
+      std::vector<int> flags;
+      comm.recv(0, tag, flags);
+      comm.recv(0, tag, eventOffsets);
+      fields.uniformSpectra = flags[0] != 0;
+      fields.xErrors = flags[1] != 0;
+      fields.pulsetimes = flags[2] != 0;
+      fields.weights = flags[3] != 0;
+    }
+  }
+  if (!error.empty())
+    throw std::runtime_error(error);
+
+  // The ranks write their data in turn, passing on a token that carries the
+  // first error, if any. The token returns to rank 0 once all data is written.
+  const int tokenTag = 1;
+  if (comm.rank() > 0)
+    comm.recv(comm.rank() - 1, tokenTag, error);
+  if (error.empty()) {
+    try {
+      writeDistributedSlabs(*ws, globalIndices, fields, eventOffsets);
+    } catch (std::exception &e) {
+      error = e.what();
+    }
+  }
+  if (comm.size() > 1) {
+    comm.send((comm.rank() + 1) % comm.size(), tokenTag, error);
+    if (comm.rank() == 0)
+      comm.recv(comm.size() - 1, tokenTag, error);
+  }
+  if (!error.empty())
+    throw std::runtime_error(error);
+}
+
+/** Write the file structure for a distributed save on rank 0. The datasets
+ * for the data are created with their full size but left empty.
+ * @param inputWorkspace :: The local input workspace
+ * @param skeleton :: A workspace holding all spectra, with zero data
+ * @param fields :: The optional datasets to write
+ * @param eventIndices :: Start of the events of every spectrum, followed by
+ * the total number of events. Empty unless events are saved.
+ */
+void SaveNexusProcessed::writeDistributedMetadata(
+    const Workspace_sptr &inputWorkspace,
+    const MatrixWorkspace_const_sptr &skeleton, const DistributedFields &fields,
+    const std::vector<int64_t> &eventIndices) {
+  m_title = getPropertyValue("Title");
+  if (m_title.empty())
+    m_title = inputWorkspace->getTitle();
+  Poco::File file(m_filename);
+  if (file.exists())
+    file.remove();
+
+  Progress progress(this, 0.0, 0.5, 4);
+  auto nexusFile = boost::make_shared<Mantid::NeXus::NexusFileIO>();
+  nexusFile->resetProgress(&progress);
+  nexusFile->openNexusWrite(m_filename);
+  {
+    ::NeXus::File cppFile(nexusFile->fileID);
+    if (nexusFile->writeNexusProcessedHeader(m_title,
+                                             inputWorkspace->getName()) != 0)
+      throw Exception::FileError("Failed to write to file", m_filename);
+    progress.report("Writing header");
+
+    skeleton->saveExperimentInfoNexus(&cppFile);
+    progress.report("Writing sample and instrument");
+
+    std::vector<int> spec(skeleton->getNumberHistograms());
+    std::iota(spec.begin(), spec.end(), 0);
+    const std::string groupName =
+        eventIndices.empty() ? "workspace" : "event_workspace";
+    // Writes the axes and bin masking only
+    nexusFile->writeNexusProcessedData2D(skeleton, fields.uniformSpectra, spec,
+                                         groupName.c_str(), false);
+    cppFile.openGroup(groupName, "NXdata");
+    if (eventIndices.empty())
+      makeHistogramDatasets(cppFile, *skeleton, fields.xErrors);
+    else
+      makeEventDatasets(cppFile, *skeleton, eventIndices, fields.pulsetimes,
+                        fields.weights, getProperty("CompressNexus"));
+    cppFile.closeGroup();
+    progress.report("Writing data");
+
+    cppFile.openGroup("instrument", "NXinstrument");
+    saveSpectraMapNexus(*skeleton, &cppFile, spec, ::NeXus::LZW);
+    cppFile.closeGroup();
+    saveHistory(inputWorkspace, &cppFile);
+    progress.report("Writing history");
+  }
+  nexusFile->closeGroup();
+  nexusFile->closeNexusFile();
+}
+
+/** Write the data of the local spectra into the file created by
+ * writeDistributedMetadata().
+ * @param ws :: The local workspace
+ * @param globalIndices :: The global index of every local spectrum
+ * @param fields :: The optional datasets to write
+ * @param eventOffsets :: Start of the events of every local spectrum in the
+ * event datasets. Empty unless events are saved.
+ */
+void SaveNexusProcessed::writeDistributedSlabs(
+    const MatrixWorkspace &ws, const std::vector<int64_t> &globalIndices,
+    const DistributedFields &fields, const std::vector<int64_t> &eventOffsets) {
+  Progress progress(this, 0.5, 1.0, 2);
+  ::NeXus::File file(m_filename, NXACC_RDWR);
+  file.openGroup(DISTRIBUTED_ENTRY, "NXentry");
+  if (m_eventWorkspace) {
+    file.openGroup("event_workspace", "NXdata");
+    const auto nHist = static_cast<int>(ws.getNumberHistograms());
+    std::vector<int64_t> localIndices{0};
+    for (int wi = 0; wi < nHist; ++wi) {
+      const auto &el = m_eventWorkspace->getSpectrum(wi);
+      localIndices.push_back(localIndices.back() +
+                             static_cast<int64_t>(el.getNumberEvents()));
+    }
+    const auto num = static_cast<size_t>(localIndices.back());
+    std::vector<double> tofs(num);
+    std::vector<int64_t> pulsetimes(fields.pulsetimes ? num : 0);
+    std::vector<float> weights(fields.weights ? num : 0);
+    std::vector<float> errorSquareds(fields.weights ? num : 0);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int wi = 0; wi < nHist; ++wi) {
+      PARALLEL_START_INTERUPT_REGION
+      appendEventListData(
+          m_eventWorkspace->getSpectrum(wi),
+          static_cast<size_t>(localIndices[wi]), tofs.data(),
+          fields.weights ? weights.data() : nullptr,
+          fields.weights ? errorSquareds.data() : nullptr,
+          fields.pulsetimes ? pulsetimes.data() : nullptr);
+      PARALLEL_END_INTERUPT_REGION
+    }
+    PARALLEL_CHECK_INTERUPT_REGION
+    progress.report("Copying events");
+    putEvents(file, "tof", tofs, localIndices, eventOffsets);
+    if (fields.pulsetimes)
+      putEvents(file, "pulsetime", pulsetimes, localIndices, eventOffsets);
+    if (fields.weights) {
+      putEvents(file, "weight", weights, localIndices, eventOffsets);
+      putEvents(file, "error_squared", errorSquareds, localIndices,
+                eventOffsets);
+    }
+  } else {
+    file.openGroup("workspace", "NXdata");
+    putRows(file, "values", globalIndices,
+            [&ws](const size_t i) -> const std::vector<double> & {
+              return ws.y(i).rawData();
+            });
+    putRows(file, "errors", globalIndices,
+            [&ws](const size_t i) -> const std::vector<double> & {
+              return ws.e(i).rawData();
+            });
+    if (fields.xErrors) {
+      // Spectra without x errors are left at the fill value, zero
+      std::vector<size_t> withDx;
+      std::vector<int64_t> rows;
+      for (size_t i = 0; i < globalIndices.size(); ++i) {
+        if (ws.hasDx(i)) {
+          withDx.push_back(i);
+          rows.push_back(globalIndices[i]);
+        }
+      }
+      putRows(file, "xerrors", rows,
+              [&ws, &withDx](const size_t i) -> const std::vector<double> & {
+                return ws.dx(withDx[i]).rawData();
+              });
+    }
+  }
+  if (!fields.uniformSpectra)
+    putRows(file, "axis1", globalIndices,
+            [&ws](const size_t i) -> const std::vector<double> & {
+              return ws.x(i).rawData();
+            });
+  progress.report("Writing data");
+  file.closeGroup();
+  file.closeGroup();
+  file.close();
+}
+
 } // namespace DataHandling
 } // namespace Mantid
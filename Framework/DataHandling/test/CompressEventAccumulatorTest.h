@@ -0,0 +1,63 @@
+#ifndef MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATORTEST_H_
+#define MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATORTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataHandling/CompressEventAccumulator.h"
+
+using Mantid::DataHandling::CompressEventAccumulator;
+using Mantid::DataObjects::WeightedEventNoTime;
+
+class CompressEventAccumulatorTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static CompressEventAccumulatorTest *createSuite() {
+    return new CompressEventAccumulatorTest();
+  }
+  static void destroySuite(CompressEventAccumulatorTest *suite) {
+    delete suite;
+  }
+
+  void test_events_are_summed_into_bins_of_the_tolerance() {
+    CompressEventAccumulator accumulator(10.0);
+    TS_ASSERT(accumulator.empty());
+    // Unsorted and enough to be merged several times
+    for (int repeat = 0; repeat < 100; ++repeat) {
+      accumulator.addEvent(25.0);
+      accumulator.addEvent(1.0, 2.0, 3.0);
+      accumulator.addEvent(9.0);
+      accumulator.addEvent(21.0);
+    }
+    TS_ASSERT(!accumulator.empty());
+    TS_ASSERT_EQUALS(accumulator.numberOfBins(), 2);
+
+    std::vector<WeightedEventNoTime> events;
+    accumulator.moveEventsTo(events);
+    TS_ASSERT(accumulator.empty());
+    TS_ASSERT_EQUALS(events.size(), 2);
+    TS_ASSERT_DELTA(events[0].tof(), 5.0, 1e-10);
+    TS_ASSERT_DELTA(events[0].weight(), 300.0, 1e-10);
+    TS_ASSERT_DELTA(events[0].errorSquared(), 400.0, 1e-10);
+    TS_ASSERT_DELTA(events[1].tof(), 23.0, 1e-10);
+    TS_ASSERT_DELTA(events[1].weight(), 200.0, 1e-10);
+  }
+
+  void test_zero_tolerance_combines_identical_tofs_only() {
+    CompressEventAccumulator accumulator(0.0);
+    for (int i = 0; i < 50; ++i) {
+      accumulator.addEvent(static_cast<double>(i % 5));
+      accumulator.addEvent(static_cast<double>(i % 5) + 0.5);
+    }
+    std::vector<WeightedEventNoTime> events{WeightedEventNoTime(-1., 1., 1.)};
+    accumulator.moveEventsTo(events);
+    // Appended after the existing event, sorted by time-of-flight
+    TS_ASSERT_EQUALS(events.size(), 11);
+    for (size_t i = 1; i < events.size(); ++i) {
+      TS_ASSERT_DELTA(events[i].tof(), 0.5 * static_cast<double>(i - 1), 1e-10);
+      TS_ASSERT_DELTA(events[i].weight(), 10.0, 1e-10);
+    }
+  }
+};
+
+#endif /* MANTID_DATAHANDLING_COMPRESSEVENTACCUMULATORTEST_H_ */
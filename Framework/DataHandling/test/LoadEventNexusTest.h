@@ -532,6 +532,39 @@ public:
     }
   }
 
+  void test_Load_And_CompressEvents_OnTheFly() {
+    LoadEventNexus ld;
+    std::string outws_name = "cncs_compressed_on_the_fly";
+    ld.initialize();
+    ld.setPropertyValue("Filename", "CNCS_7860_event.nxs");
+    ld.setPropertyValue("OutputWorkspace", outws_name);
+    ld.setPropertyValue("CompressTolerance", "0.05");
+    ld.setProperty<bool>("CompressOnTheFly", true);
+    ld.setProperty<bool>("LoadLogs", false); // Time-saver
+    ld.execute();
+    TS_ASSERT(ld.isExecuted());
+
+    EventWorkspace_sptr WS;
+    TS_ASSERT_THROWS_NOTHING(
+        WS = AnalysisDataService::Instance().retrieveWS<EventWorkspace>(
+            outws_name));
+    TS_ASSERT(WS);
+    TS_ASSERT_EQUALS(WS->getNumberHistograms(), 51200);
+    // Fewer events, but the weights add up to the number of events
+    TS_ASSERT_LESS_THAN(WS->getNumberEvents(), 112266);
+    double totalWeight(0.);
+    for (size_t wi = 0; wi < WS->getNumberHistograms(); wi++) {
+      const auto &el = WS->getSpectrum(wi);
+      if (el.getNumberEvents() == 0)
+        continue;
+      TS_ASSERT_EQUALS(el.getEventType(), WEIGHTED_NOTIME);
+      for (const auto &event : el.getWeightedEventsNoTime())
+        totalWeight += event.weight();
+    }
+    TS_ASSERT_DELTA(totalWeight, 112266., 1e-6);
+    AnalysisDataService::Instance().remove(outws_name);
+  }
+
   void test_Monitors() {
     // Uses the workspace loaded in the last test to save a load execution
     std::string mon_outws_name = "cncs_compressed_monitors";
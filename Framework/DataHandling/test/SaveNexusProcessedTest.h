@@ -20,6 +20,10 @@
 #include "MantidDataHandling/LoadEmptyInstrument.h"
 #include "MantidDataHandling/LoadMuonNexus.h"
 #include "MantidDataHandling/LoadNexus.h"
+#include "MantidDataHandling/LoadNexusProcessed.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
+#include "MantidIndexing/IndexInfo.h"
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/Unit.h"
 #include "MantidKernel/UnitFactory.h"
@@ -38,6 +42,8 @@
 #include "MantidTestHelpers/FakeObjects.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidTestHelpers/NexusTestHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
 using namespace Mantid::API;
@@ -47,6 +53,73 @@ using namespace Mantid::DataObjects;
 using namespace Mantid::Geometry;
 using Mantid::HistogramData::HistogramDx;
 
+namespace {
+/// Save a distributed workspace and load it back on rank 0. Spectrum i holds
+/// the value i + 1, or i + 1 events with that TOF.
+void run_distributed_save(const Mantid::Parallel::Communicator &comm,
+                          const bool events) {
+  using namespace Mantid::HistogramData;
+  Mantid::Indexing::IndexInfo indexInfo(
+      7, Mantid::Parallel::StorageMode::Distributed, comm);
+  MatrixWorkspace_sptr ws;
+  if (events) {
+    auto eventWS = create<EventWorkspace>(indexInfo, BinEdges{0.0, 10.0});
+    for (size_t i = 0; i < eventWS->getNumberHistograms(); ++i) {
+      const auto value = static_cast<int32_t>(indexInfo.spectrumNumber(i));
+      for (int32_t event = 0; event < value; ++event)
+        eventWS->getSpectrum(i).addEventQuickly(
+            Mantid::Types::Event::TofEvent(value));
+    }
+    ws = std::move(eventWS);
+  } else {
+    ws = create<Workspace2D>(indexInfo,
+                             Histogram(BinEdges{0.0, 1.0, 2.0}, Counts(2),
+                                       CountStandardDeviations(2)));
+    for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+      const auto value = static_cast<int32_t>(indexInfo.spectrumNumber(i));
+      ws->mutableY(i) = value;
+      ws->mutableE(i) = 1.0;
+    }
+  }
+
+  auto alg = ParallelTestHelpers::create<SaveNexusProcessed>(comm);
+  alg->setProperty("InputWorkspace", boost::static_pointer_cast<Workspace>(ws));
+  alg->setPropertyValue("Filename", "SaveNexusProcessedTest_distributed.nxs");
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  if (comm.rank() != 0)
+    return;
+
+  const std::string filename = alg->getPropertyValue("Filename");
+  LoadNexusProcessed load;
+  load.setChild(true);
+  load.initialize();
+  load.setPropertyValue("Filename", filename);
+  load.setPropertyValue("OutputWorkspace", "loaded");
+  TS_ASSERT_THROWS_NOTHING(load.execute());
+  Workspace_sptr out = load.getProperty("OutputWorkspace");
+  auto loaded = boost::dynamic_pointer_cast<MatrixWorkspace>(out);
+  TS_ASSERT(loaded);
+  TS_ASSERT_EQUALS(loaded->getNumberHistograms(), 7);
+  for (size_t i = 0; i < loaded->getNumberHistograms(); ++i) {
+    const double value = static_cast<double>(i + 1);
+    TS_ASSERT_EQUALS(loaded->getSpectrum(i).getSpectrumNo(),
+                     static_cast<Mantid::specnum_t>(i + 1));
+    if (events) {
+      const auto &eventList =
+          boost::dynamic_pointer_cast<EventWorkspace>(loaded)->getSpectrum(i);
+      TS_ASSERT_EQUALS(eventList.getNumberEvents(), i + 1);
+      TS_ASSERT_EQUALS(eventList.getTofs(), std::vector<double>(i + 1, value));
+    } else {
+      TS_ASSERT_EQUALS(loaded->y(i).rawData(), std::vector<double>(2, value));
+      TS_ASSERT_EQUALS(loaded->e(i).rawData(), std::vector<double>(2, 1.0));
+      TS_ASSERT_EQUALS(loaded->x(i).rawData(),
+                       std::vector<double>({0.0, 1.0, 2.0}));
+    }
+  }
+  Poco::File(filename).remove();
+}
+} // namespace
+
 class SaveNexusProcessedTest : public CxxTest::TestSuite {
 public:
   // This pair of boilerplate methods prevent the suite being created statically
@@ -341,6 +414,14 @@ public:
         true /* DONT preserve events */, true /* Compress */);
   }
 
+  void test_parallel_Workspace2D() {
+    ParallelTestHelpers::runParallel(run_distributed_save, false);
+  }
+
+  void test_parallel_EventWorkspace() {
+    ParallelTestHelpers::runParallel(run_distributed_save, true);
+  }
+
   void testExecSaveLabel() {
     SaveNexusProcessed alg;
     if (!alg.isInitialized())
@@ -33,6 +33,23 @@ enum EventSortType {
   TIMEATSAMPLE_SORT
 };
 
+/// A field of the events stored in an EventList
+enum class EventField { Tof, PulseTime, Weight, ErrorSquared };
+
+/** The location in memory of one field of the events in an EventList. The
+ * field of event i is found at data + i * stride. The pulse time is stored as
+ * a 64-bit integer count of nanoseconds, tof as a double and the weight and
+ * error squared as floats.
+ */
+template <typename Byte> struct EventFieldLayout {
+  /// The field of the first event, nullptr if there are no events
+  Byte *data;
+  /// The number of events
+  size_t size;
+  /// The distance in bytes between the fields of consecutive events
+  size_t stride;
+};
+
 //==========================================================================================
 /** @class Mantid::DataObjects::EventList
 
@@ -158,6 +175,9 @@ public:
   std::vector<WeightedEventNoTime> &getWeightedEventsNoTime();
   const std::vector<WeightedEventNoTime> &getWeightedEventsNoTime() const;
 
+  EventFieldLayout<const char> fieldLayout(const EventField field) const;
+  EventFieldLayout<char> mutableFieldLayout(const EventField field);
+
   void clear(const bool removeDetIDs = true) override;
   void clearUnused();
 
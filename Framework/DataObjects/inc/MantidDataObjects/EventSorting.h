@@ -0,0 +1,208 @@
+#ifndef MANTID_DATAOBJECTS_EVENTSORTING_H_
+#define MANTID_DATAOBJECTS_EVENTSORTING_H_
+
+#include "MantidKernel/ThreadBudget.h"
+
+#include <tbb/parallel_sort.h>
+
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+/**
+EventSorting : Sorting of event vectors by integer keys, used by EventList.
+
+Event lists are often close to sorted already: data appended pulse by pulse
+is sorted by pulse time and consists of a few sorted runs in TOF. The sort
+therefore first scans the list for sorted runs and, if there are only a few,
+merges them in place. Larger unsorted lists are sorted with a least
+significant digit radix sort on the keys, shorter ones with std::sort.
+
+Very long lists are sorted with tbb::parallel_sort, e.g. for a single
+spectrum holding most of the events. Inside an OpenMP parallel region or a
+ThreadPool task they are sorted in the calling thread instead. TBB algorithms
+are not detected: in EventWorkspace::sortAll, which parallelises over spectra
+with tbb::parallel_for, the nested parallel_sort adds its tasks to the same
+TBB thread pool, so idle threads help with the longest lists without starting
+more threads. The radix sort needs a second buffer the size of the list, so
+lists above a size limit are sorted in place with std::sort instead.
+
+Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+National Laboratory & European Spallation Source
+
+This file is part of Mantid.
+
+Mantid is free software; you can redistribute it and/or modify
+it under the terms of the GNU General Public License as published by
+the Free Software Foundation; either version 3 of the License, or
+(at your option) any later version.
+
+Mantid is distributed in the hope that it will be useful,
+but WITHOUT ANY WARRANTY; without even the implied warranty of
+MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+GNU General Public License for more details.
+
+You should have received a copy of the GNU General Public License
+along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+File change history is stored at: <https://github.com/mantidproject/mantid>
+Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+namespace EventSorting {
+
+/// Lists with more sorted runs than this are not merged
+constexpr size_t MaxMergedRuns = 16;
+/// Unsorted lists shorter than this are sorted by comparison
+constexpr size_t MinRadixSortSize = 1024;
+/// Unsorted lists at least this long are sorted in parallel outside of a
+/// parallel region
+constexpr size_t MinParallelSortSize = size_t(1) << 20;
+/// Unsorted lists needing a larger radix sort buffer are sorted in place
+constexpr size_t MaxRadixSortBufferBytes = size_t(256) << 20;
+
+/// Map a double to an unsigned integer with the same ordering
+inline uint64_t orderedKey(const double value) {
+  uint64_t bits;
+  std::memcpy(&bits, &value, sizeof(bits));
+  const uint64_t signBit = uint64_t(1) << 63;
+  return (bits & signBit) ? ~bits : bits | signBit;
+}
+
+/// Map a signed integer to an unsigned integer with the same ordering
+inline uint64_t orderedKey(const int64_t value) {
+  return static_cast<uint64_t>(value) ^ (uint64_t(1) << 63);
+}
+
+/** Merge the sorted runs of a list in place if there are only a few.
+ * @param events :: the list to sort
+ * @param less :: comparison defining the order
+ * @return true if the list is now sorted, false if it has too many runs and
+ *         was left unchanged
+ */
+template <class T, class Less>
+bool mergeSortedRuns(std::vector<T> &events, Less less) {
+  std::vector<size_t> bounds{0};
+  for (size_t i = 1; i < events.size(); ++i) {
+    if (less(events[i], events[i - 1])) {
+      bounds.push_back(i);
+      if (bounds.size() > MaxMergedRuns)
+        return false;
+    }
+  }
+  bounds.push_back(events.size());
+  // Merge neighbouring runs pairwise until one is left
+  while (bounds.size() > 2) {
+    std::vector<size_t> merged{0};
+    size_t run = 0;
+    for (; run + 2 < bounds.size(); run += 2) {
+      std::inplace_merge(events.begin() + bounds[run],
+                         events.begin() + bounds[run + 1],
+                         events.begin() + bounds[run + 2], less);
+      merged.push_back(bounds[run + 2]);
+    }
+    if (run + 1 < bounds.size())
+      merged.push_back(bounds.back());
+    bounds.swap(merged);
+  }
+  return true;
+}
+
+/** Stable least significant digit radix sort with 8-bit digits. Digits that
+ * are the same for all events are skipped.
+ * @param events :: the list to sort
+ * @param key :: functor returning the uint64_t key of an event
+ */
+template <class T, class Key> void radixSort(std::vector<T> &events, Key key) {
+  constexpr size_t numDigits = sizeof(uint64_t);
+  std::array<std::array<size_t, 256>, numDigits> counts{};
+  for (const auto &event : events) {
+    const uint64_t value = key(event);
+    for (size_t digit = 0; digit < numDigits; ++digit)
+      ++counts[digit][(value >> (8 * digit)) & 0xff];
+  }
+
+  std::vector<T> buffer(events.size());
+  for (size_t digit = 0; digit < numDigits; ++digit) {
+    const size_t shift = 8 * digit;
+    auto &count = counts[digit];
+    if (count[(key(events.front()) >> shift) & 0xff] == events.size())
+      continue;
+    std::array<size_t, 256> offsets;
+    size_t offset = 0;
+    for (size_t bucket = 0; bucket < 256; ++bucket) {
+      offsets[bucket] = offset;
+      offset += count[bucket];
+    }
+    for (const auto &event : events)
+      buffer[offsets[(key(event) >> shift) & 0xff]++] = event;
+    events.swap(buffer);
+  }
+}
+
+/** Sort an unsorted list by comparison if a radix sort is not suitable: if
+ * it is short, long enough to sort in parallel, or too long for the radix
+ * sort buffer.
+ * @param events :: the list to sort
+ * @param less :: comparison defining the order
+ * @return true if the list was sorted, false if a radix sort should be used
+ */
+template <class T, class Less>
+bool comparisonSort(std::vector<T> &events, Less less) {
+  if (events.size() >= MinParallelSortSize &&
+      !Kernel::ThreadBudget::inParallelRegion()) {
+    tbb::parallel_sort(events.begin(), events.end(), less);
+    return true;
+  }
+  if (events.size() < MinRadixSortSize ||
+      events.size() > MaxRadixSortBufferBytes / sizeof(T)) {
+    std::sort(events.begin(), events.end(), less);
+    return true;
+  }
+  return false;
+}
+
+/** Sort a list by a key, using the sorted runs already present if possible.
+ * @param events :: the list to sort
+ * @param key :: functor returning the uint64_t key of an event, e.g. built
+ *        with orderedKey()
+ */
+template <class T, class Key> void sortByKey(std::vector<T> &events, Key key) {
+  const auto less = [&key](const T &a, const T &b) { return key(a) < key(b); };
+  if (events.size() < 2 || mergeSortedRuns(events, less) ||
+      comparisonSort(events, less))
+    return;
+  radixSort(events, key);
+}
+
+/** Sort a list by a primary key and events with equal primary keys by a
+ * secondary key, using the sorted runs already present if possible.
+ * @param events :: the list to sort
+ * @param primary :: functor returning the primary uint64_t key of an event
+ * @param secondary :: functor returning the secondary uint64_t key
+ */
+template <class T, class Primary, class Secondary>
+void sortByKeys(std::vector<T> &events, Primary primary, Secondary secondary) {
+  const auto less = [&primary, &secondary](const T &a, const T &b) {
+    const auto keyA = primary(a);
+    const auto keyB = primary(b);
+    return keyA < keyB || (keyA == keyB && secondary(a) < secondary(b));
+  };
+  if (events.size() < 2 || mergeSortedRuns(events, less) ||
+      comparisonSort(events, less))
+    return;
+  // The passes are stable, so sorting by the secondary key first leaves
+  // events with equal primary keys in secondary order
+  radixSort(events, secondary);
+  radixSort(events, primary);
+}
+
+} // namespace EventSorting
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_EVENTSORTING_H_ */
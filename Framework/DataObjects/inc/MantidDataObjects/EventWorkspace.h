@@ -4,6 +4,7 @@
 #include "MantidAPI/IEventWorkspace.h"
 #include "MantidAPI/ISpectrum.h"
 #include "MantidDataObjects/EventList.h"
+#include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidKernel/System.h"
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <string>
@@ -14,7 +15,6 @@ class Progress;
 }
 
 namespace DataObjects {
-class EventWorkspaceMRU;
 
 /** \class EventWorkspace
 
@@ -128,8 +128,11 @@ public:
   bool isHistogramData() const override;
 
   std::size_t MRUSize() const;
+  EventWorkspaceMRU::Statistics MRUStatistics() const;
 
   void clearMRU() const override;
+  void fillMRU() const;
+  void setMRUBudget(EventWorkspaceMRU::Budget &budget);
 
   EventSortType getSortType() const;
 
@@ -2,15 +2,17 @@
 #define MANTID_DATAOBJECTS_EVENTWORKSPACEMRU_H_
 
 #include "MantidKernel/System.h"
-#include "MantidKernel/Exception.h"
 #include "MantidKernel/cow_ptr.h"
-#include "MantidKernel/MRUList.h"
+#include "MantidHistogramData/HistogramX.h"
 #include "MantidHistogramData/HistogramY.h"
 #include "MantidHistogramData/HistogramE.h"
 
-#include "Poco/RWLock.h"
-
+#include <array>
+#include <atomic>
 #include <cstdint>
+#include <list>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 
 namespace Mantid {
@@ -20,38 +22,23 @@ class EventList;
 
 //============================================================================
 //============================================================================
-/**
- * This little class holds data and an index marker that is used for uniqueness.
- * This is used in the MRUList.
- */
-template <class T> class TypeWithMarker {
-public:
-  /**
-   * Constructor.
-   * @param the_index :: unique index into the workspace of this data
-   */
-  TypeWithMarker(const uintptr_t the_index) : m_index(the_index) {}
-  TypeWithMarker(const TypeWithMarker &other) = delete;
-  TypeWithMarker &operator=(const TypeWithMarker &other) = delete;
-
-public:
-  /// Unique index value.
-  uintptr_t m_index;
-
-  /// Pointer to a vector of data
-  T m_data;
+/** This is a cache of the histograms generated from the event lists of an
+  EventWorkspace.
 
-  /// Function returns a unique index, used for hashing for MRU list
-  uintptr_t hashIndexFunction() const { return m_index; }
+  The cache is split into shards, the shard of an event list being chosen by
+  its address, so that threads reading different spectra rarely wait for one
+  another: each shard has its own lock, held only to look up or insert one
+  entry.
 
-  /// Set the unique index value.
-  void setIndex(const uintptr_t the_index) { m_index = the_index; }
-};
+  The caches of all workspaces share one memory budget, given in MB by the
+  EventWorkspace.HistogramCacheMB configuration key. When it is exceeded, the
+  least recently used entries of any of the caches are evicted, so a cache
+  holds no memory once its histograms are no longer read.
 
-//============================================================================
-//============================================================================
-/** This is a container for the MRU (most-recently-used) list
- * of generated histograms.
+  An entry holds the Y and E histograms of an event list together with the X
+  they were generated for, so a histogram is only found for the current X of
+  the list. Keeping X alive in the entry prevents a new X from reusing its
+  address while the entry is cached.
 
   Copyright &copy; 2011-2 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
  National Laboratory & European Spallation Source
@@ -76,43 +63,105 @@ public:
 */
 class DLLExport EventWorkspaceMRU {
 public:
+  using XType = Kernel::cow_ptr<HistogramData::HistogramX>;
   using YType = Kernel::cow_ptr<HistogramData::HistogramY>;
   using EType = Kernel::cow_ptr<HistogramData::HistogramE>;
-  using YWithMarker = TypeWithMarker<YType>;
-  using EWithMarker = TypeWithMarker<EType>;
-  // Typedef for a Most-Recently-Used list of Data objects.
-  using mru_listY = Kernel::MRUList<YWithMarker>;
-  using mru_listE = Kernel::MRUList<EWithMarker>;
 
+  /// Counters describing the use of the cache since it was created
+  struct Statistics {
+    /// Number of histograms found in the cache
+    size_t hits;
+    /// Number of histograms not found, which had to be generated
+    size_t misses;
+    /// Number of histograms removed to stay within the memory budget
+    size_t evictions;
+    /// Memory used by the cached histograms, in bytes
+    size_t memoryUsed;
+  };
+
+  /// Memory budget used when none is configured, in MB
+  static const size_t DefaultMemoryBudgetMB = 256;
+
+  /// Memory shared by the caches of several workspaces
+  class DLLExport Budget {
+  public:
+    explicit Budget(const size_t bytes);
+    /// @return the memory the cached histograms may use, in bytes
+    size_t bytes() const { return m_bytes; }
+    /// @return the memory used by the cached histograms, in bytes
+    size_t used() const { return m_used; }
+    /// @return the memory left in use by an eviction, in bytes
+    size_t evictionTarget() const { return m_bytes - m_bytes / 16; }
+
+    static Budget &global();
+
+  private:
+    friend class EventWorkspaceMRU;
+    const size_t m_bytes;
+    std::atomic<size_t> m_used{0};
+    /// Counts the uses of entries, to find the least recently used
+    std::atomic<uint64_t> m_clock{0};
+    /// Guards m_caches and is held while evicting
+    std::mutex m_mutex;
+    std::vector<EventWorkspaceMRU *> m_caches;
+  };
+
+  EventWorkspaceMRU();
+  explicit EventWorkspaceMRU(Budget &budget);
   ~EventWorkspaceMRU();
-
-  void ensureEnoughBuffersY(size_t thread_num) const;
-  void ensureEnoughBuffersE(size_t thread_num) const;
+  EventWorkspaceMRU(const EventWorkspaceMRU &) = delete;
+  EventWorkspaceMRU &operator=(const EventWorkspaceMRU &) = delete;
 
   void clear();
 
-  YType findY(size_t thread_num, const EventList *index);
-  EType findE(size_t thread_num, const EventList *index);
-  void insertY(size_t thread_num, YType data, const EventList *index);
-  void insertE(size_t thread_num, EType data, const EventList *index);
+  YType findY(const EventList *index, const XType &x);
+  EType findE(const EventList *index, const XType &x);
+  void insert(const EventList *index, XType x, YType y, EType e);
 
   void deleteIndex(const EventList *index);
 
-  /** Return how many entries in the Y MRU list are used.
-   * Only used in tests. It only returns the 0-th MRU list size.
-   * @return :: number of entries in the MRU list. */
   size_t MRUSize() const;
-
-protected:
-  /// The most-recently-used list of dataY histograms
-  mutable std::vector<mru_listY *> m_bufferedDataY;
-
-  /// The most-recently-used list of dataE histograms
-  mutable std::vector<mru_listE *> m_bufferedDataE;
-
-  /// Mutex when adding entries in the MRU list
-  mutable Poco::RWLock m_changeMruListsMutexE;
-  mutable Poco::RWLock m_changeMruListsMutexY;
+  size_t memoryUsed() const;
+  size_t memoryBudget() const;
+  size_t memoryAvailable() const;
+  Statistics statistics() const;
+
+  static size_t entryMemory(const size_t numberOfBins);
+
+private:
+  /// The histograms generated from one event list
+  struct Entry {
+    const EventList *index;
+    XType x;
+    YType y;
+    EType e;
+    size_t memory;
+    /// Value of the budget clock when the entry was last used
+    uint64_t lastUse;
+  };
+  /// A part of the cache with its own lock
+  struct Shard {
+    mutable std::mutex mutex;
+    /// Entries, the most recently used first
+    std::list<Entry> entries;
+    /// Position of the entry of each event list in entries
+    std::unordered_map<const EventList *, std::list<Entry>::iterator> lookup;
+    size_t memoryUsed = 0;
+  };
+
+  /// Number of shards, a power of two
+  static const size_t NumberOfShards = 64;
+
+  Shard &shardOf(const EventList *index);
+  const Entry *find(Shard &shard, const EventList *index, const XType &x);
+  void erase(Shard &shard, std::list<Entry>::iterator entry);
+  void evictLeastRecentlyUsed();
+
+  Budget &m_budget;
+  std::array<Shard, NumberOfShards> m_shards;
+  std::atomic<size_t> m_hits{0};
+  std::atomic<size_t> m_misses{0};
+  std::atomic<size_t> m_evictions{0};
 };
 
 } // namespace DataObjects
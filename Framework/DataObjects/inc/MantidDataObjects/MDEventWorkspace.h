@@ -137,6 +137,8 @@ public:
 
   void splitAllIfNeeded(Kernel::ThreadScheduler *ts) override;
 
+  void splitAllInParallel(const int numThreads = -1);
+
   void splitTrackedBoxes(Kernel::ThreadScheduler *ts);
 
   void splitBox() override;
@@ -163,6 +165,9 @@ public:
 
   size_t addEvents(const std::vector<MDE> &events);
 
+  size_t addEventsInParallel(const std::vector<MDE> &events,
+                             const int numThreads = -1);
+
   std::vector<Mantid::Geometry::MDDimensionExtents<coord_t>>
   getMinimumExtents(size_t depth = 2) const override;
 
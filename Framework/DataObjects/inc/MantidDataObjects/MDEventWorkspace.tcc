@@ -592,6 +592,26 @@ TMDE(size_t MDEventWorkspace)::addEvents(const std::vector<MDE> &events) {
   return data->addEvents(events);
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add a vector of MDEvents to the workspace using several threads, without
+ * locking the boxes (see MDGridBox::addEventsInParallel). No other thread may
+ * add events to the workspace at the same time.
+ *
+ * @param events :: const ref. to a vector of events; they will be copied into
+ *        the MDBox'es contained within.
+ * @param numThreads :: the most threads to use; negative for as many as the
+ *        ThreadBudget allows, and 0 to add the events serially
+ * @return the number of events that were added
+ */
+TMDE(size_t MDEventWorkspace)::addEventsInParallel(
+    const std::vector<MDE> &events, const int numThreads) {
+  MDGridBox<MDE, nd> *gridBox = dynamic_cast<MDGridBox<MDE, nd> *>(data);
+  if (gridBox)
+    return gridBox->addEventsInParallel(events, numThreads);
+  data->addEventsUnsafe(events);
+  return events.size();
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Split the contained MDBox into a MDGridBox or MDSplitBox, if it is not
  * that already.
@@ -623,6 +643,22 @@ TMDE(void MDEventWorkspace)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
   data->splitAllIfNeeded(ts);
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Goes through all the sub-boxes and splits them if they contain
+ * enough events to be worth it, splitting the trees below the top-level
+ * boxes in parallel (see MDGridBox::splitAllInParallel).
+ *
+ * @param numThreads :: the most threads to use; negative for as many as the
+ *        ThreadBudget allows, and 0 to split serially
+ */
+TMDE(void MDEventWorkspace)::splitAllInParallel(const int numThreads) {
+  MDGridBox<MDE, nd> *gridBox = dynamic_cast<MDGridBox<MDE, nd> *>(data);
+  if (gridBox)
+    gridBox->splitAllInParallel(numThreads);
+  else
+    data->splitAllIfNeeded(nullptr);
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Goes through the MDBoxes that were tracked by the BoxController
  * as being too large, and splits them.
@@ -129,6 +129,8 @@ public:
   //----------------------------------------------------------------------------------------------------------------------
   size_t addEvent(const MDE &event) override;
   size_t addEventUnsafe(const MDE &event) override;
+  size_t addEventsInParallel(const std::vector<MDE> &events,
+                             const int numThreads = -1);
 
   /*--------------->  EVENTS from event data
    * <-------------------------------------------------------------*/
@@ -168,6 +170,7 @@ public:
   void splitContents(size_t index, Kernel::ThreadScheduler *ts = nullptr);
 
   void splitAllIfNeeded(Kernel::ThreadScheduler *ts = nullptr) override;
+  void splitAllInParallel(const int numThreads = -1);
 
   void refreshCache(Kernel::ThreadScheduler *ts = nullptr) override;
 
@@ -1,7 +1,9 @@
 #include "MantidKernel/Task.h"
 #include "MantidKernel/Utils.h"
 #include "MantidKernel/FunctionTask.h"
+#include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/Timer.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadPool.h"
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
@@ -11,6 +13,7 @@
 #include "MantidDataObjects/MDGridBox.h"
 #include <boost/math/special_functions/round.hpp>
 #include <boost/optional.hpp>
+#include <numeric>
 #include <ostream>
 #include "MantidKernel/Strings.h"
 
@@ -750,6 +753,87 @@ TMDE(void MDGridBox)::splitAllIfNeeded(Kernel::ThreadScheduler *ts) {
   }
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Goes through all the sub-boxes and splits them if they contain enough
+ * events to be worth it, like splitAllIfNeeded(). The sub-boxes are shared
+ * out between OpenMP threads and each thread splits the whole tree below a
+ * sub-box serially, so no tasks are scheduled and no two threads work on the
+ * same part of the tree. A sub-box holding more than a thread's share of the
+ * events is instead split by all the threads, one level further down.
+ *
+ * @param numThreads :: the most threads to use; negative for as many as the
+ *        ThreadBudget allows, and 0 to split serially
+ */
+TMDE(void MDGridBox)::splitAllInParallel(const int numThreads) {
+  int teamSize = Kernel::ThreadBudget::teamSize(numThreads != 0);
+  if (numThreads > 0)
+    teamSize = std::min(teamSize, numThreads);
+  if (teamSize < 2) {
+    splitAllIfNeeded(nullptr);
+    return;
+  }
+
+  // The events in memory below each sub-box. The cached nPoints of a grid
+  // box are out of date while events are being added.
+  const auto numChildren = static_cast<int64_t>(numBoxes);
+  std::vector<size_t> load(numBoxes);
+  PRAGMA_OMP(parallel for num_threads(teamSize))
+  for (int64_t i = 0; i < numChildren; ++i)
+    load[i] = m_Children[i]->getDataInMemorySize();
+  const size_t totalLoad = std::accumulate(load.cbegin(), load.cend(),
+                                           static_cast<size_t>(0));
+  if (totalLoad < this->m_BoxController->getAddingEvents_eventsPerTask()) {
+    splitAllIfNeeded(nullptr);
+    return;
+  }
+
+  // Split the heavily loaded sub-boxes with the whole team first
+  std::vector<size_t> light;
+  for (size_t index = 0; index < numBoxes; ++index) {
+    if (load[index] <= totalLoad / static_cast<size_t>(teamSize)) {
+      light.push_back(index);
+      continue;
+    }
+    MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(m_Children[index]);
+    if (box) {
+      if (!this->m_BoxController->willSplit(box->getNPoints(),
+                                            box->getDepth())) {
+        light.push_back(index);
+        continue;
+      }
+      this->m_BoxController->trackNumBoxes(box->getDepth());
+      m_Children[index] = new MDGridBox<MDE, nd>(box);
+      delete box;
+    }
+    MDGridBox<MDE, nd> *gridBox =
+        dynamic_cast<MDGridBox<MDE, nd> *>(m_Children[index]);
+    if (gridBox)
+      gridBox->splitAllInParallel(numThreads);
+  }
+
+  const auto numLight = static_cast<int64_t>(light.size());
+  PRAGMA_OMP(parallel for schedule(dynamic) num_threads(teamSize))
+  for (int64_t i = 0; i < numLight; ++i) {
+    const size_t index = light[i];
+    MDBox<MDE, nd> *box = dynamic_cast<MDBox<MDE, nd> *>(m_Children[index]);
+    if (box) {
+      if (this->m_BoxController->willSplit(box->getNPoints(),
+                                           box->getDepth())) {
+        splitContents(index, nullptr);
+      } else {
+        Kernel::ISaveable *const pSaver(box->getISaveable());
+        if (pSaver && box->getDataInMemorySize() > 0)
+          this->m_BoxController->getFileIO()->toWrite(pSaver);
+      }
+    } else {
+      MDGridBox<MDE, nd> *gridBox =
+          dynamic_cast<MDGridBox<MDE, nd> *>(m_Children[index]);
+      if (gridBox)
+        gridBox->splitAllIfNeeded(nullptr);
+    }
+  }
+}
+
 //-----------------------------------------------------------------------------------------------
 /** Perform centerpoint binning of events, with bins defined
  * in axes perpendicular to the axes of the workspace.
@@ -1683,6 +1767,100 @@ TMDE(inline size_t MDGridBox)::addEventUnsafe(const MDE &event) {
     return 0;
 }
 
+//-----------------------------------------------------------------------------------------------
+/** Add a vector of events to the grid box using several threads. The events
+ * are first bucketed by the child box they fall in, with a counting sort that
+ * keeps their order. The buckets are then shared out between OpenMP threads,
+ * and each thread adds its buckets with addEventUnsafe(), as no other thread
+ * writes to the same child boxes. No locks are taken. A child grid box that
+ * gets more than a thread's share of the events has them added by all the
+ * threads, one level further down.
+ *
+ * Warning! No bounds checking is done, as for addEvent().
+ *
+ * Warning! No other thread may add events to this box (or any child boxes)
+ * during the call.
+ *
+ * Note! nPoints, signal and error must be re-calculated using refreshCache()
+ * after all events have been added.
+ *
+ * @param events :: the events to add
+ * @param numThreads :: the most threads to use; negative for as many as the
+ *        ThreadBudget allows, and 0 to add the events serially
+ * @return the number of events that were added
+ * */
+TMDE(size_t MDGridBox)::addEventsInParallel(const std::vector<MDE> &events,
+                                            const int numThreads) {
+  const auto numEvents = static_cast<int64_t>(events.size());
+  // Not worth the bucketing for fewer events than a task would add
+  const bool parallel =
+      numThreads != 0 &&
+      events.size() > this->m_BoxController->getAddingEvents_eventsPerTask();
+  int teamSize = Kernel::ThreadBudget::teamSize(parallel);
+  if (numThreads > 0)
+    teamSize = std::min(teamSize, numThreads);
+  if (teamSize < 2) {
+    size_t numAdded = 0;
+    for (const auto &event : events)
+      numAdded += addEventUnsafe(event);
+    return numAdded;
+  }
+
+  // Child box of each event, or numBoxes if it lies outside all of them
+  std::vector<size_t> childIndices(events.size());
+  PRAGMA_OMP(parallel for num_threads(teamSize))
+  for (int64_t i = 0; i < numEvents; ++i) {
+    size_t cindex = calculateChildIndex(events[i]);
+    // Events on the upper boundary of the last child box go into that box
+    if (cindex == numBoxes)
+      cindex = numBoxes - 1;
+    else if (cindex > numBoxes)
+      cindex = numBoxes;
+    childIndices[i] = cindex;
+  }
+
+  // The events of child box i are order[bucketStart[i]:bucketStart[i + 1]]
+  std::vector<size_t> bucketStart(numBoxes + 2, 0);
+  for (const auto cindex : childIndices)
+    ++bucketStart[cindex + 1];
+  std::vector<size_t> occupied;
+  std::vector<size_t> heavy;
+  for (size_t i = 0; i < numBoxes; ++i) {
+    const size_t bucketSize = bucketStart[i + 1];
+    if (bucketSize > events.size() / static_cast<size_t>(teamSize) &&
+        dynamic_cast<MDGridBox<MDE, nd> *>(m_Children[i]))
+      heavy.push_back(i);
+    else if (bucketSize > 0)
+      occupied.push_back(i);
+    bucketStart[i + 1] += bucketStart[i];
+  }
+  std::vector<size_t> order(events.size());
+  std::vector<size_t> next(bucketStart.cbegin(), bucketStart.cend() - 1);
+  for (size_t i = 0; i < events.size(); ++i)
+    order[next[childIndices[i]]++] = i;
+
+  size_t numAdded = 0;
+  for (const auto cindex : heavy) {
+    std::vector<MDE> childEvents;
+    childEvents.reserve(bucketStart[cindex + 1] - bucketStart[cindex]);
+    for (size_t j = bucketStart[cindex]; j < bucketStart[cindex + 1]; ++j)
+      childEvents.push_back(events[order[j]]);
+    auto gridBox = static_cast<MDGridBox<MDE, nd> *>(m_Children[cindex]);
+    numAdded += gridBox->addEventsInParallel(childEvents, numThreads);
+  }
+
+  const auto numOccupied = static_cast<int64_t>(occupied.size());
+  PRAGMA_OMP(parallel for schedule(dynamic) reduction(+ : numAdded)
+                 num_threads(teamSize))
+  for (int64_t i = 0; i < numOccupied; ++i) {
+    const size_t cindex = occupied[i];
+    MDBoxBase<MDE, nd> *child = m_Children[cindex];
+    for (size_t j = bucketStart[cindex]; j < bucketStart[cindex + 1]; ++j)
+      numAdded += child->addEventUnsafe(events[order[j]]);
+  }
+  return numAdded;
+}
+
 /**Sets particular child MDgridBox at the index, specified by the input
 *parameters
 *@param index     -- the position of the new child in the list of GridBox
@@ -0,0 +1,96 @@
+#ifndef MANTID_DATAOBJECTS_MDHISTOEXPRESSION_H_
+#define MANTID_DATAOBJECTS_MDHISTOEXPRESSION_H_
+
+#include "MantidGeometry/MDGeometry/MDTypes.h"
+#include "MantidKernel/System.h"
+
+#include <boost/shared_ptr.hpp>
+
+namespace Mantid {
+namespace DataObjects {
+
+class MDHistoWorkspace;
+
+/** MDHistoExpression : An element-wise expression of MDHistoWorkspaces and
+  scalars with errors, such as (a - b) / c, evaluated in a single pass.
+
+  Building an expression only records the operations and references to the
+  workspaces, which must outlive it. evaluateInto() then computes the
+  signal, squared error and number of events of the result block by block,
+  with the blocks spread over threads. Intermediate results only take up a
+  block of memory per thread rather than a full workspace each.
+
+  The operations propagate errors and numbers of events like the in-place
+  operations of MDHistoWorkspace, which are implemented with expressions.
+  Boolean operations treat masked bins as false, and the mask of a result is
+  that of its left-most workspace. The target workspace may appear in the
+  expression.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport MDHistoExpression {
+public:
+  /// An operation or operand, defined in the implementation
+  class Node;
+
+  MDHistoExpression(const MDHistoWorkspace &workspace);
+  MDHistoExpression(const signal_t signal, const signal_t error = 0.0);
+  explicit MDHistoExpression(boost::shared_ptr<const Node> node);
+
+  MDHistoExpression log(const double filler = 0.0) const;
+  MDHistoExpression log10(const double filler = 0.0) const;
+  MDHistoExpression exp() const;
+  MDHistoExpression power(const double exponent) const;
+
+  MDHistoExpression lessThan(const MDHistoExpression &rhs) const;
+  MDHistoExpression greaterThan(const MDHistoExpression &rhs) const;
+  MDHistoExpression equalTo(const MDHistoExpression &rhs,
+                            const signal_t tolerance = 1e-5) const;
+  MDHistoExpression operator!() const;
+
+  size_t size() const;
+  const boost::shared_ptr<const Node> &node() const;
+  void evaluateInto(MDHistoWorkspace &out) const;
+
+private:
+  boost::shared_ptr<const Node> m_node;
+};
+
+DLLExport MDHistoExpression operator+(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator-(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator*(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator/(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator&(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator|(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+DLLExport MDHistoExpression operator^(const MDHistoExpression &lhs,
+                                      const MDHistoExpression &rhs);
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_MDHISTOEXPRESSION_H_ */
@@ -421,6 +421,9 @@ public:
   bool isMDHistoWorkspace() const override { return true; }
 
 private:
+  /// Expressions write the results of the operations above directly
+  friend class MDHistoExpression;
+
   MDHistoWorkspace *doClone() const override {
     return new MDHistoWorkspace(*this);
   }
@@ -0,0 +1,119 @@
+#ifndef MANTID_DATAOBJECTS_SPECTRUMGROUPING_H_
+#define MANTID_DATAOBJECTS_SPECTRUMGROUPING_H_
+
+#include "MantidDataObjects/DllConfig.h"
+#include "MantidDataObjects/EventList.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace API {
+class MatrixWorkspace;
+class Progress;
+}
+namespace HistogramData {
+class Histogram;
+}
+namespace DataObjects {
+class EventWorkspace;
+
+/** SpectrumGrouping : The workspace indices of the input spectra summed into
+  each output spectrum of a grouping. The groups are stored once as a
+  compressed sparse row matrix: the indices of all groups one after the other
+  and the offset of the first index of each group.
+
+  The summation is split into chunks of at most MaxChunkSize indices, so that
+  a single large group is spread over as many threads as many small groups. A
+  group spanning several chunks is summed into one partial result per chunk
+  and the partial results are joined afterwards in chunk order, so no
+  critical section is needed and the result does not depend on the number of
+  threads. Group i is written to workspace index i of the output.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_DATAOBJECTS_DLL SpectrumGrouping {
+public:
+  /// The positions [begin, end) in indices() of some members of a group
+  struct Chunk {
+    size_t group;
+    size_t begin;
+    size_t end;
+  };
+
+  /// Largest number of input spectra summed by one task
+  static const size_t MaxChunkSize = 200;
+
+  SpectrumGrouping() = default;
+  explicit SpectrumGrouping(const std::vector<std::vector<size_t>> &groups);
+
+  void addGroup(const std::vector<size_t> &indices);
+
+  /// @return the number of groups
+  size_t numberOfGroups() const { return m_offsets.size() - 1; }
+  /// @return the workspace indices of all groups, one group after the other
+  const std::vector<size_t> &indices() const { return m_indices; }
+  /// @return the position in indices() of the first index of a group
+  size_t groupBegin(const size_t group) const { return m_offsets[group]; }
+  /// @return the position in indices() after the last index of a group
+  size_t groupEnd(const size_t group) const { return m_offsets[group + 1]; }
+  /// @return the number of workspace indices in a group
+  size_t groupSize(const size_t group) const {
+    return groupEnd(group) - groupBegin(group);
+  }
+
+  std::vector<Chunk> chunks(const size_t maxChunkSize = MaxChunkSize) const;
+  bool isWholeGroup(const Chunk &chunk) const;
+
+  void addHistograms(const Chunk &chunk, const API::MatrixWorkspace &input,
+                     HistogramData::Histogram &output) const;
+  void addEvents(const Chunk &chunk, const EventWorkspace &input,
+                 EventList &output) const;
+  void addDetectorIDs(const Chunk &chunk, const API::MatrixWorkspace &input,
+                      API::ISpectrum &output) const;
+
+  void sumHistograms(const API::MatrixWorkspace &input,
+                     API::MatrixWorkspace &output,
+                     API::Progress *progress = nullptr) const;
+  void concatenateEvents(const EventWorkspace &input, EventWorkspace &output,
+                         API::Progress *progress = nullptr) const;
+  void moveEvents(EventWorkspace &input, EventWorkspace &output,
+                  API::Progress *progress = nullptr) const;
+
+  static void joinEvents(std::vector<EventList>::iterator begin,
+                         std::vector<EventList>::iterator end,
+                         EventList &output);
+
+private:
+  void concatenateEvents(const EventWorkspace &input, EventWorkspace &output,
+                         API::Progress *progress,
+                         EventWorkspace *emptiedInput) const;
+
+  /// Offset in m_indices of the first index of each group, and the end
+  std::vector<size_t> m_offsets{0};
+  /// Workspace indices of all groups
+  std::vector<size_t> m_indices;
+};
+
+} // namespace DataObjects
+} // namespace Mantid
+
+#endif /* MANTID_DATAOBJECTS_SPECTRUMGROUPING_H_ */
@@ -1,6 +1,7 @@
 #include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/Histogram1D.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidDataObjects/EventSorting.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 #include "MantidKernel/DateAndTime.h"
 #include "MantidKernel/DateAndTimeHelpers.h"
@@ -38,6 +39,37 @@ namespace {
 
 const double SEC_TO_NANO = 1.e9;
 
+/** The histograms most recently returned by reference on one thread. The
+ * histogram cache is shared by all threads and may drop a histogram at any
+ * time, so the references returned by EventList::y(), dataY() etc. stay
+ * valid until the same thread has asked for this many more histograms.
+ *
+ * The pinned histograms are not counted in the memory budget of the cache,
+ * and they outlive the workspace they came from: each thread holds up to Size
+ * Y and Size E histograms until it asks for more, or exits.
+ */
+template <class T> class RecentHistograms {
+public:
+  const T &keep(Kernel::cow_ptr<T> histogram) {
+    if (m_histograms.size() < Size) {
+      m_histograms.push_back(std::move(histogram));
+      return *m_histograms.back();
+    }
+    auto &slot = m_histograms[m_next];
+    m_next = (m_next + 1) % Size;
+    slot = std::move(histogram);
+    return *slot;
+  }
+
+private:
+  static const size_t Size = 50;
+  std::vector<Kernel::cow_ptr<T>> m_histograms;
+  size_t m_next = 0;
+};
+
+thread_local RecentHistograms<HistogramData::HistogramY> t_recentY;
+thread_local RecentHistograms<HistogramData::HistogramE> t_recentE;
+
 /**
  * Calculate the corrected full time in nanoseconds
  * @param event : The event with pulse time and time-of-flight
@@ -98,29 +130,18 @@ template <typename T> bool compareEventTof(const T &e1, const T &e2) {
   return (e1.tof() < e2.tof());
 }
 
-/** Compare two events' FRAME id, return true if e1 should be before e2.
- * @param e1 :: first event
- * @param e2 :: second event
+/** Sort key of an event's TOF, ordered like the TOF.
+ * @param event :: the event
  *  */
-bool compareEventPulseTime(const TofEvent &e1, const TofEvent &e2) {
-  return (e1.pulseTime() < e2.pulseTime());
+template <typename T> uint64_t tofKey(const T &event) {
+  return EventSorting::orderedKey(event.tof());
 }
 
-/** Compare two events' FRAME id, return true if e1 should be before e2.
- *  Assuming that if e1's pulse time is earlier than e2's, then e1 must be
- * earlier regardless TOF value
- * @param e1 :: first event
- * @param e2 :: second event
+/** Sort key of an event's pulse time, ordered like the pulse time.
+ * @param event :: the event
  *  */
-bool compareEventPulseTimeTOF(const TofEvent &e1, const TofEvent &e2) {
-
-  if (e1.pulseTime() < e2.pulseTime()) {
-    return true;
-  } else if ((e1.pulseTime() == e2.pulseTime()) && (e1.tof() < e2.tof())) {
-    return true;
-  }
-
-  return false;
+template <typename T> uint64_t pulseTimeKey(const T &event) {
+  return EventSorting::orderedKey(event.pulseTime().totalNanoseconds());
 }
 
 // comparator for pulse time with tolerance
@@ -889,6 +910,96 @@ EventList::getWeightedEventsNoTime() const {
   return this->weightedEventsNoTime;
 }
 
+/** Locate one field of the stored events in memory, allowing it to be read in
+ * place without copying the events.
+ * The layout is invalidated by any change to the number or type of events.
+ *
+ * @param field :: the field to locate
+ * @return the location of the field of the events
+ * @throws std::invalid_argument if the events do not store the field
+ * */
+EventFieldLayout<const char>
+EventList::fieldLayout(const EventField field) const {
+  auto bytes = [](const void *member) {
+    return reinterpret_cast<const char *>(member);
+  };
+  static_assert(sizeof(DateAndTime) == sizeof(int64_t),
+                "Pulse times must be stored as 64-bit integers");
+  EventFieldLayout<const char> layout{nullptr, getNumberEvents(), 0};
+  switch (eventType) {
+  case TOF:
+    if (field == EventField::Weight || field == EventField::ErrorSquared)
+      throw std::invalid_argument("EventList::fieldLayout() called for a "
+                                  "weight of events without weights.");
+    layout.stride = sizeof(TofEvent);
+    if (!events.empty()) {
+      const auto &event = events.front();
+      layout.data = field == EventField::Tof ? bytes(&event.m_tof)
+                                             : bytes(&event.m_pulsetime);
+    }
+    break;
+  case WEIGHTED:
+    layout.stride = sizeof(WeightedEvent);
+    if (!weightedEvents.empty()) {
+      const auto &event = weightedEvents.front();
+      switch (field) {
+      case EventField::Tof:
+        layout.data = bytes(&event.m_tof);
+        break;
+      case EventField::PulseTime:
+        layout.data = bytes(&event.m_pulsetime);
+        break;
+      case EventField::Weight:
+        layout.data = bytes(&event.m_weight);
+        break;
+      case EventField::ErrorSquared:
+        layout.data = bytes(&event.m_errorSquared);
+        break;
+      }
+    }
+    break;
+  case WEIGHTED_NOTIME:
+    if (field == EventField::PulseTime)
+      throw std::invalid_argument("EventList::fieldLayout() called for the "
+                                  "pulse time of events without pulse times.");
+    layout.stride = sizeof(WeightedEventNoTime);
+    if (!weightedEventsNoTime.empty()) {
+      const auto &event = weightedEventsNoTime.front();
+      switch (field) {
+      case EventField::Tof:
+        layout.data = bytes(&event.m_tof);
+        break;
+      case EventField::Weight:
+        layout.data = bytes(&event.m_weight);
+        break;
+      case EventField::ErrorSquared:
+        layout.data = bytes(&event.m_errorSquared);
+        break;
+      default:
+        break;
+      }
+    }
+    break;
+  }
+  return layout;
+}
+
+/** Locate one field of the stored events in memory, allowing it to be
+ * modified in place. The cached histogram is cleared and the events are
+ * marked as unsorted, as the values written are unknown.
+ *
+ * @param field :: the field to locate
+ * @return the location of the field of the events
+ * @throws std::invalid_argument if the events do not store the field
+ * */
+EventFieldLayout<char> EventList::mutableFieldLayout(const EventField field) {
+  const auto layout = fieldLayout(field);
+  if (mru)
+    mru->deleteIndex(this);
+  this->order = UNSORTED;
+  return {const_cast<char *>(layout.data), layout.size, layout.stride};
+}
+
 /** Clear the list of events and any
  * associated detector ID's.
  * */
@@ -1036,15 +1147,13 @@ void EventList::sortTof() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventTof<TofEvent>);
+    EventSorting::sortByKey(events, tofKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventTof<WeightedEvent>);
+    EventSorting::sortByKey(weightedEvents, tofKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
-    tbb::parallel_sort(weightedEventsNoTime.begin(), weightedEventsNoTime.end(),
-                       compareEventTof<WeightedEventNoTime>);
+    EventSorting::sortByKey(weightedEventsNoTime, tofKey<WeightedEventNoTime>);
     break;
   }
   // Save the order to avoid unnecessary re-sorting.
@@ -1109,11 +1218,10 @@ void EventList::sortPulseTime() const {
   // Perform sort.
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTime);
+    EventSorting::sortByKey(events, pulseTimeKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTime);
+    EventSorting::sortByKey(weightedEvents, pulseTimeKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1139,11 +1247,11 @@ void EventList::sortPulseTimeTOF() const {
 
   switch (eventType) {
   case TOF:
-    tbb::parallel_sort(events.begin(), events.end(), compareEventPulseTimeTOF);
+    EventSorting::sortByKeys(events, pulseTimeKey<TofEvent>, tofKey<TofEvent>);
     break;
   case WEIGHTED:
-    tbb::parallel_sort(weightedEvents.begin(), weightedEvents.end(),
-                       compareEventPulseTimeTOF);
+    EventSorting::sortByKeys(weightedEvents, pulseTimeKey<WeightedEvent>,
+                             tofKey<WeightedEvent>);
     break;
   case WEIGHTED_NOTIME:
     // Do nothing; there is no time to sort
@@ -1399,71 +1507,60 @@ const HistogramData::HistogramY &EventList::y() const {
     throw std::runtime_error(
         "'EventList::y()' called with no MRU set. This is not allowed.");
 
-  return *sharedY();
+  return t_recentY.keep(sharedY());
 }
 const HistogramData::HistogramE &EventList::e() const {
   if (!mru)
     throw std::runtime_error(
         "'EventList::e()' called with no MRU set. This is not allowed.");
 
-  return *sharedE();
+  return t_recentE.keep(sharedE());
 }
 Kernel::cow_ptr<HistogramData::HistogramY> EventList::sharedY() const {
-  // This is the thread number from which this function was called.
-  int thread = PARALLEL_THREAD_NUMBER;
+  const auto x = m_histogram.sharedX();
 
-  Kernel::cow_ptr<HistogramData::HistogramY> yData(nullptr);
-
-  // Is the data in the mrulist?
+  // Is the data in the cache?
   if (mru) {
-    mru->ensureEnoughBuffersY(thread);
-    yData = mru->findY(thread, this);
+    auto yData = mru->findY(this, x);
+    if (yData)
+      return yData;
   }
 
-  if (!yData) {
-    MantidVec Y;
-    MantidVec E;
-    this->generateHistogram(readX(), Y, E);
-
-    // Create the MRU object
-    yData = Kernel::make_cow<HistogramData::HistogramY>(std::move(Y));
+  MantidVec Y;
+  MantidVec E;
+  this->generateHistogram(x->rawData(), Y, E);
+  auto yData = Kernel::make_cow<HistogramData::HistogramY>(std::move(Y));
 
-    // Lets save it in the MRU
-    if (mru) {
-      mru->insertY(thread, yData, this);
-      auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
-      mru->ensureEnoughBuffersE(thread);
-      mru->insertE(thread, eData, this);
-    }
-  }
+  // Lets save it in the cache
+  if (mru)
+    mru->insert(this, x, yData,
+                Kernel::make_cow<HistogramData::HistogramE>(std::move(E)));
   return yData;
 }
 Kernel::cow_ptr<HistogramData::HistogramE> EventList::sharedE() const {
-  // This is the thread number from which this function was called.
-  int thread = PARALLEL_THREAD_NUMBER;
-
-  Kernel::cow_ptr<HistogramData::HistogramE> eData(nullptr);
+  const auto x = m_histogram.sharedX();
 
-  // Is the data in the mrulist?
+  // Is the data in the cache?
   if (mru) {
-    mru->ensureEnoughBuffersE(thread);
-    eData = mru->findE(thread, this);
+    auto eData = mru->findE(this, x);
+    if (eData)
+      return eData;
   }
 
-  if (!eData) {
-    // Now use that to get E -- Y values are generated from another function
-    MantidVec Y_ignored;
-    MantidVec E;
-    this->generateHistogram(readX(), Y_ignored, E);
-    eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
+  // Y is generated with E, so both are cached
+  MantidVec Y;
+  MantidVec E;
+  this->generateHistogram(x->rawData(), Y, E);
+  auto eData = Kernel::make_cow<HistogramData::HistogramE>(std::move(E));
 
-    // Lets save it in the MRU
-    if (mru)
-      mru->insertE(thread, eData, this);
-  }
+  // Lets save it in the cache
+  if (mru)
+    mru->insert(this, x,
+                Kernel::make_cow<HistogramData::HistogramY>(std::move(Y)),
+                eData);
   return eData;
 }
-/** Look in the MRU to see if the Y histogram has been generated before.
+/** Look in the cache to see if the Y histogram has been generated before.
  * If so, return that. If not, calculate, cache and return it.
  *
  * @return reference to the Y vector.
@@ -1473,12 +1570,10 @@ const MantidVec &EventList::dataY() const {
     throw std::runtime_error(
         "'EventList::dataY()' called with no MRU set. This is not allowed.");
 
-  // WARNING: The Y data of sharedY() is stored in MRU, returning reference fine
-  // as long as it stays there.
-  return sharedY()->rawData();
+  return y().rawData();
 }
 
-/** Look in the MRU to see if the E histogram has been generated before.
+/** Look in the cache to see if the E histogram has been generated before.
  * If so, return that. If not, calculate, cache and return it.
  *
  * @return reference to the E vector.
@@ -1488,9 +1583,7 @@ const MantidVec &EventList::dataE() const {
     throw std::runtime_error(
         "'EventList::dataE()' called with no MRU set. This is not allowed.");
 
-  // WARNING: The E data of sharedE() is stored in MRU, returning reference fine
-  // as long as it stays there.
-  return sharedE()->rawData();
+  return e().rawData();
 }
 
 // --------------------------------------------------------------------------
@@ -430,19 +430,61 @@ void EventWorkspace::switchEventType(const Mantid::API::EventType type) {
 /// @returns If the data is a histogram - always true for an eventWorkspace
 bool EventWorkspace::isHistogramData() const { return true; }
 
-/** Return how many entries in the Y MRU list are used.
- * Only used in tests. It only returns the 0-th MRU list size.
- * @return :: number of entries in the MRU list.
+/** Return how many event lists have their histograms in the MRU.
+ * @return :: number of entries in the MRU.
  */
 size_t EventWorkspace::MRUSize() const { return mru->MRUSize(); }
 
+/** Return the hits, misses and evictions of the MRU since it was created.
+ * @return :: the statistics of the MRU.
+ */
+EventWorkspaceMRU::Statistics EventWorkspace::MRUStatistics() const {
+  return mru->statistics();
+}
+
 /** Clears the MRU lists */
 void EventWorkspace::clearMRU() const { mru->clear(); }
 
+/** Generate the histograms of the spectra in parallel and store them in the
+ * MRU, starting from workspace index 0 while they fit in the memory the MRU
+ * may use without evicting anything. The budget is shared by all event
+ * workspaces, so the histograms cached for other workspaces are left alone.
+ * Call before reading many spectra one after the other, e.g. to display or
+ * save the workspace.
+ */
+void EventWorkspace::fillMRU() const {
+  const size_t available = mru->memoryAvailable();
+  size_t memory = 0;
+  size_t numberOfSpectra = 0;
+  while (numberOfSpectra < data.size()) {
+    memory += EventWorkspaceMRU::entryMemory(
+        data[numberOfSpectra]->histogram_size());
+    if (memory > available)
+      break;
+    ++numberOfSpectra;
+  }
+
+  const auto numberOfLists = static_cast<int64_t>(numberOfSpectra);
+  PARALLEL_FOR_IF(Kernel::threadSafe(*this))
+  for (int64_t i = 0; i < numberOfLists; ++i)
+    data[i]->sharedY();
+}
+
+/** Cache the histograms of this workspace within the given memory budget
+ * instead of the one shared by all event workspaces. The histograms cached so
+ * far are dropped. Used where a known budget is needed, e.g. in tests.
+ * @param budget :: the memory budget, which must outlive the workspace
+ */
+void EventWorkspace::setMRUBudget(EventWorkspaceMRU::Budget &budget) {
+  auto newMRU = new EventWorkspaceMRU(budget);
+  for (auto list : data)
+    list->setMRU(newMRU);
+  delete mru;
+  mru = newMRU;
+}
+
 /// Returns the amount of memory used in bytes
 size_t EventWorkspace::getMemorySize() const {
-  // TODO: Add the MRU buffer
-
   // Add the memory from all the event lists
   size_t total = std::accumulate(data.begin(), data.end(), size_t{0},
                                  [](size_t total, EventList *list) {
@@ -453,6 +495,8 @@ size_t EventWorkspace::getMemorySize() const {
 
   total += this->getMemorySizeForXAxes();
 
+  total += mru->memoryUsed();
+
   // Return in bytes
   return total;
 }
@@ -1,174 +1,287 @@
 #include "MantidDataObjects/EventWorkspaceMRU.h"
+#include "MantidKernel/ConfigService.h"
 #include "MantidKernel/System.h"
 
+#include <algorithm>
+#include <functional>
+#include <queue>
+
 namespace Mantid {
 namespace DataObjects {
 
-EventWorkspaceMRU::~EventWorkspaceMRU() {
-  // Make sure you free up the memory in the MRUs
-  {
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-        delete data;
-      }
-    }
-  }
-  Poco::ScopedWriteRWLock _lock2(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-      delete data;
-    }
-  }
+namespace {
+/// Memory counted for an entry on top of its histograms, in bytes
+const size_t EntryOverhead = 128;
+
+/// @return the memory budget set in the configuration, in bytes
+size_t configuredMemoryBudget() {
+  int megabytes = 0;
+  if (Kernel::ConfigService::Instance().getValue(
+          "EventWorkspace.HistogramCacheMB", megabytes) &&
+      megabytes >= 0)
+    return static_cast<size_t>(megabytes) << 20;
+  return EventWorkspaceMRU::DefaultMemoryBudgetMB << 20;
 }
+} // namespace
 
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for E for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+/**
+ * @param bytes :: the memory the cached histograms may use, in bytes
  */
-void EventWorkspaceMRU::ensureEnoughBuffersE(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  if (m_bufferedDataE.size() <= thread_num) {
-    m_bufferedDataE.resize(thread_num + 1, nullptr);
-    for (auto &data : m_bufferedDataE) {
-      if (!data)
-        data = new mru_listE(50); // Create a MRU list with this many entries.
-    }
-  }
+EventWorkspaceMRU::Budget::Budget(const size_t bytes) : m_bytes(bytes) {}
+
+/// @return the budget shared by the caches of all workspaces, whose size is
+/// set in the configuration
+EventWorkspaceMRU::Budget &EventWorkspaceMRU::Budget::global() {
+  // Never deleted, so that workspaces destroyed at exit can still use it
+  static Budget *budget = new Budget(configuredMemoryBudget());
+  return *budget;
 }
-//---------------------------------------------------------------------------
-/** This function makes sure that there are enough data
- * buffers (MRU's) for Y for the number of threads requested.
- * @param thread_num :: thread number that wants a MRU buffer
+
+/// Create a cache sharing the global memory budget
+EventWorkspaceMRU::EventWorkspaceMRU() : EventWorkspaceMRU(Budget::global()) {}
+
+/**
+ * @param budget :: the memory budget shared with other caches, which must
+ * outlive this one
  */
-void EventWorkspaceMRU::ensureEnoughBuffersY(size_t thread_num) const {
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-  if (m_bufferedDataY.size() <= thread_num) {
-    m_bufferedDataY.resize(thread_num + 1, nullptr);
-    for (auto &data : m_bufferedDataY) {
-      if (!data)
-        data = new mru_listY(50); // Create a MRU list with this many entries.
-    }
-  }
+EventWorkspaceMRU::EventWorkspaceMRU(Budget &budget) : m_budget(budget) {
+  std::lock_guard<std::mutex> lock(m_budget.m_mutex);
+  m_budget.m_caches.push_back(this);
 }
 
-//---------------------------------------------------------------------------
-/// Clear all the data in the MRU buffers
-void EventWorkspaceMRU::clear() {
+/// Return the memory of the cached histograms to the budget
+EventWorkspaceMRU::~EventWorkspaceMRU() {
   {
-    // Make sure you free up the memory in the MRUs
-    Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexY);
-    for (auto &data : m_bufferedDataY) {
-      if (data) {
-        data->clear();
-      }
-    }
+    std::lock_guard<std::mutex> lock(m_budget.m_mutex);
+    auto &caches = m_budget.m_caches;
+    caches.erase(std::remove(caches.begin(), caches.end(), this),
+                 caches.end());
   }
+  clear();
+}
 
-  Poco::ScopedWriteRWLock _lock(m_changeMruListsMutexE);
-  for (auto &data : m_bufferedDataE) {
-    if (data) {
-      data->clear();
-    }
+//---------------------------------------------------------------------------
+/// Clear all the data in the cache
+void EventWorkspaceMRU::clear() {
+  for (auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    m_budget.m_used -= shard.memoryUsed;
+    shard.lookup.clear();
+    shard.entries.clear();
+    shard.memoryUsed = 0;
   }
 }
 
 //---------------------------------------------------------------------------
-/** Find a Y histogram in the MRU
+/** Find a Y histogram in the cache
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: the event list the histogram was generated from
+ * @param x :: the current X of the event list
+ * @return the histogram; NULL if not found.
  */
-Kernel::cow_ptr<HistogramData::HistogramY>
-EventWorkspaceMRU::findY(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto result = m_bufferedDataY[thread_num]->find(
-      reinterpret_cast<const std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+EventWorkspaceMRU::YType EventWorkspaceMRU::findY(const EventList *index,
+                                                  const XType &x) {
+  auto &shard = shardOf(index);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (const auto entry = find(shard, index, x))
+    return entry->y;
   return YType(nullptr);
 }
 
-/** Find a Y histogram in the MRU
+/** Find an E histogram in the cache
  *
- * @param thread_num :: number of the thread in which this is run
- * @param index :: index of the data to return
- * @return pointer to the TypeWithMarker that has the data; NULL if not found.
+ * @param index :: the event list the histogram was generated from
+ * @param x :: the current X of the event list
+ * @return the histogram; NULL if not found.
  */
-Kernel::cow_ptr<HistogramData::HistogramE>
-EventWorkspaceMRU::findE(size_t thread_num, const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto result = m_bufferedDataE[thread_num]->find(
-      reinterpret_cast<const std::uintptr_t>(index));
-  if (result)
-    return result->m_data;
+EventWorkspaceMRU::EType EventWorkspaceMRU::findE(const EventList *index,
+                                                  const XType &x) {
+  auto &shard = shardOf(index);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  if (const auto entry = find(shard, index, x))
+    return entry->e;
   return EType(nullptr);
 }
 
-/** Insert a new histogram into the MRU
- *
- * @param thread_num :: thread being accessed
- * @param data :: the new data
- * @param index :: index of the data to insert
- */
-void EventWorkspaceMRU::insertY(size_t thread_num, YType data,
-                                const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexY);
-  auto yWithMarker =
-      new TypeWithMarker<YType>(reinterpret_cast<const std::uintptr_t>(index));
-  yWithMarker->m_data = std::move(data);
-  auto oldData = m_bufferedDataY[thread_num]->insert(yWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
-  delete oldData;
-}
-
-/** Insert a new histogram into the MRU
+/** Insert the histograms of an event list into the cache, replacing any
+ * previous ones. If the budget is then exceeded, the least recently used
+ * entries of all the caches sharing it are evicted. Histograms larger than a
+ * NumberOfShards-th of the budget are not cached.
  *
- * @param thread_num :: thread being accessed
- * @param data :: the new data
- * @param index :: index of the data to insert
+ * @param index :: the event list the histograms were generated from
+ * @param x :: the X the histograms were generated for
+ * @param y :: the Y histogram
+ * @param e :: the E histogram
  */
-void EventWorkspaceMRU::insertE(size_t thread_num, EType data,
-                                const EventList *index) {
-  Poco::ScopedReadRWLock _lock(m_changeMruListsMutexE);
-  auto eWithMarker =
-      new TypeWithMarker<EType>(reinterpret_cast<const std::uintptr_t>(index));
-  eWithMarker->m_data = std::move(data);
-  auto oldData = m_bufferedDataE[thread_num]->insert(eWithMarker);
-  // And clear up the memory of the old one, if it is dropping out.
-  delete oldData;
-}
-
-/** Delete any entries in the MRU at the given index
+void EventWorkspaceMRU::insert(const EventList *index, XType x, YType y,
+                               EType e) {
+  const size_t memory = entryMemory(std::max(y->size(), e->size()));
+  if (memory > m_budget.bytes() / NumberOfShards)
+    return;
+  {
+    auto &shard = shardOf(index);
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto existing = shard.lookup.find(index);
+    if (existing != shard.lookup.end())
+      erase(shard, existing->second);
+    shard.entries.push_front({index, std::move(x), std::move(y), std::move(e),
+                              memory, m_budget.m_clock++});
+    shard.lookup.emplace(index, shard.entries.begin());
+    shard.memoryUsed += memory;
+    m_budget.m_used += memory;
+  }
+  // The shard lock must not be held here: evicting takes the budget lock
+  // before the shard locks
+  if (m_budget.used() > m_budget.bytes())
+    evictLeastRecentlyUsed();
+}
+
+/** Delete any entries in the cache at the given index
  *
  * @param index :: index to delete.
  */
 void EventWorkspaceMRU::deleteIndex(const EventList *index) {
-  {
-    Poco::ScopedReadRWLock _lock1(m_changeMruListsMutexE);
-    for (auto &data : m_bufferedDataE) {
-      if (data) {
-        data->deleteIndex(reinterpret_cast<const std::uintptr_t>(index));
-      }
-    }
+  auto &shard = shardOf(index);
+  std::lock_guard<std::mutex> lock(shard.mutex);
+  const auto existing = shard.lookup.find(index);
+  if (existing != shard.lookup.end())
+    erase(shard, existing->second);
+}
+
+/// @return the number of event lists whose histograms are cached
+size_t EventWorkspaceMRU::MRUSize() const {
+  size_t size = 0;
+  for (const auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    size += shard.entries.size();
   }
-  Poco::ScopedReadRWLock _lock2(m_changeMruListsMutexY);
-  for (auto &data : m_bufferedDataY) {
-    if (data) {
-      data->deleteIndex(reinterpret_cast<const std::uintptr_t>(index));
+  return size;
+}
+
+/// @return the memory used by the histograms in this cache, in bytes
+size_t EventWorkspaceMRU::memoryUsed() const {
+  size_t used = 0;
+  for (const auto &shard : m_shards) {
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    used += shard.memoryUsed;
+  }
+  return used;
+}
+
+/// @return the memory the cached histograms of all the caches sharing the
+/// budget of this one may use, in bytes
+size_t EventWorkspaceMRU::memoryBudget() const { return m_budget.bytes(); }
+
+/// @return the memory the histograms in this cache may use without evicting
+/// any entry, in bytes: the eviction target of the budget less the memory
+/// used by the other caches sharing it
+size_t EventWorkspaceMRU::memoryAvailable() const {
+  const size_t used = m_budget.used();
+  const size_t own = memoryUsed();
+  const size_t others = used > own ? used - own : 0;
+  const size_t target = m_budget.evictionTarget();
+  return target > others ? target - others : 0;
+}
+
+/// @return the use of the cache since it was created
+EventWorkspaceMRU::Statistics EventWorkspaceMRU::statistics() const {
+  return {m_hits, m_misses, m_evictions, memoryUsed()};
+}
+
+/** @param numberOfBins :: the number of bins of the histograms of a list
+ * @return the memory counted for the cached histograms of an event list
+ */
+size_t EventWorkspaceMRU::entryMemory(const size_t numberOfBins) {
+  return EntryOverhead + 2 * sizeof(double) * numberOfBins;
+}
+
+/// @return the shard caching the histograms of an event list
+EventWorkspaceMRU::Shard &EventWorkspaceMRU::shardOf(const EventList *index) {
+  // Fibonacci hashing spreads the aligned addresses of the lists evenly
+  const auto hash = static_cast<uint64_t>(reinterpret_cast<uintptr_t>(index)) *
+                    UINT64_C(0x9E3779B97F4A7C15);
+  return m_shards[(hash >> 32) % NumberOfShards];
+}
+
+/** Find the entry of an event list in a shard whose lock is held, and mark it
+ * as the most recently used. An entry generated for another X is removed.
+ *
+ * @param shard :: the shard of the event list
+ * @param index :: the event list
+ * @param x :: the current X of the event list
+ * @return the entry; NULL if not found.
+ */
+const EventWorkspaceMRU::Entry *
+EventWorkspaceMRU::find(Shard &shard, const EventList *index, const XType &x) {
+  const auto found = shard.lookup.find(index);
+  if (found != shard.lookup.end()) {
+    const auto entry = found->second;
+    if (entry->x.get() == x.get()) {
+      entry->lastUse = m_budget.m_clock++;
+      shard.entries.splice(shard.entries.begin(), shard.entries, entry);
+      ++m_hits;
+      return &*entry;
     }
+    erase(shard, entry);
   }
+  ++m_misses;
+  return nullptr;
 }
 
-size_t EventWorkspaceMRU::MRUSize() const {
-  if (m_bufferedDataY.empty()) {
-    return 0;
-  } else {
-    return this->m_bufferedDataY.front()->size();
+/** Remove an entry from a shard whose lock is held
+ * @param shard :: the shard holding the entry
+ * @param entry :: the entry to remove
+ */
+void EventWorkspaceMRU::erase(Shard &shard, std::list<Entry>::iterator entry) {
+  shard.memoryUsed -= entry->memory;
+  m_budget.m_used -= entry->memory;
+  shard.lookup.erase(entry->index);
+  shard.entries.erase(entry);
+}
+
+/** Evict the least recently used entries of all the caches sharing the budget
+ * until they use at most 15/16 of it, leaving room for further insertions
+ * before the next eviction. The entries of a shard are ordered by their last
+ * use, so only the oldest entry of each shard is a candidate at a time.
+ */
+void EventWorkspaceMRU::evictLeastRecentlyUsed() {
+  std::lock_guard<std::mutex> budgetLock(m_budget.m_mutex);
+  const size_t target = m_budget.evictionTarget();
+  if (m_budget.used() <= target)
+    return;
+
+  struct Candidate {
+    uint64_t lastUse;
+    EventWorkspaceMRU *cache;
+    Shard *shard;
+    bool operator>(const Candidate &other) const {
+      return lastUse > other.lastUse;
+    }
+  };
+  std::priority_queue<Candidate, std::vector<Candidate>,
+                      std::greater<Candidate>> oldest;
+  for (auto cache : m_budget.m_caches) {
+    for (auto &shard : cache->m_shards) {
+      std::lock_guard<std::mutex> lock(shard.mutex);
+      if (!shard.entries.empty())
+        oldest.push({shard.entries.back().lastUse, cache, &shard});
+    }
+  }
+
+  while (m_budget.used() > target && !oldest.empty()) {
+    const auto candidate = oldest.top();
+    oldest.pop();
+    auto &shard = *candidate.shard;
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    if (shard.entries.empty())
+      continue;
+    // The shard may have changed since it was scanned
+    if (shard.entries.back().lastUse == candidate.lastUse) {
+      candidate.cache->erase(shard, std::prev(shard.entries.end()));
+      ++candidate.cache->m_evictions;
+    }
+    if (!shard.entries.empty())
+      oldest.push({shard.entries.back().lastUse, candidate.cache, &shard});
   }
 }
 
@@ -0,0 +1,524 @@
+#include "MantidDataObjects/MDHistoExpression.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <boost/make_shared.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <vector>
+
+namespace Mantid {
+namespace DataObjects {
+
+class MDHistoExpression::Node {
+public:
+  /// Values of an expression for a block of bins
+  struct Values {
+    explicit Values(const size_t size)
+        : signal(size), errorSquared(size), numEvents(size), masked(size) {}
+    std::vector<signal_t> signal;
+    std::vector<signal_t> errorSquared;
+    std::vector<signal_t> numEvents;
+    std::vector<char> masked;
+  };
+
+  virtual ~Node() = default;
+  /// @return the number of bins, or 0 for a scalar
+  virtual size_t size() const = 0;
+  /// @return the number of operations on the longest path to an operand
+  virtual size_t depth() const = 0;
+  /// @return the number of events that contributed to the result
+  virtual uint64_t eventsContributed() const = 0;
+  /** Evaluate a block of bins
+   * @param start :: index of the first bin
+   * @param count :: number of bins, at most the size of the values
+   * @param out :: values to write the result to
+   * @param scratch :: values available for operands, one per level
+   * @param level :: first entry of the scratch this node may use
+   */
+  virtual void evaluate(const size_t start, const size_t count, Values &out,
+                        std::vector<Values> &scratch,
+                        const size_t level) const = 0;
+};
+
+namespace {
+/// Number of bins evaluated together by one thread
+const size_t BlockSize = 4096;
+
+using Node = MDHistoExpression::Node;
+using Values = MDHistoExpression::Node::Values;
+
+/// The bins of a workspace
+class WorkspaceNode : public Node {
+public:
+  explicit WorkspaceNode(const MDHistoWorkspace &workspace)
+      : m_workspace(workspace) {}
+  size_t size() const override { return m_workspace.getNPoints(); }
+  size_t depth() const override { return 0; }
+  uint64_t eventsContributed() const override {
+    return m_workspace.getNEvents();
+  }
+  void evaluate(const size_t start, const size_t count, Values &out,
+                std::vector<Values> &, const size_t) const override {
+    const signal_t *signal = m_workspace.getSignalArray() + start;
+    const signal_t *errorSquared = m_workspace.getErrorSquaredArray() + start;
+    const signal_t *numEvents = m_workspace.getNumEventsArray() + start;
+    const bool *masked = m_workspace.getMaskArray() + start;
+    std::copy(signal, signal + count, out.signal.begin());
+    std::copy(errorSquared, errorSquared + count, out.errorSquared.begin());
+    std::copy(numEvents, numEvents + count, out.numEvents.begin());
+    std::copy(masked, masked + count, out.masked.begin());
+  }
+
+private:
+  const MDHistoWorkspace &m_workspace;
+};
+
+/// A value with an error, the same for all bins
+class ScalarNode : public Node {
+public:
+  ScalarNode(const signal_t signal, const signal_t error)
+      : m_signal(signal), m_errorSquared(error * error) {}
+  size_t size() const override { return 0; }
+  size_t depth() const override { return 0; }
+  uint64_t eventsContributed() const override { return 0; }
+  void evaluate(const size_t, const size_t count, Values &out,
+                std::vector<Values> &, const size_t) const override {
+    std::fill_n(out.signal.begin(), count, m_signal);
+    std::fill_n(out.errorSquared.begin(), count, m_errorSquared);
+    std::fill_n(out.numEvents.begin(), count, 0.0);
+    std::fill_n(out.masked.begin(), count, 0);
+  }
+
+private:
+  const signal_t m_signal;
+  const signal_t m_errorSquared;
+};
+
+enum class BinaryOperation {
+  Plus,
+  Minus,
+  Multiply,
+  Divide,
+  LessThan,
+  GreaterThan,
+  EqualTo,
+  And,
+  Or,
+  Xor
+};
+
+/// An operation on two expressions. The result is written over the values
+/// of the left hand side, and takes its numbers of events and mask unless
+/// the operation adds up the numbers of events or the left hand side is a
+/// scalar.
+class BinaryNode : public Node {
+public:
+  BinaryNode(const BinaryOperation operation, boost::shared_ptr<const Node> lhs,
+             boost::shared_ptr<const Node> rhs, const double parameter = 0.0)
+      : m_operation(operation), m_lhs(std::move(lhs)), m_rhs(std::move(rhs)),
+        m_parameter(parameter) {
+    const size_t lhsSize = m_lhs->size();
+    const size_t rhsSize = m_rhs->size();
+    if (lhsSize != 0 && rhsSize != 0 && lhsSize != rhsSize)
+      throw std::invalid_argument("MDHistoExpression: the workspaces in the "
+                                  "expression have different numbers of bins");
+  }
+
+  size_t size() const override {
+    return std::max(m_lhs->size(), m_rhs->size());
+  }
+
+  size_t depth() const override {
+    return 1 + std::max(m_lhs->depth(), m_rhs->depth());
+  }
+
+  uint64_t eventsContributed() const override {
+    if (isAdditive())
+      return m_lhs->eventsContributed() + m_rhs->eventsContributed();
+    return takesEventsFromRhs() ? m_rhs->eventsContributed()
+                                : m_lhs->eventsContributed();
+  }
+
+  void evaluate(const size_t start, const size_t count, Values &out,
+                std::vector<Values> &scratch,
+                const size_t level) const override {
+    // The right hand side keeps its values in this level while the left hand
+    // side is evaluated using the levels below
+    Values &rhs = scratch[level];
+    m_rhs->evaluate(start, count, rhs, scratch, level + 1);
+    m_lhs->evaluate(start, count, out, scratch, level + 1);
+    signal_t *a = out.signal.data();
+    signal_t *da2 = out.errorSquared.data();
+    signal_t *na = out.numEvents.data();
+    const char *maskA = out.masked.data();
+    const signal_t *b = rhs.signal.data();
+    const signal_t *db2 = rhs.errorSquared.data();
+    const signal_t *nb = rhs.numEvents.data();
+    const char *maskB = rhs.masked.data();
+    if (takesEventsFromRhs()) {
+      std::copy_n(rhs.numEvents.cbegin(), count, out.numEvents.begin());
+      std::copy_n(rhs.masked.cbegin(), count, out.masked.begin());
+    }
+
+    switch (m_operation) {
+    case BinaryOperation::Plus:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] += b[i];
+        da2[i] += db2[i];
+        na[i] += nb[i];
+      }
+      break;
+    case BinaryOperation::Minus:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] -= b[i];
+        da2[i] += db2[i];
+        na[i] += nb[i];
+      }
+      break;
+    case BinaryOperation::Multiply:
+      // df^2 = b^2 da^2 + a^2 db^2, to avoid problems when a or b are 0
+      for (size_t i = 0; i < count; ++i) {
+        const signal_t f = a[i] * b[i];
+        da2[i] = da2[i] * b[i] * b[i] + db2[i] * a[i] * a[i];
+        a[i] = f;
+      }
+      break;
+    case BinaryOperation::Divide:
+      // df^2 = da^2 / b^2 + db^2 f^2 / b^2, to avoid problems when a is 0
+      for (size_t i = 0; i < count; ++i) {
+        const signal_t f = a[i] / b[i];
+        const signal_t b2 = b[i] * b[i];
+        da2[i] = da2[i] / b2 + db2[i] * f * f / b2;
+        a[i] = f;
+      }
+      break;
+    case BinaryOperation::LessThan:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = (a[i] < b[i]) ? 1.0 : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    case BinaryOperation::GreaterThan:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = (a[i] > b[i]) ? 1.0 : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    case BinaryOperation::EqualTo:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = (std::fabs(a[i] - b[i]) < m_parameter) ? 1.0 : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    case BinaryOperation::And:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = ((a[i] != 0 && !maskA[i]) && (b[i] != 0 && !maskB[i])) ? 1.0
+                                                                       : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    case BinaryOperation::Or:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = ((a[i] != 0 && !maskA[i]) || (b[i] != 0 && !maskB[i])) ? 1.0
+                                                                       : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    case BinaryOperation::Xor:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = ((a[i] != 0 && !maskA[i]) != (b[i] != 0 && !maskB[i])) ? 1.0
+                                                                       : 0.0;
+        da2[i] = 0;
+      }
+      break;
+    }
+  }
+
+private:
+  /// Whether the numbers of events of both sides are added up
+  bool isAdditive() const {
+    return m_operation == BinaryOperation::Plus ||
+           m_operation == BinaryOperation::Minus;
+  }
+  /// Whether the numbers of events and the mask come from the right hand
+  /// side, because the left hand side is a scalar
+  bool takesEventsFromRhs() const {
+    return !isAdditive() && m_lhs->size() == 0 && m_rhs->size() != 0;
+  }
+
+  const BinaryOperation m_operation;
+  const boost::shared_ptr<const Node> m_lhs;
+  const boost::shared_ptr<const Node> m_rhs;
+  /// Tolerance of EqualTo
+  const double m_parameter;
+};
+
+enum class UnaryOperation { Log, Log10, Exp, Power, Not };
+
+/// An operation on one expression
+class UnaryNode : public Node {
+public:
+  UnaryNode(const UnaryOperation operation,
+            boost::shared_ptr<const Node> operand, const double parameter = 0.0)
+      : m_operation(operation), m_operand(std::move(operand)),
+        m_parameter(parameter) {}
+
+  size_t size() const override { return m_operand->size(); }
+  size_t depth() const override { return 1 + m_operand->depth(); }
+  uint64_t eventsContributed() const override {
+    return m_operand->eventsContributed();
+  }
+
+  void evaluate(const size_t start, const size_t count, Values &out,
+                std::vector<Values> &scratch,
+                const size_t level) const override {
+    m_operand->evaluate(start, count, out, scratch, level + 1);
+    signal_t *a = out.signal.data();
+    signal_t *da2 = out.errorSquared.data();
+    const char *masked = out.masked.data();
+
+    switch (m_operation) {
+    case UnaryOperation::Log:
+      // df^2 = da^2 / a^2
+      for (size_t i = 0; i < count; ++i) {
+        if (a[i] <= 0) {
+          a[i] = m_parameter;
+          da2[i] = 0;
+        } else {
+          da2[i] = da2[i] / (a[i] * a[i]);
+          a[i] = std::log(a[i]);
+        }
+      }
+      break;
+    case UnaryOperation::Log10:
+      // df^2 = ln(10)^-2 da^2 / a^2
+      for (size_t i = 0; i < count; ++i) {
+        if (a[i] <= 0) {
+          a[i] = m_parameter;
+          da2[i] = 0;
+        } else {
+          da2[i] = 0.1886117 * da2[i] / (a[i] * a[i]);
+          a[i] = std::log10(a[i]);
+        }
+      }
+      break;
+    case UnaryOperation::Exp:
+      // df^2 = f^2 da^2
+      for (size_t i = 0; i < count; ++i) {
+        const signal_t f = std::exp(a[i]);
+        da2[i] = f * f * da2[i];
+        a[i] = f;
+      }
+      break;
+    case UnaryOperation::Power: {
+      // df^2 = f^2 b^2 da^2 / a^2
+      const double exponentSquared = m_parameter * m_parameter;
+      for (size_t i = 0; i < count; ++i) {
+        const signal_t f = std::pow(a[i], m_parameter);
+        da2[i] = f * f * exponentSquared * da2[i] / (a[i] * a[i]);
+        a[i] = f;
+      }
+    } break;
+    case UnaryOperation::Not:
+      for (size_t i = 0; i < count; ++i) {
+        a[i] = (a[i] == 0.0 || masked[i]);
+        da2[i] = 0;
+      }
+      break;
+    }
+  }
+
+private:
+  const UnaryOperation m_operation;
+  const boost::shared_ptr<const Node> m_operand;
+  /// Filler of Log and Log10, exponent of Power
+  const double m_parameter;
+};
+
+MDHistoExpression binary(const BinaryOperation operation,
+                         const MDHistoExpression &lhs,
+                         const MDHistoExpression &rhs,
+                         const double parameter = 0.0) {
+  return MDHistoExpression(boost::make_shared<BinaryNode>(
+      operation, lhs.node(), rhs.node(), parameter));
+}
+
+MDHistoExpression unary(const UnaryOperation operation,
+                        const MDHistoExpression &operand,
+                        const double parameter = 0.0) {
+  return MDHistoExpression(
+      boost::make_shared<UnaryNode>(operation, operand.node(), parameter));
+}
+} // namespace
+
+/** Expression with the values of a workspace
+ * @param workspace :: the workspace, which must outlive the expression
+ */
+MDHistoExpression::MDHistoExpression(const MDHistoWorkspace &workspace)
+    : m_node(boost::make_shared<WorkspaceNode>(workspace)) {}
+
+/** Expression with the same value in every bin
+ * @param signal :: the signal
+ * @param error :: the error (not squared)
+ */
+MDHistoExpression::MDHistoExpression(const signal_t signal,
+                                     const signal_t error)
+    : m_node(boost::make_shared<ScalarNode>(signal, error)) {}
+
+/** Expression from its root node
+ * @param node :: the operation or operand at the root of the expression
+ */
+MDHistoExpression::MDHistoExpression(boost::shared_ptr<const Node> node)
+    : m_node(std::move(node)) {}
+
+/** Natural logarithm, with errors propagated as df^2 = da^2 / a^2
+ * @param filler :: value of the result where the signal is not positive
+ */
+MDHistoExpression MDHistoExpression::log(const double filler) const {
+  return unary(UnaryOperation::Log, *this, filler);
+}
+
+/** Base-10 logarithm, with errors propagated as df^2 = ln(10)^-2 da^2 / a^2
+ * @param filler :: value of the result where the signal is not positive
+ */
+MDHistoExpression MDHistoExpression::log10(const double filler) const {
+  return unary(UnaryOperation::Log10, *this, filler);
+}
+
+/// Exponential, with errors propagated as df^2 = f^2 da^2
+MDHistoExpression MDHistoExpression::exp() const {
+  return unary(UnaryOperation::Exp, *this);
+}
+
+/** Power, with errors propagated as df^2 = f^2 b^2 da^2 / a^2
+ * @param exponent :: the exponent b
+ */
+MDHistoExpression MDHistoExpression::power(const double exponent) const {
+  return unary(UnaryOperation::Power, *this, exponent);
+}
+
+/// 1.0 where the signal is less than that of rhs, 0.0 elsewhere
+MDHistoExpression
+MDHistoExpression::lessThan(const MDHistoExpression &rhs) const {
+  return binary(BinaryOperation::LessThan, *this, rhs);
+}
+
+/// 1.0 where the signal is greater than that of rhs, 0.0 elsewhere
+MDHistoExpression
+MDHistoExpression::greaterThan(const MDHistoExpression &rhs) const {
+  return binary(BinaryOperation::GreaterThan, *this, rhs);
+}
+
+/** 1.0 where the signal equals that of rhs, 0.0 elsewhere
+ * @param rhs :: the expression to compare with
+ * @param tolerance :: accept this deviation from a perfect equality
+ */
+MDHistoExpression MDHistoExpression::equalTo(const MDHistoExpression &rhs,
+                                             const signal_t tolerance) const {
+  return binary(BinaryOperation::EqualTo, *this, rhs, tolerance);
+}
+
+/// 1.0 where the signal is 0.0 or masked, 0.0 elsewhere
+MDHistoExpression MDHistoExpression::operator!() const {
+  return unary(UnaryOperation::Not, *this);
+}
+
+/// @return the number of bins, or 0 if the expression holds no workspace
+size_t MDHistoExpression::size() const { return m_node->size(); }
+
+/// @return the operation or operand at the root of the expression
+const boost::shared_ptr<const MDHistoExpression::Node> &
+MDHistoExpression::node() const {
+  return m_node;
+}
+
+/** Evaluate the expression and write the signal, squared error, number of
+ * events and mask of each bin to a workspace.
+ * @param out :: the workspace to write to, which may appear in the expression
+ * @throw std::invalid_argument if the workspace has a different number of
+ * bins than those in the expression
+ */
+void MDHistoExpression::evaluateInto(MDHistoWorkspace &out) const {
+  const size_t length = out.getNPoints();
+  if (size() != 0 && size() != length)
+    throw std::invalid_argument("MDHistoExpression: the output workspace has "
+                                "a different number of bins than the "
+                                "expression");
+  // Read before any bins of the workspaces in the expression are overwritten
+  const uint64_t eventsContributed = m_node->eventsContributed();
+  const size_t depth = m_node->depth();
+
+  // Blocks are handed out in chunks so that each chunk allocates its buffers
+  // only once
+  const size_t numBlocks = (length + BlockSize - 1) / BlockSize;
+  const auto numChunks = static_cast<int>(std::min(
+      numBlocks, static_cast<size_t>(8 * PARALLEL_GET_MAX_THREADS)));
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int chunk = 0; chunk < numChunks; ++chunk) {
+    Values values(BlockSize);
+    std::vector<Values> scratch(depth, Values(BlockSize));
+    const size_t firstBlock = numBlocks * chunk / numChunks;
+    const size_t lastBlock = numBlocks * (chunk + 1) / numChunks;
+    for (size_t block = firstBlock; block < lastBlock; ++block) {
+      const size_t start = block * BlockSize;
+      const size_t count = std::min(BlockSize, length - start);
+      m_node->evaluate(start, count, values, scratch, 0);
+      std::copy_n(values.signal.cbegin(), count, out.m_signals + start);
+      std::copy_n(values.errorSquared.cbegin(), count,
+                  out.m_errorsSquared + start);
+      std::copy_n(values.numEvents.cbegin(), count, out.m_numEvents + start);
+      std::transform(values.masked.cbegin(), values.masked.cbegin() + count,
+                     out.m_masks + start,
+                     [](const char masked) { return masked != 0; });
+    }
+  }
+  out.m_nEventsContributed = eventsContributed;
+}
+
+/// Sum, with errors and numbers of events added
+MDHistoExpression operator+(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Plus, lhs, rhs);
+}
+
+/// Difference, with errors and numbers of events added
+MDHistoExpression operator-(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Minus, lhs, rhs);
+}
+
+/// Product, with errors propagated as df^2 = b^2 da^2 + a^2 db^2
+MDHistoExpression operator*(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Multiply, lhs, rhs);
+}
+
+/// Quotient, with errors propagated as df^2 = da^2 / b^2 + db^2 f^2 / b^2
+MDHistoExpression operator/(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Divide, lhs, rhs);
+}
+
+/// Boolean and, where 0.0 and masked bins are false
+MDHistoExpression operator&(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::And, lhs, rhs);
+}
+
+/// Boolean or, where 0.0 and masked bins are false
+MDHistoExpression operator|(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Or, lhs, rhs);
+}
+
+/// Boolean exclusive or, where 0.0 and masked bins are false
+MDHistoExpression operator^(const MDHistoExpression &lhs,
+                            const MDHistoExpression &rhs) {
+  return binary(BinaryOperation::Xor, lhs, rhs);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
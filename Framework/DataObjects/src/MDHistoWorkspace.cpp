@@ -5,6 +5,7 @@
 #include "MantidKernel/VMD.h"
 #include "MantidKernel/WarningSuppressions.h"
 #include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidDataObjects/MDHistoExpression.h"
 #include "MantidDataObjects/MDHistoWorkspaceIterator.h"
 #include "MantidDataObjects/MDFramesToSpecialCoordinateSystem.h"
 #include "MantidGeometry/MDGeometry/MDHistoDimension.h"
@@ -771,12 +772,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator+=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "add");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] += b.m_signals[i];
-    m_errorsSquared[i] += b.m_errorsSquared[i];
-    m_numEvents[i] += b.m_numEvents[i];
-  }
-  m_nEventsContributed += b.m_nEventsContributed;
+  (MDHistoExpression(*this) + b).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -786,11 +782,8 @@ void MDHistoWorkspace::add(const MDHistoWorkspace &b) {
  * @param error :: error (not squared) to apply
  * */
 void MDHistoWorkspace::add(const signal_t signal, const signal_t error) {
-  signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] += signal;
-    m_errorsSquared[i] += errorSquared;
-  }
+  (MDHistoExpression(*this) + MDHistoExpression(signal, error))
+      .evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -810,12 +803,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator-=(const MDHistoWorkspace &b) {
  * */
 void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "subtract");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] -= b.m_signals[i];
-    m_errorsSquared[i] += b.m_errorsSquared[i];
-    m_numEvents[i] += b.m_numEvents[i];
-  }
-  m_nEventsContributed += b.m_nEventsContributed;
+  (MDHistoExpression(*this) - b).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -825,11 +813,8 @@ void MDHistoWorkspace::subtract(const MDHistoWorkspace &b) {
  * @param error :: error (not squared) to apply
  * */
 void MDHistoWorkspace::subtract(const signal_t signal, const signal_t error) {
-  signal_t errorSquared = error * error;
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] -= signal;
-    m_errorsSquared[i] += errorSquared;
-  }
+  (MDHistoExpression(*this) - MDHistoExpression(signal, error))
+      .evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -858,19 +843,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator*=(const MDHistoWorkspace &b_ws) {
  * */
 void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "multiply");
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-
-    signal_t b = b_ws.m_signals[i];
-    signal_t db2 = b_ws.m_errorsSquared[i];
-
-    signal_t f = a * b;
-    signal_t df2 = da2 * b * b + db2 * a * a;
-
-    m_signals[i] = f;
-    m_errorsSquared[i] = df2;
-  }
+  (MDHistoExpression(*this) * b_ws).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -886,19 +859,8 @@ void MDHistoWorkspace::multiply(const MDHistoWorkspace &b_ws) {
  * @param error :: error (not squared) to apply
  * @return *this after operation */
 void MDHistoWorkspace::multiply(const signal_t signal, const signal_t error) {
-  signal_t b = signal;
-  signal_t db2 = error * error;
-
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-
-    signal_t f = a * b;
-    signal_t df2 = da2 * b * b + db2 * a * a;
-
-    m_signals[i] = f;
-    m_errorsSquared[i] = df2;
-  }
+  (MDHistoExpression(*this) * MDHistoExpression(signal, error))
+      .evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -927,19 +889,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator/=(const MDHistoWorkspace &b_ws) {
  **/
 void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
   checkWorkspaceSize(b_ws, "divide");
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-
-    signal_t b = b_ws.m_signals[i];
-    signal_t db2 = b_ws.m_errorsSquared[i];
-
-    signal_t f = a / b;
-    signal_t df2 = da2 / (b * b) + db2 * f * f / (b * b);
-
-    m_signals[i] = f;
-    m_errorsSquared[i] = df2;
-  }
+  (MDHistoExpression(*this) / b_ws).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -955,19 +905,8 @@ void MDHistoWorkspace::divide(const MDHistoWorkspace &b_ws) {
  * @param error :: error (not squared) to apply
  **/
 void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
-  signal_t b = signal;
-  signal_t db2 = error * error;
-  signal_t db2_relative = db2 / (b * b);
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-
-    signal_t f = a / b;
-    signal_t df2 = da2 / (b * b) + db2_relative * f * f;
-
-    m_signals[i] = f;
-    m_errorsSquared[i] = df2;
-  }
+  (MDHistoExpression(*this) / MDHistoExpression(signal, error))
+      .evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -977,17 +916,7 @@ void MDHistoWorkspace::divide(const signal_t signal, const signal_t error) {
  * \f$ df^2 = a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-    if (a <= 0) {
-      m_signals[i] = filler;
-      m_errorsSquared[i] = 0;
-    } else {
-      m_signals[i] = std::log(a);
-      m_errorsSquared[i] = da2 / (a * a);
-    }
-  }
+  MDHistoExpression(*this).log(filler).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -997,17 +926,7 @@ void MDHistoWorkspace::log(double filler) {
  * \f$ df^2 = (ln(10)^-2) * a^2 / da^2 \f$
  */
 void MDHistoWorkspace::log10(double filler) {
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t da2 = m_errorsSquared[i];
-    if (a <= 0) {
-      m_signals[i] = filler;
-      m_errorsSquared[i] = 0;
-    } else {
-      m_signals[i] = std::log10(a);
-      m_errorsSquared[i] = 0.1886117 * da2 / (a * a); // 0.1886117  = ln(10)^-2
-    }
-  }
+  MDHistoExpression(*this).log10(filler).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1017,12 +936,7 @@ void MDHistoWorkspace::log10(double filler) {
  * \f$ df^2 = f^2 * da^2 \f$
  */
 void MDHistoWorkspace::exp() {
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t f = std::exp(m_signals[i]);
-    signal_t da2 = m_errorsSquared[i];
-    m_signals[i] = f;
-    m_errorsSquared[i] = f * f * da2;
-  }
+  MDHistoExpression(*this).exp().evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1033,14 +947,7 @@ void MDHistoWorkspace::exp() {
  * \f$ df^2 = f^2 * b^2 * (da^2 / a^2) \f$
  */
 void MDHistoWorkspace::power(double exponent) {
-  double exponent_squared = exponent * exponent;
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t a = m_signals[i];
-    signal_t f = std::pow(a, exponent);
-    signal_t da2 = m_errorsSquared[i];
-    m_signals[i] = f;
-    m_errorsSquared[i] = f * f * exponent_squared * da2 / (a * a);
-  }
+  MDHistoExpression(*this).power(exponent).evaluateInto(*this);
 }
 
 //==============================================================================================
@@ -1058,13 +965,7 @@ void MDHistoWorkspace::power(double exponent) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "&= (and)");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) &&
-                    (b.m_signals[i] != 0 && !b.m_masks[i]))
-                       ? 1.0
-                       : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  (MDHistoExpression(*this) & b).evaluateInto(*this);
   return *this;
 }
 
@@ -1077,13 +978,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator&=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "|= (or)");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ||
-                    (b.m_signals[i] != 0 && !b.m_masks[i]))
-                       ? 1.0
-                       : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  (MDHistoExpression(*this) | b).evaluateInto(*this);
   return *this;
 }
 
@@ -1097,13 +992,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator|=(const MDHistoWorkspace &b) {
  * @return *this after operation */
 MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "^= (xor)");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = ((m_signals[i] != 0 && !m_masks[i]) ^
-                    (b.m_signals[i] != 0 && !b.m_masks[i]))
-                       ? 1.0
-                       : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  (MDHistoExpression(*this) ^ b).evaluateInto(*this);
   return *this;
 }
 
@@ -1114,10 +1003,7 @@ MDHistoWorkspace &MDHistoWorkspace::operator^=(const MDHistoWorkspace &b) {
  * 0.0 is "false", all other values are "true". All errors are set to 0.
  */
 void MDHistoWorkspace::operatorNot() {
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = (m_signals[i] == 0.0 || m_masks[i]);
-    m_errorsSquared[i] = 0;
-  }
+  (!MDHistoExpression(*this)).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1130,10 +1016,7 @@ void MDHistoWorkspace::operatorNot() {
  */
 void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "lessThan");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = (m_signals[i] < b.m_signals[i]) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).lessThan(b).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1145,10 +1028,7 @@ void MDHistoWorkspace::lessThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::lessThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = (m_signals[i] < signal) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).lessThan(signal).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1161,10 +1041,7 @@ void MDHistoWorkspace::lessThan(const signal_t signal) {
  */
 void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
   checkWorkspaceSize(b, "greaterThan");
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = (m_signals[i] > b.m_signals[i]) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).greaterThan(b).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1176,10 +1053,7 @@ void MDHistoWorkspace::greaterThan(const MDHistoWorkspace &b) {
  * @param signal :: signal value on the RHS of the comparison.
  */
 void MDHistoWorkspace::greaterThan(const signal_t signal) {
-  for (size_t i = 0; i < m_length; ++i) {
-    m_signals[i] = (m_signals[i] > signal) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).greaterThan(signal).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1194,11 +1068,7 @@ void MDHistoWorkspace::greaterThan(const signal_t signal) {
 void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
                                const signal_t tolerance) {
   checkWorkspaceSize(b, "equalTo");
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t diff = fabs(m_signals[i] - b.m_signals[i]);
-    m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).equalTo(b, tolerance).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
@@ -1212,11 +1082,7 @@ void MDHistoWorkspace::equalTo(const MDHistoWorkspace &b,
  */
 void MDHistoWorkspace::equalTo(const signal_t signal,
                                const signal_t tolerance) {
-  for (size_t i = 0; i < m_length; ++i) {
-    signal_t diff = fabs(m_signals[i] - signal);
-    m_signals[i] = (diff < tolerance) ? 1.0 : 0.0;
-    m_errorsSquared[i] = 0;
-  }
+  MDHistoExpression(*this).equalTo(signal, tolerance).evaluateInto(*this);
 }
 
 //----------------------------------------------------------------------------------------------
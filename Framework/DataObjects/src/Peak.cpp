@@ -646,9 +646,10 @@ bool Peak::findDetector(const InstrumentRayTracer &tracer) {
 bool Peak::findDetector(const Mantid::Kernel::V3D &beam,
                         const InstrumentRayTracer &tracer) {
   bool found = false;
-  // Create a ray tracer
-  tracer.traceFromSample(beam);
-  IDetector_const_sptr det = tracer.getDetectorResult();
+  // Trace into a local track so that peaks may share a tracer between threads
+  Geometry::Track track;
+  tracer.traceFromSample(beam, track);
+  IDetector_const_sptr det = tracer.getDetectorResult(track);
   if (det) {
     // Set the detector ID, the row, col, etc.
     this->setDetectorID(det->getID());
@@ -669,11 +670,11 @@ bool Peak::findDetector(const Mantid::Kernel::V3D &beam,
         V3D gapDir = V3D(0., 0., 0.);
         gapDir[i] = gap;
         V3D beam1 = beam + gapDir;
-        tracer.traceFromSample(beam1);
-        IDetector_const_sptr det1 = tracer.getDetectorResult();
+        tracer.traceFromSample(beam1, track);
+        IDetector_const_sptr det1 = tracer.getDetectorResult(track);
         V3D beam2 = beam - gapDir;
-        tracer.traceFromSample(beam2);
-        IDetector_const_sptr det2 = tracer.getDetectorResult();
+        tracer.traceFromSample(beam2, track);
+        IDetector_const_sptr det2 = tracer.getDetectorResult(track);
         if (det1 && det2) {
           // Set the detector ID to one of the neighboring pixels
           this->setDetectorID(static_cast<int>(det1->getID()));
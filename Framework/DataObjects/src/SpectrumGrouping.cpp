@@ -0,0 +1,321 @@
+#include "MantidDataObjects/SpectrumGrouping.h"
+#include "MantidAPI/Progress.h"
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidHistogramData/HistogramMath.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/make_unique.h"
+
+#include <algorithm>
+#include <memory>
+#include <stdexcept>
+
+using Mantid::HistogramData::Histogram;
+
+namespace Mantid {
+namespace DataObjects {
+
+namespace {
+/** Append the events of consecutive event lists to a vector one list at a
+ * time, and free the memory of each list once appended. An empty vector takes
+ * over the events of the first list. The rest of the vector is reserved but
+ * not filled up front, so only the events of one list are held twice at once.
+ * @param begin :: the first of the lists, all holding events of type T
+ * @param end :: one past the last list
+ * @param numberOfEvents :: the number of events in the vector once appended
+ * @param events :: the vector to append the events to
+ */
+template <class T>
+void appendParts(std::vector<EventList>::iterator begin,
+                 std::vector<EventList>::iterator end,
+                 const size_t numberOfEvents, std::vector<T> &events) {
+  std::vector<T> *partEvents;
+  if (events.empty() && begin != end) {
+    getEventsFrom(*begin, partEvents);
+    events.swap(*partEvents);
+    begin->clear(false);
+    ++begin;
+  }
+  events.reserve(numberOfEvents);
+  for (auto part = begin; part != end; ++part) {
+    getEventsFrom(*part, partEvents);
+    events.insert(events.end(), partEvents->cbegin(), partEvents->cend());
+    part->clear(false);
+  }
+}
+
+/// @return the first and last chunk of each group split over several chunks
+std::vector<std::pair<size_t, size_t>>
+splitGroups(const std::vector<SpectrumGrouping::Chunk> &chunks) {
+  std::vector<std::pair<size_t, size_t>> result;
+  size_t first = 0;
+  while (first < chunks.size()) {
+    size_t last = first + 1;
+    while (last < chunks.size() && chunks[last].group == chunks[first].group)
+      ++last;
+    if (last - first > 1)
+      result.emplace_back(first, last);
+    first = last;
+  }
+  return result;
+}
+} // namespace
+
+/**
+ * @param groups :: the workspace indices of the spectra in each group
+ */
+SpectrumGrouping::SpectrumGrouping(
+    const std::vector<std::vector<size_t>> &groups) {
+  size_t numberOfIndices = 0;
+  for (const auto &group : groups)
+    numberOfIndices += group.size();
+  m_offsets.reserve(groups.size() + 1);
+  m_indices.reserve(numberOfIndices);
+  for (const auto &group : groups)
+    addGroup(group);
+}
+
+/** Append a group after the existing ones
+ * @param indices :: the workspace indices of the spectra in the group
+ */
+void SpectrumGrouping::addGroup(const std::vector<size_t> &indices) {
+  m_indices.insert(m_indices.end(), indices.begin(), indices.end());
+  m_offsets.push_back(m_indices.size());
+}
+
+/** Split the groups into chunks of work. Each group is split evenly into the
+ * fewest chunks of at most maxChunkSize indices, empty groups have no chunk.
+ * @param maxChunkSize :: the largest number of indices in a chunk
+ * @return the chunks, ordered by group and position within the group
+ */
+std::vector<SpectrumGrouping::Chunk>
+SpectrumGrouping::chunks(const size_t maxChunkSize) const {
+  if (maxChunkSize == 0)
+    throw std::invalid_argument("SpectrumGrouping: chunks must not be empty");
+  std::vector<Chunk> result;
+  for (size_t group = 0; group < numberOfGroups(); ++group) {
+    const size_t begin = groupBegin(group);
+    const size_t size = groupSize(group);
+    const size_t numberOfChunks = (size + maxChunkSize - 1) / maxChunkSize;
+    for (size_t i = 0; i < numberOfChunks; ++i)
+      result.push_back({group, begin + i * size / numberOfChunks,
+                        begin + (i + 1) * size / numberOfChunks});
+  }
+  return result;
+}
+
+/// @return true if the chunk holds all the indices of its group
+bool SpectrumGrouping::isWholeGroup(const Chunk &chunk) const {
+  return chunk.begin == groupBegin(chunk.group) &&
+         chunk.end == groupEnd(chunk.group);
+}
+
+/** Add the histograms of the spectra of a chunk, which must have the binning
+ * of output, to output
+ * @param chunk :: the spectra to add
+ * @param input :: the workspace holding the spectra
+ * @param output :: the histogram to add to
+ */
+void SpectrumGrouping::addHistograms(const Chunk &chunk,
+                                     const API::MatrixWorkspace &input,
+                                     Histogram &output) const {
+  for (size_t i = chunk.begin; i < chunk.end; ++i)
+    output += input.histogram(m_indices[i]);
+}
+
+/** Append the events and detector IDs of the spectra of a chunk to output
+ * @param chunk :: the spectra to add
+ * @param input :: the workspace holding the spectra
+ * @param output :: the event list to append to
+ */
+void SpectrumGrouping::addEvents(const Chunk &chunk,
+                                 const EventWorkspace &input,
+                                 EventList &output) const {
+  for (size_t i = chunk.begin; i < chunk.end; ++i)
+    output += input.getSpectrum(m_indices[i]);
+}
+
+/** Add the detector IDs of the spectra of a chunk to output
+ * @param chunk :: the spectra whose detector IDs are added
+ * @param input :: the workspace holding the spectra
+ * @param output :: the spectrum to add the detector IDs to
+ */
+void SpectrumGrouping::addDetectorIDs(const Chunk &chunk,
+                                      const API::MatrixWorkspace &input,
+                                      API::ISpectrum &output) const {
+  for (size_t i = chunk.begin; i < chunk.end; ++i)
+    output.addDetectorIDs(input.getSpectrum(m_indices[i]).getDetectorIDs());
+}
+
+/** Set the histogram of each output spectrum to the sum of the histograms of
+ * its group and add their detector IDs. The output keeps its bin edges, which
+ * must be those of all the spectra of the group.
+ * @param input :: the workspace holding the spectra to sum
+ * @param output :: the workspace with one spectrum per group
+ * @param progress :: if given, reports one step per summed spectrum
+ */
+void SpectrumGrouping::sumHistograms(const API::MatrixWorkspace &input,
+                                     API::MatrixWorkspace &output,
+                                     API::Progress *progress) const {
+  if (output.getNumberHistograms() < numberOfGroups())
+    throw std::invalid_argument(
+        "SpectrumGrouping: the output has fewer spectra than groups");
+  for (size_t group = 0; group < numberOfGroups(); ++group) {
+    const size_t numberOfBins = output.y(group).size();
+    for (size_t i = groupBegin(group); i < groupEnd(group); ++i)
+      if (input.y(m_indices[i]).size() != numberOfBins)
+        throw std::invalid_argument(
+            "SpectrumGrouping: the spectra of a group must have the binning "
+            "of its output spectrum");
+  }
+
+  const auto work = chunks();
+  const int numberOfChunks = static_cast<int>(work.size());
+  std::vector<std::unique_ptr<Histogram>> parts(work.size());
+  PRAGMA_OMP(parallel for schedule(dynamic)
+             if (Kernel::threadSafe(input, output))
+             num_threads(PARALLEL_TEAM_SIZE_IF(
+                 Kernel::threadSafe(input, output))))
+  for (int i = 0; i < numberOfChunks; ++i) {
+    const auto &chunk = work[i];
+    auto histogram = output.histogram(chunk.group);
+    histogram.mutableY() = 0.0;
+    histogram.mutableE() = 0.0;
+    addHistograms(chunk, input, histogram);
+    if (isWholeGroup(chunk)) {
+      output.setHistogram(chunk.group, std::move(histogram));
+      addDetectorIDs(chunk, input, output.getSpectrum(chunk.group));
+    } else {
+      parts[i] = Kernel::make_unique<Histogram>(std::move(histogram));
+    }
+    if (progress)
+      progress->reportIncrement(chunk.end - chunk.begin);
+  }
+
+  const auto split = splitGroups(work);
+  const int numberOfSplitGroups = static_cast<int>(split.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(input, output))
+  for (int i = 0; i < numberOfSplitGroups; ++i) {
+    const size_t first = split[i].first;
+    const size_t group = work[first].group;
+    auto &histogram = *parts[first];
+    for (size_t part = first + 1; part < split[i].second; ++part) {
+      histogram += *parts[part];
+      parts[part].reset();
+    }
+    output.setHistogram(group, std::move(histogram));
+    addDetectorIDs({group, groupBegin(group), groupEnd(group)}, input,
+                   output.getSpectrum(group));
+  }
+}
+
+/** Append the events and detector IDs of the spectra of each group to its
+ * output event list
+ * @param input :: the workspace holding the spectra to concatenate
+ * @param output :: the workspace with one event list per group
+ * @param progress :: if given, reports one step per concatenated spectrum
+ */
+void SpectrumGrouping::concatenateEvents(const EventWorkspace &input,
+                                         EventWorkspace &output,
+                                         API::Progress *progress) const {
+  concatenateEvents(input, output, progress, nullptr);
+}
+
+/** Append the events and detector IDs of the spectra of each group to its
+ * output event list, like concatenateEvents(), and clear each input spectrum
+ * as soon as its chunk has been appended. The input and output events are
+ * then never all held at once, as when focussing in place. No workspace index
+ * may be in more than one group.
+ * @param input :: the workspace holding the spectra to move
+ * @param output :: the workspace with one event list per group
+ * @param progress :: if given, reports one step per moved spectrum
+ */
+void SpectrumGrouping::moveEvents(EventWorkspace &input, EventWorkspace &output,
+                                  API::Progress *progress) const {
+  concatenateEvents(input, output, progress, &input);
+}
+
+/** Append the events and detector IDs of the spectra of each group to its
+ * output event list
+ * @param input :: the workspace holding the spectra to concatenate
+ * @param output :: the workspace with one event list per group
+ * @param progress :: if given, reports one step per concatenated spectrum
+ * @param emptiedInput :: if given, the input, whose spectra are cleared once
+ * appended
+ */
+void SpectrumGrouping::concatenateEvents(const EventWorkspace &input,
+                                         EventWorkspace &output,
+                                         API::Progress *progress,
+                                         EventWorkspace *emptiedInput) const {
+  if (output.getNumberHistograms() < numberOfGroups())
+    throw std::invalid_argument(
+        "SpectrumGrouping: the output has fewer spectra than groups");
+
+  const auto work = chunks();
+  const int numberOfChunks = static_cast<int>(work.size());
+  std::vector<EventList> parts(work.size());
+  PRAGMA_OMP(parallel for schedule(dynamic)
+             if (Kernel::threadSafe(input, output))
+             num_threads(PARALLEL_TEAM_SIZE_IF(
+                 Kernel::threadSafe(input, output))))
+  for (int i = 0; i < numberOfChunks; ++i) {
+    const auto &chunk = work[i];
+    if (isWholeGroup(chunk))
+      addEvents(chunk, input, output.getSpectrum(chunk.group));
+    else
+      addEvents(chunk, input, parts[i]);
+    if (emptiedInput)
+      for (size_t j = chunk.begin; j < chunk.end; ++j)
+        emptiedInput->getSpectrum(m_indices[j]).clear();
+    if (progress)
+      progress->reportIncrement(chunk.end - chunk.begin);
+  }
+
+  const auto split = splitGroups(work);
+  const int numberOfSplitGroups = static_cast<int>(split.size());
+  PARALLEL_FOR_IF(Kernel::threadSafe(input, output))
+  for (int i = 0; i < numberOfSplitGroups; ++i) {
+    joinEvents(parts.begin() + split[i].first,
+               parts.begin() + split[i].second,
+               output.getSpectrum(work[split[i].first].group));
+  }
+}
+
+/** Append the events and detector IDs of event lists to output, in order.
+ * The lists are converted to a common event type and appended one after the
+ * other, each being emptied once appended.
+ * @param begin :: the first list to append
+ * @param end :: one past the last list to append
+ * @param output :: the event list to append to
+ */
+void SpectrumGrouping::joinEvents(std::vector<EventList>::iterator begin,
+                                  std::vector<EventList>::iterator end,
+                                  EventList &output) {
+  // The event types are ordered by the information they drop
+  auto type = output.getEventType();
+  for (auto part = begin; part != end; ++part)
+    type = std::max(type, part->getEventType());
+  output.switchTo(type);
+
+  size_t numberOfEvents = output.getNumberEvents();
+  for (auto part = begin; part != end; ++part) {
+    part->switchTo(type);
+    numberOfEvents += part->getNumberEvents();
+    output.addDetectorIDs(part->getDetectorIDs());
+  }
+
+  switch (type) {
+  case API::TOF:
+    appendParts(begin, end, numberOfEvents, output.getEvents());
+    break;
+  case API::WEIGHTED:
+    appendParts(begin, end, numberOfEvents, output.getWeightedEvents());
+    break;
+  case API::WEIGHTED_NOTIME:
+    appendParts(begin, end, numberOfEvents, output.getWeightedEventsNoTime());
+    break;
+  }
+  output.setSortOrder(UNSORTED);
+}
+
+} // namespace DataObjects
+} // namespace Mantid
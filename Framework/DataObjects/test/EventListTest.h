@@ -314,6 +314,59 @@ public:
     TS_ASSERT_EQUALS(el.getWeightedEventsNoTime()[0].error(), 1.0);
   }
 
+  //----------------------------------
+  void test_fieldLayout_of_tof_events() {
+    el.clear();
+    el += TofEvent(1.5, 100);
+    el += TofEvent(2.5, 200);
+    auto tof = el.fieldLayout(EventField::Tof);
+    TS_ASSERT_EQUALS(tof.size, 2);
+    TS_ASSERT_EQUALS(tof.stride, sizeof(TofEvent));
+    TS_ASSERT_EQUALS(*reinterpret_cast<const double *>(tof.data + tof.stride),
+                     2.5);
+    auto pulse = el.fieldLayout(EventField::PulseTime);
+    TS_ASSERT_EQUALS(*reinterpret_cast<const int64_t *>(pulse.data), 100);
+    TS_ASSERT_THROWS(el.fieldLayout(EventField::Weight), std::invalid_argument);
+  }
+
+  //----------------------------------
+  void test_fieldLayout_of_weighted_events() {
+    el.clear();
+    el += WeightedEvent(1.5, 100, 2.0, 4.0);
+    auto weight = el.fieldLayout(EventField::Weight);
+    TS_ASSERT_EQUALS(weight.stride, sizeof(WeightedEvent));
+    TS_ASSERT_EQUALS(*reinterpret_cast<const float *>(weight.data), 2.0f);
+    auto error = el.fieldLayout(EventField::ErrorSquared);
+    TS_ASSERT_EQUALS(*reinterpret_cast<const float *>(error.data), 4.0f);
+
+    el.switchTo(WEIGHTED_NOTIME);
+    auto tof = el.fieldLayout(EventField::Tof);
+    TS_ASSERT_EQUALS(tof.stride, sizeof(WeightedEventNoTime));
+    TS_ASSERT_EQUALS(*reinterpret_cast<const double *>(tof.data), 1.5);
+    TS_ASSERT_THROWS(el.fieldLayout(EventField::PulseTime),
+                     std::invalid_argument);
+  }
+
+  //----------------------------------
+  void test_mutableFieldLayout_writes_in_place_and_marks_unsorted() {
+    el.clear();
+    el += TofEvent(1.5, 100);
+    el += TofEvent(2.5, 200);
+    el.sortTof();
+    auto tof = el.mutableFieldLayout(EventField::Tof);
+    *reinterpret_cast<double *>(tof.data) = 3.5;
+    TS_ASSERT_EQUALS(el.getEvents()[0].tof(), 3.5);
+    TS_ASSERT_EQUALS(el.getSortType(), UNSORTED);
+  }
+
+  //----------------------------------
+  void test_fieldLayout_of_empty_list() {
+    el.clear();
+    auto tof = el.fieldLayout(EventField::Tof);
+    TS_ASSERT(!tof.data);
+    TS_ASSERT_EQUALS(tof.size, 0);
+  }
+
   //----------------------------------
   void test_switch_on_the_fly_when_adding_single_event() {
     fake_data();
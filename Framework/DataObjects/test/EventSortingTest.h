@@ -0,0 +1,143 @@
+#ifndef MANTID_DATAOBJECTS_EVENTSORTINGTEST_H_
+#define MANTID_DATAOBJECTS_EVENTSORTINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventSorting.h"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <utility>
+
+using namespace Mantid::DataObjects::EventSorting;
+
+namespace {
+/// Event stand-in: the key and the position before sorting
+using Item = std::pair<double, size_t>;
+
+uint64_t itemKey(const Item &item) { return orderedKey(item.first); }
+
+std::vector<Item> randomItems(const size_t size, const int numValues) {
+  std::mt19937 generator(42);
+  std::uniform_int_distribution<int> distribution(-numValues, numValues);
+  std::vector<Item> items;
+  for (size_t i = 0; i < size; ++i)
+    items.emplace_back(0.5 * distribution(generator), i);
+  return items;
+}
+
+/// Sorted by key, and stable
+bool isStablySorted(const std::vector<Item> &items) {
+  return std::is_sorted(items.begin(), items.end());
+}
+} // namespace
+
+class EventSortingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static EventSortingTest *createSuite() { return new EventSortingTest(); }
+  static void destroySuite(EventSortingTest *suite) { delete suite; }
+
+  void test_orderedKey_double() {
+    const std::vector<double> values{-1e300, -2.5, -1.0, -1e-300, 0.0,
+                                     1e-300, 1.0,  2.5,  1e300};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(orderedKey(values[i - 1]), orderedKey(values[i]));
+  }
+
+  void test_orderedKey_int64() {
+    const std::vector<int64_t> values{std::numeric_limits<int64_t>::min(), -1,
+                                      0, 1, std::numeric_limits<int64_t>::max()};
+    for (size_t i = 1; i < values.size(); ++i)
+      TS_ASSERT_LESS_THAN(orderedKey(values[i - 1]), orderedKey(values[i]));
+  }
+
+  void test_mergeSortedRuns() {
+    // Five sorted runs, as if appended pulse by pulse
+    std::vector<Item> items;
+    for (size_t run = 0; run < 5; ++run)
+      for (size_t i = 0; i < 100; ++i)
+        items.emplace_back(static_cast<double>(3 * i + 5 * run), items.size());
+    const auto less = [](const Item &a, const Item &b) {
+      return a.first < b.first;
+    };
+    TS_ASSERT(mergeSortedRuns(items, less));
+    TS_ASSERT(isStablySorted(items));
+  }
+
+  void test_mergeSortedRuns_gives_up_on_many_runs() {
+    auto items = randomItems(1000, 100);
+    const auto original = items;
+    const auto less = [](const Item &a, const Item &b) {
+      return a.first < b.first;
+    };
+    TS_ASSERT(!mergeSortedRuns(items, less));
+    TS_ASSERT(items == original);
+  }
+
+  void test_radixSort_is_stable() {
+    auto items = randomItems(5000, 50);
+    radixSort(items, itemKey);
+    TS_ASSERT(isStablySorted(items));
+  }
+
+  void test_sortByKey() {
+    for (const size_t size : {0, 1, 2, 10, 1000, 5000}) {
+      auto items = randomItems(size, 1000);
+      sortByKey(items, itemKey);
+      TS_ASSERT(std::is_sorted(
+          items.begin(), items.end(),
+          [](const Item &a, const Item &b) { return a.first < b.first; }));
+    }
+  }
+
+  void test_sortByKey_sorted_input_is_unchanged() {
+    auto items = randomItems(5000, 1000);
+    std::sort(items.begin(), items.end());
+    const auto sorted = items;
+    sortByKey(items, itemKey);
+    TS_ASSERT(items == sorted);
+  }
+
+  void test_sortByKey_long_list_in_parallel() {
+    auto items = randomItems(MinParallelSortSize + 10, 100000);
+    sortByKey(items, itemKey);
+    TS_ASSERT(std::is_sorted(
+        items.begin(), items.end(),
+        [](const Item &a, const Item &b) { return a.first < b.first; }));
+  }
+
+  void test_comparisonSort_leaves_medium_lists_to_radix_sort() {
+    auto items = randomItems(5000, 1000);
+    const auto original = items;
+    const auto less = [](const Item &a, const Item &b) {
+      return a.first < b.first;
+    };
+    TS_ASSERT(!comparisonSort(items, less));
+    TS_ASSERT(items == original);
+    auto few = randomItems(10, 1000);
+    TS_ASSERT(comparisonSort(few, less));
+    TS_ASSERT(std::is_sorted(few.begin(), few.end(), less));
+  }
+
+  void test_sortByKeys() {
+    for (const size_t size : {10, 5000}) {
+      auto items = randomItems(size, 10);
+      // Order by key, then by descending position
+      const auto reversed = [](const Item &item) {
+        return std::numeric_limits<uint64_t>::max() - item.second;
+      };
+      sortByKeys(items, itemKey, reversed);
+      TS_ASSERT(std::is_sorted(items.begin(), items.end(),
+                               [](const Item &a, const Item &b) {
+                                 return a.first < b.first ||
+                                        (a.first == b.first &&
+                                         a.second > b.second);
+                               }));
+    }
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_EVENTSORTINGTEST_H_ */
@@ -5,9 +5,28 @@
 #include "MantidKernel/Timer.h"
 #include "MantidKernel/System.h"
 
+#include "MantidDataObjects/EventList.h"
 #include "MantidDataObjects/EventWorkspaceMRU.h"
 
 using namespace Mantid::DataObjects;
+using Mantid::Kernel::make_cow;
+using Mantid::HistogramData::HistogramE;
+using Mantid::HistogramData::HistogramX;
+using Mantid::HistogramData::HistogramY;
+
+namespace {
+const size_t NumberOfBins = 100;
+
+EventWorkspaceMRU::XType makeX() {
+  return make_cow<HistogramX>(NumberOfBins + 1, 0.0);
+}
+
+void insert(EventWorkspaceMRU &mru, const EventList *index,
+            const EventWorkspaceMRU::XType &x) {
+  mru.insert(index, x, make_cow<HistogramY>(NumberOfBins, 1.0),
+             make_cow<HistogramE>(NumberOfBins, 1.0));
+}
+} // namespace
 
 class EventWorkspaceMRUTest : public CxxTest::TestSuite {
 public:
@@ -15,6 +34,127 @@ public:
     EventWorkspaceMRU mru;
     TS_ASSERT_THROWS_NOTHING(mru.MRUSize());
     TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.memoryBudget(),
+                     EventWorkspaceMRU::Budget::global().bytes());
+  }
+
+  void test_insert_and_find() {
+    EventWorkspaceMRU::Budget budget(1 << 20);
+    EventWorkspaceMRU mru(budget);
+    EventList list;
+    const auto x = makeX();
+    TS_ASSERT(!mru.findY(&list, x));
+
+    insert(mru, &list, x);
+    TS_ASSERT_EQUALS(mru.MRUSize(), 1);
+    const auto y = mru.findY(&list, x);
+    TS_ASSERT(y);
+    TS_ASSERT_EQUALS(y->size(), NumberOfBins);
+    TS_ASSERT(mru.findE(&list, x));
+
+    const auto statistics = mru.statistics();
+    TS_ASSERT_EQUALS(statistics.hits, 2);
+    TS_ASSERT_EQUALS(statistics.misses, 1);
+    TS_ASSERT_EQUALS(statistics.evictions, 0);
+    TS_ASSERT_EQUALS(statistics.memoryUsed,
+                     EventWorkspaceMRU::entryMemory(NumberOfBins));
+  }
+
+  void test_histograms_for_another_X_are_not_found() {
+    EventWorkspaceMRU::Budget budget(1 << 20);
+    EventWorkspaceMRU mru(budget);
+    EventList list;
+    insert(mru, &list, makeX());
+    // An equal X is not the same generation of X
+    TS_ASSERT(!mru.findY(&list, makeX()));
+    // The stale entry is dropped
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.statistics().memoryUsed, 0);
+  }
+
+  void test_least_recently_used_are_evicted() {
+    const size_t entryMemory = EventWorkspaceMRU::entryMemory(NumberOfBins);
+    EventWorkspaceMRU::Budget budget(160 * entryMemory);
+    EventWorkspaceMRU mru(budget);
+    std::vector<EventList> lists(1000);
+    const auto x = makeX();
+    for (const auto &list : lists)
+      insert(mru, &list, x);
+
+    const auto statistics = mru.statistics();
+    TS_ASSERT_LESS_THAN_EQUALS(mru.MRUSize(), 160);
+    TS_ASSERT_EQUALS(statistics.evictions, lists.size() - mru.MRUSize());
+    TS_ASSERT_LESS_THAN_EQUALS(statistics.memoryUsed, mru.memoryBudget());
+    TS_ASSERT_EQUALS(budget.used(), statistics.memoryUsed);
+    // The most recently inserted lists are kept, the oldest are not
+    TS_ASSERT(mru.findY(&lists.back(), x));
+    TS_ASSERT(mru.findY(&lists[lists.size() - 100], x));
+    TS_ASSERT(!mru.findY(&lists.front(), x));
+  }
+
+  void test_the_budget_is_shared_between_caches() {
+    const size_t entryMemory = EventWorkspaceMRU::entryMemory(NumberOfBins);
+    EventWorkspaceMRU::Budget budget(160 * entryMemory);
+    EventWorkspaceMRU first(budget);
+    std::vector<EventList> lists(320);
+    const auto x = makeX();
+    for (size_t i = 0; i < 160; ++i)
+      insert(first, &lists[i], x);
+    TS_ASSERT_EQUALS(first.MRUSize(), 160);
+
+    {
+      EventWorkspaceMRU second(budget);
+      for (size_t i = 160; i < lists.size(); ++i)
+        insert(second, &lists[i], x);
+      // The older histograms of the first cache made room for the second
+      TS_ASSERT_EQUALS(first.MRUSize(), 0);
+      TS_ASSERT_EQUALS(first.statistics().evictions, 160);
+      TS_ASSERT_LESS_THAN_EQUALS(budget.used(), budget.bytes());
+      TS_ASSERT_EQUALS(budget.used(), second.memoryUsed());
+    }
+    // A destroyed cache returns its memory to the budget
+    TS_ASSERT_EQUALS(budget.used(), 0);
+  }
+
+  void test_memoryAvailable_excludes_the_other_caches() {
+    const size_t entryMemory = EventWorkspaceMRU::entryMemory(NumberOfBins);
+    EventWorkspaceMRU::Budget budget(160 * entryMemory);
+    EventWorkspaceMRU first(budget);
+    EventWorkspaceMRU second(budget);
+    TS_ASSERT_EQUALS(first.memoryAvailable(), 150 * entryMemory);
+
+    std::vector<EventList> lists(30);
+    const auto x = makeX();
+    for (size_t i = 0; i < 10; ++i)
+      insert(first, &lists[i], x);
+    for (size_t i = 10; i < lists.size(); ++i)
+      insert(second, &lists[i], x);
+    // The histograms of a cache may be replaced by its own new ones
+    TS_ASSERT_EQUALS(first.memoryAvailable(), 130 * entryMemory);
+    TS_ASSERT_EQUALS(second.memoryAvailable(), 140 * entryMemory);
+  }
+
+  void test_histograms_larger_than_a_shard_are_not_cached() {
+    EventWorkspaceMRU::Budget budget(64 * EventWorkspaceMRU::entryMemory(10));
+    EventWorkspaceMRU mru(budget);
+    EventList list;
+    insert(mru, &list, makeX());
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+  }
+
+  void test_deleteIndex_and_clear() {
+    EventWorkspaceMRU::Budget budget(1 << 20);
+    EventWorkspaceMRU mru(budget);
+    EventList list1, list2;
+    const auto x = makeX();
+    insert(mru, &list1, x);
+    insert(mru, &list2, x);
+    mru.deleteIndex(&list1);
+    TS_ASSERT(!mru.findY(&list1, x));
+    TS_ASSERT(mru.findY(&list2, x));
+    mru.clear();
+    TS_ASSERT_EQUALS(mru.MRUSize(), 0);
+    TS_ASSERT_EQUALS(mru.statistics().memoryUsed, 0);
   }
 };
 
@@ -46,6 +46,8 @@ using Mantid::Types::Event::TofEvent;
 
 class EventWorkspaceTest : public CxxTest::TestSuite {
 private:
+  /// Memory budget of the histogram cache of ew, which it must outlive
+  EventWorkspaceMRU::Budget budget;
   EventWorkspace_sptr ew;
   int NUMPIXELS, NUMBINS, NUMEVENTS, BIN_DELTA;
 
@@ -55,7 +57,7 @@ public:
   static EventWorkspaceTest *createSuite() { return new EventWorkspaceTest(); }
   static void destroySuite(EventWorkspaceTest *suite) { delete suite; }
 
-  EventWorkspaceTest() {
+  EventWorkspaceTest() : budget(64 << 20) {
     NUMPIXELS = 500;
     NUMBINS = 1025;
     NUMEVENTS = 100;
@@ -117,7 +119,10 @@ public:
     return createEventWorkspace(true, true, true);
   }
 
-  void setUp() override { ew = createEventWorkspace(true, true); }
+  void setUp() override {
+    ew = createEventWorkspace(true, true);
+    ew->setMRUBudget(budget);
+  }
 
   void test_constructor() {
     TS_ASSERT_EQUALS(ew->getNumberHistograms(), NUMPIXELS);
@@ -317,6 +322,7 @@ public:
     // Try caching and most-recently-used MRU list.
     EventWorkspace_const_sptr ew2 =
         boost::dynamic_pointer_cast<const EventWorkspace>(ew);
+    const auto before = ew2->MRUStatistics();
 
     // Are the returned arrays the right size?
     MantidVec data1 = ew2->dataY(1);
@@ -329,6 +335,11 @@ public:
     TS_ASSERT_EQUALS(data2.size(), NUMBINS - 1);
     // Still a single cached value
     TS_ASSERT_EQUALS(ew2->MRUSize(), 1);
+    const auto after = ew2->MRUStatistics();
+    TS_ASSERT_EQUALS(after.misses - before.misses, 1);
+    TS_ASSERT_EQUALS(after.hits - before.hits, 1);
+    TS_ASSERT_EQUALS(after.memoryUsed,
+                     EventWorkspaceMRU::entryMemory(NUMBINS - 1));
 
     // All elements are the same
     for (std::size_t i = 0; i < data1.size(); i++)
@@ -342,32 +353,83 @@ public:
     data1 = ew2->dataY(0);
     TS_ASSERT_DELTA(ew2->dataY(0)[1], 2.0, 1e-6);
     TS_ASSERT_DELTA(data1[1], 2.0, 1e-6);
-    // Cache should now be full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    // All the histograms read fit in the memory budget
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 100);
 
     int last = 100;
     // Read more;
     for (int i = last; i < last + 100; i++)
       data1 = ew2->dataY(i);
-
-    // Cache should now be full still
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 200);
 
     // Do it some more
     last = 200;
     for (int i = last; i < last + 100; i++)
       data1 = ew2->dataY(i);
+    TS_ASSERT_EQUALS(ew2->MRUStatistics().evictions, 0);
 
     //----- Now we test that setAllX clears the memory ----
 
-    // Yes, our eventworkspace MRU is full
-    TS_ASSERT_EQUALS(ew->MRUSize(), 50);
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    TS_ASSERT_EQUALS(ew->MRUSize(), 300);
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 300);
     ew->setAllX(BinEdges(10, LinearGenerator(0.0, BIN_DELTA)));
 
     // MRU should have been cleared now
     TS_ASSERT_EQUALS(ew->MRUSize(), 0);
     TS_ASSERT_EQUALS(ew2->MRUSize(), 0);
+    TS_ASSERT_EQUALS(ew2->MRUStatistics().memoryUsed, 0);
+  }
+
+  void test_histogram_cache_is_not_used_after_changing_X() {
+    auto &spectrum = ew->getSpectrum(0);
+    const auto y1 = spectrum.sharedY();
+    TS_ASSERT_EQUALS(spectrum.sharedY(), y1);
+
+    spectrum.setHistogram(BinEdges(10, LinearGenerator(0.0, BIN_DELTA)));
+    const auto y2 = spectrum.sharedY();
+    TS_ASSERT_DIFFERS(y2, y1);
+    TS_ASSERT_EQUALS(y2->size(), 9);
+    TS_ASSERT_EQUALS(ew->MRUSize(), 1);
+  }
+
+  void test_fillMRU() {
+    const auto before = ew->MRUStatistics();
+    ew->fillMRU();
+    TS_ASSERT_EQUALS(ew->MRUSize(), NUMPIXELS);
+    const auto filled = ew->MRUStatistics();
+    TS_ASSERT_EQUALS(filled.misses - before.misses, NUMPIXELS);
+
+    for (int i = 0; i < NUMPIXELS; i++)
+      TS_ASSERT_DELTA(ew->y(i)[1], 2.0, 1e-6);
+    const auto read = ew->MRUStatistics();
+    TS_ASSERT_EQUALS(read.misses, filled.misses);
+    TS_ASSERT_EQUALS(read.hits - filled.hits, NUMPIXELS);
+  }
+
+  void test_fillMRU_stops_at_the_eviction_target() {
+    const size_t entryMemory = EventWorkspaceMRU::entryMemory(NUMBINS - 1);
+    // Evicting leaves 15/16 of the budget, i.e. 120 histograms
+    EventWorkspaceMRU::Budget small(128 * entryMemory);
+    auto ws = createEventWorkspace(true, true);
+    ws->setMRUBudget(small);
+    ws->fillMRU();
+    TS_ASSERT_EQUALS(ws->MRUSize(), 120);
+    TS_ASSERT_EQUALS(ws->MRUStatistics().evictions, 0);
+  }
+
+  void test_fillMRU_leaves_the_histograms_of_other_workspaces() {
+    const size_t entryMemory = EventWorkspaceMRU::entryMemory(NUMBINS - 1);
+    EventWorkspaceMRU::Budget small(128 * entryMemory);
+    auto other = createEventWorkspace(true, true);
+    other->setMRUBudget(small);
+    for (int i = 0; i < 20; i++)
+      other->y(i);
+    auto ws = createEventWorkspace(true, true);
+    ws->setMRUBudget(small);
+    ws->fillMRU();
+    TS_ASSERT_EQUALS(ws->MRUSize(), 100);
+    TS_ASSERT_EQUALS(other->MRUSize(), 20);
+    TS_ASSERT_EQUALS(other->MRUStatistics().evictions, 0);
   }
 
   void test_histogram_cache_dataE() {
@@ -522,8 +584,7 @@ public:
     */
   }
 
-  void test_droppingOffMRU() {
-    // Try caching and most-recently-used MRU list.
+  void test_references_stay_valid_while_reading_other_spectra() {
     EventWorkspace_const_sptr ew2 =
         boost::dynamic_pointer_cast<const EventWorkspace>(ew);
 
@@ -535,16 +596,13 @@ public:
     const MantidVec &e300 = inSpec300.readE();
     TS_ASSERT_EQUALS(data0.size(), NUMBINS - 1);
 
-    // Fill up the MRU to make data0 drop off
     for (size_t i = 0; i < 200; i++)
       MantidVec otherData = ew2->readY(i);
 
-    // data0 and e300 are now invalid references!
-    TS_ASSERT_DIFFERS(&data0, &inSpec.readY());
-    TS_ASSERT_DIFFERS(&e300, &inSpec.readE());
-
-    // MRU is full
-    TS_ASSERT_EQUALS(ew2->MRUSize(), 50);
+    // The histograms are still cached, so the same ones are returned
+    TS_ASSERT_EQUALS(&data0, &inSpec.readY());
+    TS_ASSERT_EQUALS(&e300, &inSpec300.readE());
+    TS_ASSERT_EQUALS(ew2->MRUSize(), 201);
   }
 
   void test_sortAll_TOF() {
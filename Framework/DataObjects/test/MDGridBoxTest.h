@@ -958,6 +958,39 @@ public:
 
   void test_addEvents_inParallel() { do_test_addEvents_inParallel(nullptr); }
 
+  void test_addEventsInParallel_buckets_events_by_child_box() {
+    MDGridBox<MDLeanEvent<2>, 2> *b = MDEventsTestHelper::makeMDGridBox<2>();
+    b->getBoxController()->setAddingEvents_eventsPerTask(10);
+    std::vector<MDLeanEvent<2>> events;
+    for (int i = 0; i < 50; i++) {
+      // Make an event in the middle of each box, plus one on the upper edge
+      for (double x = 0.5; x < 10; x += 1.0)
+        for (double y = 0.5; y < 10; y += 1.0) {
+          coord_t centers[2] = {static_cast<coord_t>(x),
+                                static_cast<coord_t>(y)};
+          events.push_back(MDLeanEvent<2>(float(i), 2.0f, centers));
+        }
+      coord_t edge[2] = {10.0, 9.5};
+      events.push_back(MDLeanEvent<2>(1.0, 1.0, edge));
+    }
+    TS_ASSERT_EQUALS(b->addEventsInParallel(events), events.size());
+
+    b->refreshCache(nullptr);
+    TS_ASSERT_EQUALS(b->getNPoints(), 101 * 50);
+    TS_ASSERT_EQUALS(b->getChild(0)->getNPoints(), 50);
+    TS_ASSERT_EQUALS(b->getChild(99)->getNPoints(), 100);
+    // Each box gets its events in the order they were given
+    auto box = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(b->getChild(5));
+    const auto &boxEvents = box->getConstEvents();
+    for (size_t i = 0; i < boxEvents.size(); i++)
+      TS_ASSERT_EQUALS(boxEvents[i].getSignal(), float(i));
+    box->releaseEvents();
+
+    BoxController *const bcc = b->getBoxController();
+    delete b;
+    delete bcc;
+  }
+
   /** Disabled because parallel RefreshCache is not implemented. Might not be
    * ever? */
   void xtest_addEvents_inParallel_then_refreshCache_inParallel() {
@@ -1105,6 +1138,74 @@ public:
     delete bcc;
   }
 
+  void test_splitAllInParallel() {
+    typedef MDGridBox<MDLeanEvent<2>, 2> gbox_t;
+    typedef MDBoxBase<MDLeanEvent<2>, 2> ibox_t;
+
+    gbox_t *b = MDEventsTestHelper::makeMDGridBox<2>();
+    b->getBoxController()->setSplitThreshold(100);
+    b->getBoxController()->setMaxDepth(4);
+    // Events in all but the last sub-box
+    MDEventsTestHelper::feedMDBox<2>(b, 1000, 10, 0.5, 1.0);
+    auto last = dynamic_cast<MDBox<MDLeanEvent<2>, 2> *>(b->getChild(99));
+    last->clear();
+    b->refreshCache(nullptr);
+
+    b->splitAllInParallel();
+
+    std::vector<ibox_t *> boxes = b->getBoxes();
+    for (size_t i = 0; i < 99; i++) {
+      TS_ASSERT_EQUALS(boxes[i]->getNPoints(), 1000);
+      TS_ASSERT(dynamic_cast<gbox_t *>(boxes[i]));
+    }
+    TS_ASSERT_EQUALS(boxes[0]->getNumChildren(), 100);
+    TS_ASSERT(!dynamic_cast<gbox_t *>(boxes[99]));
+
+    BoxController *const bcc = b->getBoxController();
+    delete b;
+    delete bcc;
+  }
+
+  void test_splitAllInParallel_and_addEventsInParallel_with_one_full_box() {
+    typedef MDGridBox<MDLeanEvent<2>, 2> gbox_t;
+
+    gbox_t *b = MDEventsTestHelper::makeMDGridBox<2>();
+    b->getBoxController()->setSplitThreshold(100);
+    b->getBoxController()->setMaxDepth(4);
+    b->getBoxController()->setAddingEvents_eventsPerTask(10);
+    // All the events are in the first sub-box
+    std::vector<MDLeanEvent<2>> events;
+    for (int i = 0; i < 50; i++)
+      for (int j = 0; j < 50; j++) {
+        coord_t centers[2] = {0.01f + 0.02f * float(i),
+                              0.01f + 0.02f * float(j)};
+        events.push_back(MDLeanEvent<2>(1.0, 1.0, centers));
+      }
+    TS_ASSERT_EQUALS(b->addEventsInParallel(events), events.size());
+    b->splitAllInParallel();
+
+    auto full = dynamic_cast<gbox_t *>(b->getChild(0));
+    TS_ASSERT(full);
+    TS_ASSERT(!dynamic_cast<gbox_t *>(b->getChild(1)));
+
+    // The events are now added through the full box with all threads
+    TS_ASSERT_EQUALS(b->addEventsInParallel(events), events.size());
+    // and serially
+    TS_ASSERT_EQUALS(b->addEventsInParallel(events, 0), events.size());
+    b->splitAllInParallel(0);
+    b->refreshCache(nullptr);
+    TS_ASSERT_EQUALS(b->getNPoints(), 3 * events.size());
+    TS_ASSERT_EQUALS(full->getNumChildren(), 100);
+    for (size_t i = 0; i < full->getNumChildren(); i++) {
+      TS_ASSERT_EQUALS(full->getChild(i)->getNPoints(), 75);
+      TS_ASSERT(!dynamic_cast<gbox_t *>(full->getChild(i)));
+    }
+
+    BoxController *const bcc = b->getBoxController();
+    delete b;
+    delete bcc;
+  }
+
   //------------------------------------------------------------------------------------------------
   /** Helper to make a 2D MDBin */
   MDBin<MDLeanEvent<2>, 2> makeMDBin2(double minX, double maxX, double minY,
@@ -0,0 +1,131 @@
+#ifndef MANTID_DATAOBJECTS_MDHISTOEXPRESSIONTEST_H_
+#define MANTID_DATAOBJECTS_MDHISTOEXPRESSIONTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/MDHistoExpression.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidTestHelpers/MDEventsTestHelper.h"
+
+#include <cmath>
+
+using namespace Mantid::DataObjects;
+using Mantid::DataObjects::MDEventsTestHelper::makeFakeMDHistoWorkspace;
+
+class MDHistoExpressionTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDHistoExpressionTest *createSuite() {
+    return new MDHistoExpressionTest();
+  }
+  static void destroySuite(MDHistoExpressionTest *suite) { delete suite; }
+
+  void test_fused_expression_matches_sequence_of_operations() {
+    // More bins than a single block
+    auto a = makeFakeMDHistoWorkspace(3.0, 2, 100, 10.0, 1.0);
+    auto b = makeFakeMDHistoWorkspace(2.0, 2, 100, 10.0, 2.0);
+    auto c = makeFakeMDHistoWorkspace(4.0, 2, 100, 10.0, 3.0);
+    auto out = makeFakeMDHistoWorkspace(0.0, 2, 100, 10.0, 0.0);
+    auto expected = a->clone();
+    expected->subtract(*b);
+    expected->divide(*c);
+
+    ((MDHistoExpression(*a) - *b) / *c).evaluateInto(*out);
+    for (size_t i = 0; i < out->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(out->getSignalAt(i), expected->getSignalAt(i), 1e-12);
+      TS_ASSERT_DELTA(out->getErrorAt(i), expected->getErrorAt(i), 1e-12);
+      TS_ASSERT_DELTA(out->getNumEventsAt(i), 2.0, 1e-12);
+    }
+    TS_ASSERT_EQUALS(out->getNEvents(), expected->getNEvents());
+  }
+
+  void test_output_may_appear_in_expression() {
+    auto a = makeFakeMDHistoWorkspace(3.0, 2, 5, 10.0, 1.0);
+    auto b = makeFakeMDHistoWorkspace(2.0, 2, 5, 10.0, 1.0);
+    // a = b * a + a, errors: 4 * 1 + 9 * 1 + 1
+    (MDHistoExpression(*b) * *a + *a).evaluateInto(*a);
+    for (size_t i = 0; i < a->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(a->getSignalAt(i), 9.0, 1e-12);
+      TS_ASSERT_DELTA(a->getErrorAt(i), std::sqrt(14.0), 1e-12);
+    }
+  }
+
+  void test_scalars_and_functions() {
+    auto a = makeFakeMDHistoWorkspace(4.0, 1, 10, 10.0, 1.0);
+    auto out = makeFakeMDHistoWorkspace(0.0, 1, 10, 10.0, 0.0);
+    (MDHistoExpression(2.0) * MDHistoExpression(*a).power(0.5) - 1.0)
+        .evaluateInto(*out);
+    // f = sqrt(a), df^2 = f^2 0.25 da^2 / a^2 = 1 / 16, then doubled
+    for (size_t i = 0; i < out->getNPoints(); ++i) {
+      TS_ASSERT_DELTA(out->getSignalAt(i), 3.0, 1e-12);
+      TS_ASSERT_DELTA(out->getErrorAt(i), 0.5, 1e-12);
+    }
+    MDHistoExpression(*a).log(-1.0).evaluateInto(*out);
+    TS_ASSERT_DELTA(out->getSignalAt(0), std::log(4.0), 1e-12);
+    (MDHistoExpression(*a) - 5.0).log(-1.0).evaluateInto(*out);
+    TS_ASSERT_EQUALS(out->getSignalAt(0), -1.0);
+    TS_ASSERT_EQUALS(out->getErrorAt(0), 0.0);
+  }
+
+  void test_boolean_operations_treat_masked_bins_as_false() {
+    auto a = makeFakeMDHistoWorkspace(1.0, 1, 4, 10.0, 1.0);
+    auto b = makeFakeMDHistoWorkspace(0.0, 1, 4, 10.0, 1.0);
+    auto out = makeFakeMDHistoWorkspace(0.0, 1, 4, 10.0, 1.0);
+    a->setMDMaskAt(1, true);
+    b->setSignalAt(2, 5.0);
+
+    (MDHistoExpression(*a) | *b).evaluateInto(*out);
+    TS_ASSERT_EQUALS(out->getSignalAt(0), 1.0);
+    TS_ASSERT_EQUALS(out->getSignalAt(1), 0.0);
+    TS_ASSERT_EQUALS(out->getSignalAt(2), 1.0);
+    TS_ASSERT_EQUALS(out->getErrorAt(0), 0.0);
+    // The mask follows the left hand side
+    TS_ASSERT(out->getIsMaskedAt(1));
+
+    (MDHistoExpression(*a) & !MDHistoExpression(*b)).evaluateInto(*out);
+    TS_ASSERT_EQUALS(out->getSignalAt(0), 1.0);
+    TS_ASSERT_EQUALS(out->getSignalAt(1), 0.0);
+    TS_ASSERT_EQUALS(out->getSignalAt(2), 0.0);
+
+    MDHistoExpression(*b).greaterThan(*a).evaluateInto(*out);
+    TS_ASSERT_EQUALS(out->getSignalAt(0), 0.0);
+    TS_ASSERT_EQUALS(out->getSignalAt(2), 1.0);
+  }
+
+  void test_mismatched_sizes_throw() {
+    auto a = makeFakeMDHistoWorkspace(1.0, 1, 4);
+    auto b = makeFakeMDHistoWorkspace(1.0, 1, 5);
+    TS_ASSERT_THROWS(MDHistoExpression(*a) + *b, std::invalid_argument);
+    TS_ASSERT_THROWS((MDHistoExpression(*a) + 1.0).evaluateInto(*b),
+                     std::invalid_argument);
+  }
+};
+
+class MDHistoExpressionTestPerformance : public CxxTest::TestSuite {
+public:
+  static MDHistoExpressionTestPerformance *createSuite() {
+    return new MDHistoExpressionTestPerformance();
+  }
+  static void destroySuite(MDHistoExpressionTestPerformance *suite) {
+    delete suite;
+  }
+
+  MDHistoExpressionTestPerformance()
+      : a(makeFakeMDHistoWorkspace(3.0, 3, 100)),
+        b(makeFakeMDHistoWorkspace(2.0, 3, 100)),
+        c(makeFakeMDHistoWorkspace(4.0, 3, 100)),
+        out(makeFakeMDHistoWorkspace(0.0, 3, 100)) {}
+
+  void test_fused_expression() {
+    ((MDHistoExpression(*a) - *b) / *c * 2.0 + 1.0).evaluateInto(*out);
+  }
+
+private:
+  MDHistoWorkspace_sptr a;
+  MDHistoWorkspace_sptr b;
+  MDHistoWorkspace_sptr c;
+  MDHistoWorkspace_sptr out;
+};
+
+#endif /* MANTID_DATAOBJECTS_MDHISTOEXPRESSIONTEST_H_ */
@@ -0,0 +1,182 @@
+#ifndef MANTID_DATAOBJECTS_SPECTRUMGROUPINGTEST_H_
+#define MANTID_DATAOBJECTS_SPECTRUMGROUPINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidDataObjects/EventWorkspace.h"
+#include "MantidDataObjects/SpectrumGrouping.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidTestHelpers/WorkspaceCreationHelper.h"
+
+#include <cmath>
+#include <numeric>
+
+using namespace Mantid::DataObjects;
+using Mantid::Types::Event::TofEvent;
+
+namespace {
+/// One group of all the indices below size, then {3, 4}
+SpectrumGrouping makeGrouping(const size_t size) {
+  std::vector<size_t> all(size);
+  std::iota(all.begin(), all.end(), 0);
+  return SpectrumGrouping({all, {3, 4}});
+}
+} // namespace
+
+class SpectrumGroupingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static SpectrumGroupingTest *createSuite() {
+    return new SpectrumGroupingTest();
+  }
+  static void destroySuite(SpectrumGroupingTest *suite) { delete suite; }
+
+  void test_groups_are_stored_one_after_the_other() {
+    SpectrumGrouping grouping({{4, 2}, {}, {7}});
+    grouping.addGroup({1, 0});
+    TS_ASSERT_EQUALS(grouping.numberOfGroups(), 4);
+    TS_ASSERT_EQUALS(grouping.indices(),
+                     std::vector<size_t>({4, 2, 7, 1, 0}));
+    TS_ASSERT_EQUALS(grouping.groupBegin(2), 2);
+    TS_ASSERT_EQUALS(grouping.groupEnd(2), 3);
+    TS_ASSERT_EQUALS(grouping.groupSize(0), 2);
+    TS_ASSERT_EQUALS(grouping.groupSize(1), 0);
+    TS_ASSERT_EQUALS(grouping.groupSize(3), 2);
+  }
+
+  void test_large_groups_are_split_evenly_into_chunks() {
+    SpectrumGrouping grouping({std::vector<size_t>(450), {}, {5, 6}});
+    const auto chunks = grouping.chunks(200);
+    TS_ASSERT_EQUALS(chunks.size(), 4);
+    for (size_t i = 0; i < 3; ++i) {
+      TS_ASSERT_EQUALS(chunks[i].group, 0);
+      TS_ASSERT_EQUALS(chunks[i].begin, 150 * i);
+      TS_ASSERT_EQUALS(chunks[i].end, 150 * (i + 1));
+      TS_ASSERT(!grouping.isWholeGroup(chunks[i]));
+    }
+    // The empty group has no chunk
+    TS_ASSERT_EQUALS(chunks[3].group, 2);
+    TS_ASSERT_EQUALS(chunks[3].begin, 450);
+    TS_ASSERT_EQUALS(chunks[3].end, 452);
+    TS_ASSERT(grouping.isWholeGroup(chunks[3]));
+    TS_ASSERT_THROWS(grouping.chunks(0), std::invalid_argument);
+  }
+
+  void test_sumHistograms() {
+    using WorkspaceCreationHelper::create2DWorkspaceWhereYIsWorkspaceIndex;
+    auto input = create2DWorkspaceWhereYIsWorkspaceIndex(500, 3);
+    for (size_t i = 0; i < 500; ++i)
+      input->getSpectrum(i).setDetectorID(static_cast<int>(i));
+    auto output = WorkspaceCreationHelper::create2DWorkspace(2, 3);
+
+    makeGrouping(500).sumHistograms(*input, *output);
+
+    const double errorSquared = input->e(0)[0] * input->e(0)[0];
+    for (size_t bin = 0; bin < 3; ++bin) {
+      TS_ASSERT_DELTA(output->y(0)[bin], 124750.0, 1e-8);
+      TS_ASSERT_DELTA(output->e(0)[bin], std::sqrt(500. * errorSquared),
+                      1e-8);
+      TS_ASSERT_DELTA(output->y(1)[bin], 7.0, 1e-8);
+      TS_ASSERT_DELTA(output->e(1)[bin], std::sqrt(2. * errorSquared), 1e-8);
+    }
+    TS_ASSERT_EQUALS(output->getSpectrum(0).getDetectorIDs().size(), 500);
+    TS_ASSERT_EQUALS(output->getSpectrum(1).getDetectorIDs(),
+                     std::set<Mantid::detid_t>({3, 4}));
+  }
+
+  void test_sumHistograms_throws_if_the_binning_differs() {
+    auto input = WorkspaceCreationHelper::create2DWorkspace(5, 3);
+    auto output = WorkspaceCreationHelper::create2DWorkspace(2, 4);
+    TS_ASSERT_THROWS(makeGrouping(5).sumHistograms(*input, *output),
+                     std::invalid_argument);
+  }
+
+  void test_concatenateEvents_keeps_the_order_of_the_spectra() {
+    auto input = WorkspaceCreationHelper::createEventWorkspace(500, 10);
+    EventWorkspace output;
+    output.initialize(2, 2, 1);
+
+    makeGrouping(500).concatenateEvents(*input, output);
+
+    const auto &all = output.getSpectrum(0);
+    TS_ASSERT_EQUALS(all.getNumberEvents(), 500 * 100);
+    TS_ASSERT_EQUALS(all.getSortType(), UNSORTED);
+    TS_ASSERT_EQUALS(all.getDetectorIDs().size(), 500);
+    const auto &events = all.getEvents();
+    for (size_t i = 0; i < 500; i += 123) {
+      const auto &expected = input->getSpectrum(i).getEvents();
+      TS_ASSERT(std::equal(expected.begin(), expected.end(),
+                           events.begin() + 100 * i));
+    }
+    TS_ASSERT_EQUALS(output.getSpectrum(1).getNumberEvents(), 200);
+    TS_ASSERT_EQUALS(output.getSpectrum(1).getDetectorIDs(),
+                     std::set<Mantid::detid_t>({3, 4}));
+  }
+
+  void test_moveEvents_clears_the_input() {
+    auto input = WorkspaceCreationHelper::createEventWorkspace(500, 10);
+    const auto expected = input->getSpectrum(450).getEvents();
+    EventWorkspace output;
+    output.initialize(2, 2, 1);
+    std::vector<size_t> first(400);
+    std::iota(first.begin(), first.end(), 0);
+    std::vector<size_t> second(100);
+    std::iota(second.begin(), second.end(), 400);
+
+    SpectrumGrouping({first, second}).moveEvents(*input, output);
+
+    TS_ASSERT_EQUALS(output.getSpectrum(0).getNumberEvents(), 400 * 100);
+    TS_ASSERT_EQUALS(output.getSpectrum(0).getDetectorIDs().size(), 400);
+    TS_ASSERT_EQUALS(output.getSpectrum(1).getNumberEvents(), 100 * 100);
+    const auto &events = output.getSpectrum(1).getEvents();
+    TS_ASSERT(
+        std::equal(expected.begin(), expected.end(), events.begin() + 5000));
+    TS_ASSERT_EQUALS(input->getNumberEvents(), 0);
+  }
+
+  void test_joinEvents_converts_to_the_common_event_type() {
+    std::vector<EventList> parts(3);
+    parts[0] += TofEvent(1.0);
+    parts[0].setDetectorID(1);
+    parts[1] += TofEvent(2.0);
+    parts[1] += TofEvent(3.0);
+    parts[1].switchTo(Mantid::API::WEIGHTED_NOTIME);
+    parts[1].setDetectorID(2);
+    parts[2] += TofEvent(4.0);
+    EventList output;
+    output += TofEvent(0.0);
+
+    SpectrumGrouping::joinEvents(parts.begin(), parts.end(), output);
+
+    TS_ASSERT_EQUALS(output.getEventType(), Mantid::API::WEIGHTED_NOTIME);
+    const auto &events = output.getWeightedEventsNoTime();
+    TS_ASSERT_EQUALS(events.size(), 5);
+    for (size_t i = 0; i < events.size(); ++i)
+      TS_ASSERT_EQUALS(events[i].tof(), static_cast<double>(i));
+    TS_ASSERT_EQUALS(output.getDetectorIDs(),
+                     std::set<Mantid::detid_t>({1, 2}));
+    for (const auto &part : parts)
+      TS_ASSERT(part.empty());
+  }
+
+  void test_joinEvents_into_an_empty_list_keeps_the_order() {
+    std::vector<EventList> parts(3);
+    for (size_t i = 0; i < parts.size(); ++i) {
+      parts[i] += TofEvent(static_cast<double>(2 * i));
+      parts[i] += TofEvent(static_cast<double>(2 * i + 1));
+    }
+    EventList output;
+
+    SpectrumGrouping::joinEvents(parts.begin(), parts.end(), output);
+
+    const auto &events = output.getEvents();
+    TS_ASSERT_EQUALS(events.size(), 6);
+    for (size_t i = 0; i < events.size(); ++i)
+      TS_ASSERT_EQUALS(events[i].tof(), static_cast<double>(i));
+    for (const auto &part : parts)
+      TS_ASSERT(part.empty());
+  }
+};
+
+#endif /* MANTID_DATAOBJECTS_SPECTRUMGROUPINGTEST_H_ */
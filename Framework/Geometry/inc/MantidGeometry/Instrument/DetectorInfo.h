@@ -114,6 +114,8 @@ public:
   Kernel::V3D samplePosition() const;
   double l1() const;
 
+  std::pair<size_t, size_t> geometryVersion() const;
+
   const std::vector<detid_t> &detectorIDs() const;
   /// Returns the index of the detector with the given detector ID.
   /// This will throw an out of range exception if the detector does not exist.
@@ -0,0 +1,70 @@
+#ifndef MANTID_GEOMETRY_DETECTORSOLIDANGLES_H_
+#define MANTID_GEOMETRY_DETECTORSOLIDANGLES_H_
+
+#include "MantidGeometry/DllConfig.h"
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+class V3D;
+}
+namespace Geometry {
+class ComponentInfo;
+
+/** DetectorSolidAngles : Computes the solid angle subtended by every
+  detector of an instrument at an observer, usually the sample.
+
+  The values are indexed by detector index. Detectors sharing a shape are
+  evaluated together so that the (lazy) preparation of the shape happens once
+  before the parallel loop over the detectors. The results are kept in a
+  small in-memory cache keyed by the detector geometry (positions, rotations,
+  scale factors and shapes) and the observer position, so that repeated
+  normalisations on an unchanged instrument do not recompute them. A hash of
+  the geometry selects the candidate entries, which are only reused if their
+  whole geometry is equal.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_GEOMETRY_DLL DetectorSolidAngles {
+public:
+  DetectorSolidAngles(const ComponentInfo &componentInfo,
+                      const Kernel::V3D &observer);
+  /// Solid angle of the detector with the given detector index
+  double operator[](const size_t detectorIndex) const {
+    return (*m_solidAngles)[detectorIndex];
+  }
+  /// Number of detectors
+  size_t size() const { return m_solidAngles->size(); }
+
+  static void clearCache();
+
+private:
+  std::shared_ptr<const std::vector<double>> m_solidAngles;
+};
+
+} // namespace Geometry
+} // namespace Mantid
+
+#endif /* MANTID_GEOMETRY_DETECTORSOLIDANGLES_H_ */
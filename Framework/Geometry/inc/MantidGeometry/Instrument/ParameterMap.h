@@ -9,7 +9,10 @@
 
 #include "tbb/concurrent_unordered_map.h"
 
+#include <atomic>
 #include <memory>
+#include <mutex>
+#include <unordered_map>
 #include <vector>
 #include <typeinfo>
 
@@ -108,12 +111,15 @@ public:
   /// Clears the map
   inline void clear() {
     m_map.clear();
+    ++m_version;
     clearPositionSensitiveCaches();
   }
   /// method swaps two parameter maps contents  each other. All caches contents
   /// is nullified (TO DO: it can be efficiently swapped too)
   void swap(ParameterMap &other) {
     m_map.swap(other.m_map);
+    ++m_version;
+    ++other.m_version;
     clearPositionSensitiveCaches();
   }
   /// Clear any parameters with the given name
@@ -238,6 +244,9 @@ public:
   /// a parameter with a specified type.
   boost::shared_ptr<Parameter>
   getRecursiveByType(const IComponent *comp, const std::string &type) const;
+  /// Look up a numeric parameter recursively for all detectors at once
+  boost::shared_ptr<const std::vector<double>>
+  getDetectorColumn(const std::string &name) const;
 
   /** Get the values of a given parameter of all the components that have the
    * name: compName
@@ -372,6 +381,16 @@ private:
   /// internal cache map instance for cached rotation values
   std::unique_ptr<Kernel::Cache<const ComponentID, Kernel::Quat>> m_cacheRotMap;
 
+  /// Incremented whenever parameters are added or removed
+  std::atomic<size_t> m_version{0};
+  /// Columns returned by getDetectorColumn() and the m_version they were built
+  /// at
+  mutable std::unordered_map<
+      std::string,
+      std::pair<size_t, boost::shared_ptr<const std::vector<double>>>>
+      m_detectorColumns;
+  mutable std::mutex m_detectorColumnsMutex;
+
   /// Pointer to the DetectorInfo wrapper. NULL unless the instrument is
   /// associated with an ExperimentInfo object.
   std::unique_ptr<Geometry::DetectorInfo> m_detectorInfo;
@@ -5,10 +5,9 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Objects/BoundingBox.h"
-#include <boost/unordered_map.hpp>
 #include <deque>
-#include <list>
-#include <mutex>
+#include <memory>
+#include <vector>
 
 namespace Mantid {
 namespace Kernel {
@@ -26,6 +25,13 @@ This class is responsible for tracking rays and accumulating a list of objects
 that are
 intersected along the way.
 
+Each assembly of the instrument is expanded, the first time a ray reaches it,
+into a flat bounding volume hierarchy over the boxes of its children. Later
+rays only test the boxes along their path and call interceptSurface on the
+objects whose box they cross. Tracing a caller-owned Track is safe from several
+threads; the trace()/getResults() pair that accumulates the results within
+the tracer is not.
+
 @author Martyn Gigg, Tessella plc
 @date 22/10/2010
 
@@ -54,17 +60,26 @@ class MANTID_GEOMETRY_DLL InstrumentRayTracer {
 public:
   /// Constructor taking an instrument
   InstrumentRayTracer(Instrument_const_sptr instrument);
+  ~InstrumentRayTracer();
   /// Trace a given track from the instrument source in the given direction
   /// and compile a list of results that this track intersects.
   void trace(const Kernel::V3D &dir) const;
   void traceFromSample(const Kernel::V3D &dir) const;
+  /// Trace a track through the instrument, accumulating the results in it
+  void trace(Track &track) const;
+  /// Trace a track from the sample position, accumulating the results in it
+  void traceFromSample(const Kernel::V3D &dir, Track &track) const;
+  /// Trace several tracks through the instrument in parallel
+  void trace(std::vector<Track> &tracks) const;
   /// Get the results of the intersection tests that have been updated
   /// since the previous call to trace
   Links getResults() const;
 
   IDetector_const_sptr getDetectorResult() const;
+  IDetector_const_sptr getDetectorResult(const Track &track) const;
 
 private:
+  struct AssemblyNode;
   /// Default constructor
   InstrumentRayTracer();
   /// Fire the given track at the instrument
@@ -75,10 +90,8 @@ private:
   /// Accumulate results in this Track object, aids performance. This is cleared
   /// when getResults is called.
   mutable Track m_resultsTrack;
-  /// Map of component id -> bounding box.
-  mutable boost::unordered_map<IComponent *, BoundingBox> m_boxCache;
-  /// Mutex to lock box cache
-  mutable std::mutex m_mutex;
+  /// The root of the hierarchy of bounding volumes
+  std::unique_ptr<AssemblyNode> m_root;
 };
 }
 }
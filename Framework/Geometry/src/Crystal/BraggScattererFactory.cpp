@@ -32,7 +32,8 @@ BraggScatterer_sptr BraggScattererFactoryImpl::createScatterer(
 }
 
 /// Private constructor.
-BraggScattererFactoryImpl::BraggScattererFactoryImpl() {
+BraggScattererFactoryImpl::BraggScattererFactoryImpl()
+    : Kernel::DynamicFactory<BraggScatterer>("BraggScatterer") {
   Kernel::LibraryManager::Instance();
 }
 
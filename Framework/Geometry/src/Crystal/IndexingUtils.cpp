@@ -2,8 +2,10 @@
 #include "MantidGeometry/Crystal/NiggliCell.h"
 #include "MantidKernel/Quat.h"
 #include "MantidKernel/EigenConversionHelpers.h"
+#include "MantidKernel/MultiThreaded.h"
 #include <algorithm>
 #include <cmath>
+#include <numeric>
 #include <boost/math/special_functions/round.hpp>
 #include <boost/numeric/conversion/cast.hpp>
 #include <stdexcept>
@@ -27,8 +29,198 @@ using Mantid::Kernel::Quat;
 namespace {
 const constexpr double DEG_TO_RAD = M_PI / 180.;
 const constexpr double RAD_TO_DEG = 180. / M_PI;
+
+/// Layout of one ring of constant latitude produced by
+/// IndexingUtils::MakeHemisphereDirections
+struct HemisphereRing {
+  /// Index of the first direction of the ring in the full list
+  size_t offset;
+  /// Number of directions stored for this ring
+  int n_theta;
+  /// Angular step between directions of this ring, in radians
+  double theta_step;
+  /// True for the equator, where only half of the circle is stored
+  bool half_circle;
+};
+
+/**
+  Describe the rings of the hemisphere generated by MakeHemisphereDirections
+  so that directions can be located by their (phi, theta) angles without a
+  search. This must mirror the construction in MakeHemisphereDirections.
+
+  @param n_steps  The number of subdivisions in latitude.
+  @return The list of rings, ordered by latitude index.
+ */
+std::vector<HemisphereRing> makeHemisphereRings(int n_steps) {
+  std::vector<HemisphereRing> rings;
+  rings.reserve(n_steps + 1);
+  const double angle_step = M_PI / (2 * n_steps);
+  size_t offset = 0;
+  for (int iPhi = 0; iPhi < n_steps + 1; ++iPhi) {
+    const double phi = static_cast<double>(iPhi) * angle_step;
+    int n_theta = boost::math::iround(2. * M_PI * sin(phi) / angle_step);
+    double theta_step;
+    if (n_theta == 0) {
+      theta_step = 2. * M_PI + 1.;
+      n_theta = 1;
+    } else {
+      theta_step = 2. * M_PI / static_cast<double>(n_theta);
+    }
+    const bool half_circle = fabs(phi - M_PI / 2.) < angle_step / 2.;
+    if (half_circle)
+      n_theta /= 2;
+    rings.push_back({offset, n_theta, theta_step, half_circle});
+    offset += static_cast<size_t>(n_theta);
+  }
+  return rings;
 }
 
+/**
+  Flag all directions of a hemisphere that lie within the specified angular
+  radius of the given direction, or of its negative, since a direction and
+  its negative give the same projection magnitudes.
+
+  @param rings      The ring layout of the hemisphere, from makeHemisphereRings
+  @param n_steps    The number of subdivisions in latitude of the hemisphere.
+  @param direction  Unit vector around which directions are selected.
+  @param radius     The angular radius of the neighbourhood, in radians.
+  @param selected   Flags, one per hemisphere direction, set to 1 for the
+                    directions in the neighbourhood.
+ */
+void selectNeighbourhood(const std::vector<HemisphereRing> &rings,
+                         int n_steps, const V3D &direction, double radius,
+                         std::vector<char> &selected) {
+  const double angle_step = M_PI / (2 * n_steps);
+  for (const double sign : {1.0, -1.0}) {
+    const V3D axis = direction * sign;
+    const double phi = acos(std::max(-1.0, std::min(1.0, axis.Y())));
+    if (phi - radius > M_PI / 2. + angle_step)
+      continue;
+    double theta = atan2(axis.Z(), axis.X());
+    if (theta < 0)
+      theta += 2. * M_PI;
+
+    const int first_ring =
+        std::max(0, static_cast<int>(floor((phi - radius) / angle_step)));
+    const int last_ring = std::min(
+        n_steps, static_cast<int>(ceil((phi + radius) / angle_step)));
+    for (int iPhi = first_ring; iPhi <= last_ring; ++iPhi) {
+      const auto &ring = rings[iPhi];
+      const double ring_phi = static_cast<double>(iPhi) * angle_step;
+      // half of the range of theta on this ring within the given radius
+      double half_width = M_PI;
+      const double denominator = sin(phi) * sin(ring_phi);
+      if (denominator > 0) {
+        const double cos_width =
+            (cos(radius) - cos(phi) * cos(ring_phi)) / denominator;
+        if (cos_width > 1.)
+          continue;
+        if (cos_width > -1.)
+          half_width = acos(cos_width);
+      }
+      if (half_width >= M_PI || ring.n_theta == 1) {
+        std::fill_n(selected.begin() + ring.offset, ring.n_theta, 1);
+        continue;
+      }
+      const int first = static_cast<int>(floor((theta - half_width) /
+                                               ring.theta_step));
+      const int last =
+          static_cast<int>(ceil((theta + half_width) / ring.theta_step));
+      for (int j = first; j <= last; ++j) {
+        int jTheta = j;
+        if (ring.half_circle) {
+          // the other half of the equator is covered by the negative
+          if (jTheta < 0 || jTheta >= ring.n_theta)
+            continue;
+        } else {
+          jTheta = ((jTheta % ring.n_theta) + ring.n_theta) % ring.n_theta;
+        }
+        selected[ring.offset + jTheta] = 1;
+      }
+    }
+  }
+}
+
+/**
+  Fill projections[] with the histogram of the projections of the q vectors
+  on the specified direction and magnitude_fft[] with the magnitude of its
+  FFT. The q vectors must already be divided by 2*PI.
+
+  @return The largest value in magnitude_fft[] at index 5 or more.
+ */
+double magFFTOfScaledQs(const std::vector<V3D> &scaled_qs,
+                        const V3D &current_dir, const size_t N,
+                        double projections[], double index_factor,
+                        double magnitude_fft[]) {
+  std::fill_n(projections, N, 0.0);
+  // project onto direction
+  for (const auto &q_vec : scaled_qs) {
+    double dot_prod = current_dir.scalar_prod(q_vec);
+    size_t index = static_cast<size_t>(fabs(index_factor * dot_prod));
+    if (index < N)
+      projections[index] += 1;
+    else
+      projections[N - 1] += 1; // This should not happen, but trap it in
+  }                            // case of rounding errors.
+
+  // get the |FFT|
+  gsl_fft_real_radix2_transform(projections, 1, N);
+  for (size_t i = 1; i < N / 2; i++) {
+    magnitude_fft[i] = sqrt(projections[i] * projections[i] +
+                            projections[N - i] * projections[N - i]);
+  }
+
+  magnitude_fft[0] = fabs(projections[0]);
+
+  size_t dc_end = 5; // we may need a better estimate of this
+  double max_mag_fft = 0.0;
+  for (size_t i = dc_end; i < N / 2; i++)
+    if (magnitude_fft[i] > max_mag_fft)
+      max_mag_fft = magnitude_fft[i];
+
+  return max_mag_fft;
+}
+
+/**
+  Calculate the maximum |FFT| of the projections of the q vectors on each of
+  the selected directions. The selected directions are split into one
+  contiguous block per thread, and each thread reuses its own projection and
+  FFT buffers for all of the directions in its block.
+
+  @param scaled_qs     The q vectors, divided by 2*PI.
+  @param directions    The list of directions.
+  @param selection     Indices of the directions to evaluate.
+  @param N             The number of points in each FFT. Must be a power of 2.
+  @param index_factor  Factor mapping a projected q to an index in the FFT.
+  @param max_fft_val   Set to the maximum |FFT| beyond DC for the selected
+                       directions. Other entries are left untouched.
+ */
+void scanDirectionsFFT(const std::vector<V3D> &scaled_qs,
+                       const std::vector<V3D> &directions,
+                       const std::vector<size_t> &selection, const size_t N,
+                       double index_factor, std::vector<double> &max_fft_val) {
+  const auto n_selected = static_cast<int64_t>(selection.size());
+  PARALLEL {
+    const auto threadCount = PARALLEL_NUMBER_OF_THREADS;
+    const auto currentThreadNum = PARALLEL_THREAD_NUMBER;
+    const int64_t blocksize = n_selected / threadCount;
+    const int64_t start = currentThreadNum * blocksize;
+    const int64_t end = currentThreadNum == threadCount - 1
+                            ? n_selected
+                            : start + blocksize;
+    std::vector<double> projections(N);
+    std::vector<double> magnitude_fft(N / 2);
+    for (int64_t i = start; i < end; ++i) {
+      const size_t dir_num = selection[i];
+      max_fft_val[dir_num] =
+          magFFTOfScaledQs(scaled_qs, directions[dir_num], N,
+                           projections.data(), index_factor,
+                           magnitude_fft.data());
+    }
+  }
+}
+} // namespace
+
 /**
   STATIC method Find_UB: Calculates the matrix that most nearly indexes
   the specified q_vectors, given the lattice parameters.  The sum of the
@@ -1060,6 +1252,10 @@ double IndexingUtils::ScanFor_UB(DblMatrix &UB,
    will consist of vectors, V, for which V dot Q is essentially an integer for
    the most Q vectors.  The difference between V dot Q and an integer must be
    less than the required tolerance for it to count as an integer.
+     The directions are scanned in parallel.  If the requested resolution is
+   much finer than the angular width of the FFT peak for the longest allowed
+   edge, a coarser hemisphere is scanned first and only the neighbourhoods
+   of the directions with large FFT values are scanned at full resolution.
     @param  directions          Vector that will be filled with the directions
                                 that may correspond to unit cell edges.
     @param  q_vectors           Vector of new Vector3D objects that contains
@@ -1182,6 +1378,10 @@ size_t IndexingUtils::ScanFor_Directions(std::vector<V3D> &directions,
    will consist of vectors, V, for which V dot Q is essentially an integer for
    the most Q vectors.  The difference between V dot Q and an integer must be
    less than the required tolerance for it to count as an integer.
+     The directions are scanned in parallel.  If the requested resolution is
+   much finer than the angular width of the FFT peak for the longest allowed
+   edge, a coarser hemisphere is scanned first and only the neighbourhoods
+   of the directions with large FFT values are scanned at full resolution.
     @param  directions          Vector that will be filled with the directions
                                 that may correspond to unit cell edges.
     @param  q_vectors           Vector of new Vector3D objects that contains
@@ -1228,34 +1428,63 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
 
   max_mag_Q *= 1.1f; // allow for a little "headroom" for FFT range
 
+  std::vector<V3D> scaled_qs;
+  scaled_qs.reserve(q_vectors.size());
+  for (const auto &q_vector : q_vectors)
+    scaled_qs.push_back(q_vector / (2.0 * M_PI));
+
   // apply the FFT to each of the directions, and
   // keep track of their maximum magnitude past DC
   double max_mag_fft;
-  std::vector<double> max_fft_val;
-  max_fft_val.resize(full_list.size());
-
-  double projections[N_FFT_STEPS];
-  double magnitude_fft[HALF_FFT_STEPS];
+  std::vector<double> max_fft_val(full_list.size(), 0.0);
 
   double index_factor = N_FFT_STEPS / max_mag_Q; // maps |proj Q| to index
 
-  for (size_t dir_num = 0; dir_num < full_list.size(); dir_num++) {
-    V3D current_dir = full_list[dir_num];
-    max_mag_fft = GetMagFFT(q_vectors, current_dir, N_FFT_STEPS, projections,
-                            index_factor, magnitude_fft);
-
-    max_fft_val[dir_num] = max_mag_fft;
+  // The peak in |FFT| for a cell edge of length max_d is roughly
+  // 1/(max_d * max_mag_Q) radians wide. If the requested step is much finer
+  // than that, first scan a coarser hemisphere and only scan the fine
+  // hemisphere around the directions that stand out.
+  const double coarse_degrees_per_step =
+      0.5 * RAD_TO_DEG / (max_d * max_mag_Q);
+  std::vector<size_t> selection;
+  if (coarse_degrees_per_step >= 2.0 * degrees_per_step) {
+    int coarse_steps = boost::math::iround(90.0 / coarse_degrees_per_step);
+    std::vector<V3D> coarse_list = MakeHemisphereDirections(coarse_steps);
+    std::vector<size_t> coarse_selection(coarse_list.size());
+    std::iota(coarse_selection.begin(), coarse_selection.end(), 0);
+    std::vector<double> coarse_fft_val(coarse_list.size(), 0.0);
+    scanDirectionsFFT(scaled_qs, coarse_list, coarse_selection, N_FFT_STEPS,
+                      index_factor, coarse_fft_val);
+
+    // the coarse grid samples the peaks off centre, so keep a generous
+    // fraction of the largest value
+    const double coarse_threshold =
+        0.25 *
+        *std::max_element(coarse_fft_val.begin(), coarse_fft_val.end());
+    const double radius = M_PI / (2 * coarse_steps);
+    const auto rings = makeHemisphereRings(num_steps);
+    std::vector<char> selected(full_list.size(), 0);
+    for (size_t i = 0; i < coarse_list.size(); i++) {
+      if (coarse_fft_val[i] >= coarse_threshold)
+        selectNeighbourhood(rings, num_steps, coarse_list[i], radius,
+                            selected);
+    }
+    for (size_t i = 0; i < selected.size(); i++) {
+      if (selected[i] != 0)
+        selection.push_back(i);
+    }
+  } else {
+    selection.resize(full_list.size());
+    std::iota(selection.begin(), selection.end(), 0);
   }
+  scanDirectionsFFT(scaled_qs, full_list, selection, N_FFT_STEPS,
+                    index_factor, max_fft_val);
+
   // find the directions with the 500 largest
   // fft values, and place them in temp_dirs vector
   int N_TO_TRY = 500;
 
-  std::vector<double> max_fft_copy;
-  max_fft_copy.resize(full_list.size());
-  for (size_t i = 0; i < max_fft_copy.size(); i++) {
-    max_fft_copy[i] = max_fft_val[i];
-  }
-
+  std::vector<double> max_fft_copy(max_fft_val);
   std::sort(max_fft_copy.begin(), max_fft_copy.end());
 
   size_t index = max_fft_copy.size() - 1;
@@ -1278,23 +1507,27 @@ size_t IndexingUtils::FFTScanFor_Directions(std::vector<V3D> &directions,
   // FFT to find the cell edge length that
   // corresponds to the max_mag_fft.  Only keep
   // directions with length nearly in bounds
-  V3D temp;
-  std::vector<V3D> temp_dirs_2;
-
-  for (auto &temp_dir : temp_dirs) {
-    GetMagFFT(q_vectors, temp_dir, N_FFT_STEPS, projections, index_factor,
-              magnitude_fft);
+  std::vector<double> d_vals(temp_dirs.size(), -1.0);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int i = 0; i < static_cast<int>(temp_dirs.size()); ++i) {
+    double projections[N_FFT_STEPS];
+    double magnitude_fft[HALF_FFT_STEPS];
+    magFFTOfScaledQs(scaled_qs, temp_dirs[i], N_FFT_STEPS, projections,
+                     index_factor, magnitude_fft);
 
     double position = GetFirstMaxIndex(magnitude_fft, N_FFT_STEPS, threshold);
     if (position > 0) {
       double q_val = max_mag_Q / position;
-      double d_val = 1 / q_val;
-      if (d_val >= 0.8 * min_d && d_val <= 1.2 * max_d) {
-        temp = temp_dir * d_val;
-        temp_dirs_2.push_back(temp);
-      }
+      d_vals[i] = 1 / q_val;
     }
   }
+
+  std::vector<V3D> temp_dirs_2;
+  for (size_t i = 0; i < temp_dirs.size(); i++) {
+    const double d_val = d_vals[i];
+    if (d_val >= 0.8 * min_d && d_val <= 1.2 * max_d)
+      temp_dirs_2.push_back(temp_dirs[i] * d_val);
+  }
   // look at how many peaks were indexed
   // for each of the initial directions
   max_indexed = 0;
@@ -1399,37 +1632,13 @@ double IndexingUtils::GetMagFFT(const std::vector<V3D> &q_vectors,
                                 const V3D &current_dir, const size_t N,
                                 double projections[], double index_factor,
                                 double magnitude_fft[]) {
-  for (size_t i = 0; i < N; i++) {
-    projections[i] = 0.0;
-  }
-  // project onto direction
-  V3D q_vec;
-  for (const auto &q_vector : q_vectors) {
-    q_vec = q_vector / (2.0 * M_PI);
-    double dot_prod = current_dir.scalar_prod(q_vec);
-    size_t index = static_cast<size_t>(fabs(index_factor * dot_prod));
-    if (index < N)
-      projections[index] += 1;
-    else
-      projections[N - 1] += 1; // This should not happen, but trap it in
-  }                            // case of rounding errors.
+  std::vector<V3D> scaled_qs;
+  scaled_qs.reserve(q_vectors.size());
+  for (const auto &q_vector : q_vectors)
+    scaled_qs.push_back(q_vector / (2.0 * M_PI));
 
-  // get the |FFT|
-  gsl_fft_real_radix2_transform(projections, 1, N);
-  for (size_t i = 1; i < N / 2; i++) {
-    magnitude_fft[i] = sqrt(projections[i] * projections[i] +
-                            projections[N - i] * projections[N - i]);
-  }
-
-  magnitude_fft[0] = fabs(projections[0]);
-
-  size_t dc_end = 5; // we may need a better estimate of this
-  double max_mag_fft = 0.0;
-  for (size_t i = dc_end; i < N / 2; i++)
-    if (magnitude_fft[i] > max_mag_fft)
-      max_mag_fft = magnitude_fft[i];
-
-  return max_mag_fft;
+  return magFFTOfScaledQs(scaled_qs, current_dir, N, projections, index_factor,
+                          magnitude_fft);
 }
 
 /**
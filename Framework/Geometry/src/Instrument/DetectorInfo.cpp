@@ -315,6 +315,13 @@ Kernel::V3D DetectorInfo::samplePosition() const {
 /// Returns L1 (distance from source to sample).
 double DetectorInfo::l1() const { return m_detectorInfo->l1(); }
 
+/** Returns a version that changes whenever the position or rotation of any
+ * detector, the source or the sample changes. See
+ * Beamline::DetectorInfo::geometryVersion(). */
+std::pair<size_t, size_t> DetectorInfo::geometryVersion() const {
+  return m_detectorInfo->geometryVersion();
+}
+
 /// Returns a sorted vector of all detector IDs.
 const std::vector<detid_t> &DetectorInfo::detectorIDs() const {
   return *m_detectorIDs;
@@ -0,0 +1,235 @@
+#include "MantidGeometry/Instrument/DetectorSolidAngles.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Objects/BoundingBox.h"
+#include "MantidGeometry/Objects/IObject.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Quat.h"
+#include "MantidKernel/V3D.h"
+
+#include <boost/functional/hash.hpp>
+
+#include <limits>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace Mantid {
+namespace Geometry {
+using Kernel::V3D;
+
+namespace {
+/// The definition of a detector shape
+struct ShapeKey {
+  std::string xml;
+  V3D minPoint;
+  V3D maxPoint;
+};
+
+/// The placement of one detector; shape indexes GeometryKey::shapes
+struct DetectorKey {
+  V3D position;
+  V3D scaleFactor;
+  Kernel::Quat rotation;
+  size_t shape;
+};
+
+/// Exact comparison: the tolerant V3D and Quat operators would let moved
+/// detectors match
+bool same(const V3D &lhs, const V3D &rhs) {
+  return lhs.X() == rhs.X() && lhs.Y() == rhs.Y() && lhs.Z() == rhs.Z();
+}
+
+bool same(const Kernel::Quat &lhs, const Kernel::Quat &rhs) {
+  for (int j = 0; j < 4; ++j)
+    if (lhs[j] != rhs[j])
+      return false;
+  return true;
+}
+
+/// Everything the solid angles of the detectors depend on
+struct GeometryKey {
+  V3D observer;
+  std::vector<ShapeKey> shapes;
+  std::vector<DetectorKey> detectors;
+
+  bool operator==(const GeometryKey &other) const {
+    if (!same(observer, other.observer) ||
+        shapes.size() != other.shapes.size() ||
+        detectors.size() != other.detectors.size())
+      return false;
+    for (size_t i = 0; i < shapes.size(); ++i) {
+      const auto &lhs = shapes[i];
+      const auto &rhs = other.shapes[i];
+      if (lhs.xml != rhs.xml || !same(lhs.minPoint, rhs.minPoint) ||
+          !same(lhs.maxPoint, rhs.maxPoint))
+        return false;
+    }
+    for (size_t i = 0; i < detectors.size(); ++i) {
+      const auto &lhs = detectors[i];
+      const auto &rhs = other.detectors[i];
+      if (lhs.shape != rhs.shape || !same(lhs.position, rhs.position) ||
+          !same(lhs.scaleFactor, rhs.scaleFactor) ||
+          !same(lhs.rotation, rhs.rotation))
+        return false;
+    }
+    return true;
+  }
+};
+
+/// Solid angles computed for one geometry
+struct CacheEntry {
+  size_t hash;
+  std::shared_ptr<const GeometryKey> key;
+  std::shared_ptr<const std::vector<double>> solidAngles;
+};
+
+/// Marks a detector without a valid shape in DetectorKey::shape
+const size_t NO_SHAPE = std::numeric_limits<size_t>::max();
+/// Maximum number of sets of solid angles kept for reuse
+const size_t MAX_CACHED_ENTRIES = 4;
+/// Guards access to the cache
+std::mutex g_cacheMutex;
+/// Most recently used sets of solid angles, at the front
+std::list<CacheEntry> g_cache;
+
+/// Number of detectors, which come first in the component indices
+size_t numberOfDetectors(const ComponentInfo &componentInfo) {
+  size_t nDetectors(0);
+  while (nDetectors < componentInfo.size() &&
+         componentInfo.isDetector(nDetectors))
+    ++nDetectors;
+  return nDetectors;
+}
+
+void hashVector(size_t &seed, const V3D &vec) {
+  boost::hash_combine(seed, vec.X());
+  boost::hash_combine(seed, vec.Y());
+  boost::hash_combine(seed, vec.Z());
+}
+
+/**
+ * Collect everything the solid angles of the detectors depend on
+ * @param componentInfo :: The instrument
+ * @param nDetectors :: The number of detectors
+ * @param observer :: The observer position
+ * @return The key
+ */
+std::shared_ptr<GeometryKey> geometryKey(const ComponentInfo &componentInfo,
+                                         const size_t nDetectors,
+                                         const V3D &observer) {
+  auto key = std::make_shared<GeometryKey>();
+  key->observer = observer;
+  key->detectors.reserve(nDetectors);
+  std::unordered_map<const IObject *, size_t> shapeIndices;
+  for (size_t i = 0; i < nDetectors; ++i) {
+    size_t shapeIndex = NO_SHAPE;
+    if (componentInfo.hasValidShape(i)) {
+      const auto &shape = componentInfo.shape(i);
+      auto found = shapeIndices.find(&shape);
+      if (found == shapeIndices.end()) {
+        const auto &box = shape.getBoundingBox();
+        key->shapes.push_back(
+            {shape.getShapeXML(), box.minPoint(), box.maxPoint()});
+        found = shapeIndices.emplace(&shape, key->shapes.size() - 1).first;
+      }
+      shapeIndex = found->second;
+    }
+    key->detectors.push_back({componentInfo.position(i),
+                              componentInfo.scaleFactor(i),
+                              componentInfo.rotation(i), shapeIndex});
+  }
+  return key;
+}
+
+/// @return The hash of a key, used to skip most comparisons of whole keys
+size_t geometryHash(const GeometryKey &key) {
+  size_t seed(key.detectors.size());
+  hashVector(seed, key.observer);
+  for (const auto &shape : key.shapes) {
+    boost::hash_combine(seed, shape.xml);
+    hashVector(seed, shape.minPoint);
+    hashVector(seed, shape.maxPoint);
+  }
+  for (const auto &detector : key.detectors) {
+    boost::hash_combine(seed, detector.shape);
+    hashVector(seed, detector.position);
+    hashVector(seed, detector.scaleFactor);
+    for (int j = 0; j < 4; ++j)
+      boost::hash_combine(seed, detector.rotation[j]);
+  }
+  return seed;
+}
+
+/**
+ * Compute the solid angle of every detector
+ * @param componentInfo :: The instrument
+ * @param nDetectors :: The number of detectors
+ * @param observer :: The observer position
+ * @return The solid angles, indexed by detector index
+ */
+std::shared_ptr<const std::vector<double>>
+computeSolidAngles(const ComponentInfo &componentInfo, const size_t nDetectors,
+                   const V3D &observer) {
+  auto solidAngles = std::make_shared<std::vector<double>>(nDetectors, 0.0);
+  // Shapes prepare their geometry (bounding box, triangulation) on first
+  // use. Evaluate one detector per shape serially so that the detectors
+  // sharing that shape can then be processed in parallel.
+  std::vector<char> done(nDetectors, 0);
+  std::unordered_map<const IObject *, size_t> firstUse;
+  for (size_t i = 0; i < nDetectors; ++i) {
+    if (componentInfo.hasValidShape(i) &&
+        firstUse.emplace(&componentInfo.shape(i), i).second) {
+      (*solidAngles)[i] = componentInfo.solidAngle(i, observer);
+      done[i] = 1;
+    }
+  }
+  const auto nDets = static_cast<int64_t>(nDetectors);
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nDets; ++i) {
+    const auto index = static_cast<size_t>(i);
+    if (!done[index] && componentInfo.hasValidShape(index))
+      (*solidAngles)[index] = componentInfo.solidAngle(index, observer);
+  }
+  return solidAngles;
+}
+} // namespace
+
+/**
+ * Constructor. The solid angles are taken from the cache if they have been
+ * computed before for the same geometry, otherwise they are computed now.
+ * Detectors without a valid shape are given a solid angle of zero.
+ * @param componentInfo :: The ComponentInfo of the instrument
+ * @param observer :: The position from which the solid angles are seen
+ */
+DetectorSolidAngles::DetectorSolidAngles(const ComponentInfo &componentInfo,
+                                         const Kernel::V3D &observer) {
+  const size_t nDetectors = numberOfDetectors(componentInfo);
+  const auto key = geometryKey(componentInfo, nDetectors, observer);
+  const size_t hash = geometryHash(*key);
+  {
+    std::lock_guard<std::mutex> lock(g_cacheMutex);
+    for (auto it = g_cache.begin(); it != g_cache.end(); ++it) {
+      if (it->hash == hash && *it->key == *key) {
+        m_solidAngles = it->solidAngles;
+        g_cache.splice(g_cache.begin(), g_cache, it);
+        return;
+      }
+    }
+  }
+  m_solidAngles = computeSolidAngles(componentInfo, nDetectors, observer);
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.push_front({hash, key, m_solidAngles});
+  if (g_cache.size() > MAX_CACHED_ENTRIES)
+    g_cache.pop_back();
+}
+
+/// Discard all cached solid angles
+void DetectorSolidAngles::clearCache() {
+  std::lock_guard<std::mutex> lock(g_cacheMutex);
+  g_cache.clear();
+}
+
+} // namespace Geometry
+} // namespace Mantid
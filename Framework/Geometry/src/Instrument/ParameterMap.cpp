@@ -8,8 +8,11 @@
 #include "MantidGeometry/Instrument.h"
 #include "MantidGeometry/Instrument/ParameterFactory.h"
 #include <cstring>
+#include <functional>
+#include <limits>
 #include <nexus/NeXusFile.hpp>
 #include <boost/algorithm/string.hpp>
+#include <boost/make_shared.hpp>
 
 #ifdef _WIN32
 #define strcasecmp _stricmp
@@ -51,6 +54,15 @@ void checkIsNotMaskingParameter(const std::string &name) {
     throw std::runtime_error("Masking data (\"masked\") cannot be stored in "
                              "ParameterMap. Use DetectorInfo instead");
 }
+
+/// Returns the value of a double or int parameter, NaN for other types
+double numericValue(Parameter &param) {
+  if (param.type() == DOUBLE_PARAM_NAME)
+    return param.value<double>();
+  if (param.type() == INT_PARAM_NAME)
+    return static_cast<double>(param.value<int>());
+  return std::numeric_limits<double>::quiet_NaN();
+}
 }
 /**
  * Default constructor
@@ -296,6 +308,7 @@ const std::string ParameterMap::diff(const ParameterMap &rhs,
  */
 void ParameterMap::clearParametersByName(const std::string &name) {
   checkIsNotMaskingParameter(name);
+  ++m_version;
   // Key is component ID so have to search through whole lot
   for (auto itr = m_map.begin(); itr != m_map.end();) {
     if (itr->second->name() == name) {
@@ -318,6 +331,7 @@ void ParameterMap::clearParametersByName(const std::string &name,
                                          const IComponent *comp) {
   checkIsNotMaskingParameter(name);
   if (!m_map.empty()) {
+    ++m_version;
     const ComponentID id = comp->getComponentID();
     auto itrs = m_map.equal_range(id);
     for (auto it = itrs.first; it != itrs.second;) {
@@ -380,6 +394,7 @@ void ParameterMap::add(const IComponent *comp,
   // However, this is old behavior and many things rely on this actually be
   // an
   // add/replace-style function
+  ++m_version;
   if (existing_par != m_map.end()) {
     boost::atomic_store(&(existing_par->second), par);
   } else {
@@ -955,6 +970,70 @@ Parameter_sptr ParameterMap::getRecursive(const IComponent *comp,
   return result;
 }
 
+/**
+ * Look up a numeric parameter for all detectors, as getRecursive() would for
+ * each of them.
+ *
+ * Inheritance is resolved once for each component of the instrument rather
+ * than once per detector, and the column is cached until parameters are added
+ * or removed. Changing the value of a Parameter obtained from get() in place
+ * does not invalidate the cache.
+ * @param name :: Parameter name
+ * @returns the values indexed by detector index. Int parameters are converted
+ * to double. Entries are NaN for detectors for which the parameter is not
+ * found or is not of type double or int.
+ * @throw std::runtime_error if the map is not associated with an instrument
+ */
+boost::shared_ptr<const std::vector<double>>
+ParameterMap::getDetectorColumn(const std::string &name) const {
+  checkIsNotMaskingParameter(name);
+  const size_t version = m_version;
+  {
+    std::lock_guard<std::mutex> lock(m_detectorColumnsMutex);
+    const auto it = m_detectorColumns.find(name);
+    if (it != m_detectorColumns.end() && it->second.first == version)
+      return it->second.second;
+  }
+
+  const auto &compInfo = componentInfo();
+  const size_t numberOfDetectors = detectorInfo().size();
+  const double nan = std::numeric_limits<double>::quiet_NaN();
+  const auto ownValue = [this, &compInfo, &name](const size_t index,
+                                                 double &value) {
+    const auto param = get(compInfo.componentID(index), name.c_str(), "");
+    if (param)
+      value = numericValue(*param);
+    return static_cast<bool>(param);
+  };
+
+  // Resolve assemblies first, starting from the root as needed. There are
+  // typically far fewer of these than detectors.
+  std::vector<double> assemblyValues(compInfo.size(), nan);
+  std::vector<char> resolved(compInfo.size(), 0);
+  std::function<double(size_t)> resolve = [&](const size_t index) {
+    if (!resolved[index]) {
+      if (!ownValue(index, assemblyValues[index]) && compInfo.hasParent(index))
+        assemblyValues[index] = resolve(compInfo.parent(index));
+      resolved[index] = 1;
+    }
+    return assemblyValues[index];
+  };
+  for (size_t index = numberOfDetectors; index < compInfo.size(); ++index)
+    resolve(index);
+
+  auto column = boost::make_shared<std::vector<double>>(numberOfDetectors, nan);
+  auto &values = *column;
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < static_cast<int64_t>(numberOfDetectors); ++i) {
+    if (!ownValue(i, values[i]) && compInfo.hasParent(i))
+      values[i] = assemblyValues[compInfo.parent(i)];
+  }
+
+  std::lock_guard<std::mutex> lock(m_detectorColumnsMutex);
+  m_detectorColumns[name] = std::make_pair(version, column);
+  return column;
+}
+
 /**
  * Return the value of a parameter as a string
  * @param comp :: Component to which parameter is related
@@ -1078,6 +1157,7 @@ void ParameterMap::copyFromParameterMap(const IComponent *oldComp,
                                         const ParameterMap *oldPMap) {
 
   auto oldParameterNames = oldPMap->names(oldComp);
+  ++m_version;
   for (const auto &oldParameterName : oldParameterNames) {
     Parameter_sptr thisParameter = oldPMap->get(oldComp, oldParameterName);
 // Insert the fetched parameter in the m_map
@@ -1211,6 +1291,7 @@ void ParameterMap::setInstrument(const Instrument *instrument) {
     throw std::logic_error("ParameterMap::setInstrument must be called with "
                            "base instrument, not a parametrized instrument");
   m_instrument = instrument;
+  ++m_version;
   std::tie(m_componentInfo, m_detectorInfo) = m_instrument->makeBeamline(*this);
 }
 
@@ -1183,57 +1183,17 @@ CSGObject::CuboidSolidAngle(const V3D observer,
   // ordering of points the "away facing" triangles give -ve contributions to
   // the
   // solid angle and hence are ignored.
-  std::vector<V3D> pts;
-  pts.reserve(8);
-  Kernel::V3D dx = vectors[1] - vectors[0];
-  Kernel::V3D dz = vectors[3] - vectors[0];
-  pts.push_back(vectors[2]);
-  pts.push_back(vectors[2] + dx);
-  pts.push_back(vectors[1]);
-  pts.push_back(vectors[0]);
-  pts.push_back(vectors[2] + dz);
-  pts.push_back(vectors[2] + dz + dx);
-  pts.push_back(vectors[1] + dz);
-  pts.push_back(vectors[0] + dz);
+  const Kernel::V3D dx = vectors[1] - vectors[0];
+  const Kernel::V3D dz = vectors[3] - vectors[0];
+  const std::array<V3D, 8> pts = {{vectors[2], vectors[2] + dx, vectors[1],
+                                   vectors[0], vectors[2] + dz,
+                                   vectors[2] + dz + dx, vectors[1] + dz,
+                                   vectors[0] + dz}};
 
   const unsigned int ntriangles(12);
-  std::vector<std::vector<int>> triMap(ntriangles, std::vector<int>(3, 0));
-  triMap[0][0] = 1;
-  triMap[0][1] = 4;
-  triMap[0][2] = 3;
-  triMap[1][0] = 3;
-  triMap[1][1] = 2;
-  triMap[1][2] = 1;
-  triMap[2][0] = 5;
-  triMap[2][1] = 6;
-  triMap[2][2] = 7;
-  triMap[3][0] = 7;
-  triMap[3][1] = 8;
-  triMap[3][2] = 5;
-  triMap[4][0] = 1;
-  triMap[4][1] = 2;
-  triMap[4][2] = 6;
-  triMap[5][0] = 6;
-  triMap[5][1] = 5;
-  triMap[5][2] = 1;
-  triMap[6][0] = 2;
-  triMap[6][1] = 3;
-  triMap[6][2] = 7;
-  triMap[7][0] = 7;
-  triMap[7][1] = 6;
-  triMap[7][2] = 2;
-  triMap[8][0] = 3;
-  triMap[8][1] = 4;
-  triMap[8][2] = 8;
-  triMap[9][0] = 8;
-  triMap[9][1] = 7;
-  triMap[9][2] = 3;
-  triMap[10][0] = 1;
-  triMap[10][1] = 5;
-  triMap[10][2] = 8;
-  triMap[11][0] = 8;
-  triMap[11][1] = 4;
-  triMap[11][2] = 1;
+  static const int triMap[ntriangles][3] = {
+      {1, 4, 3}, {3, 2, 1}, {5, 6, 7}, {7, 8, 5}, {1, 2, 6}, {6, 5, 1},
+      {2, 3, 7}, {7, 6, 2}, {3, 4, 8}, {8, 7, 3}, {1, 5, 8}, {8, 4, 1}};
   double sangle = 0.0;
   for (unsigned int i = 0; i < ntriangles; i++) {
     double sa =
@@ -1278,38 +1238,35 @@ double CSGObject::CylinderSolidAngle(const V3D &observer,
   Kernel::V3D final_axis = axis_direction;
   Kernel::Quat transform(initial_axis, final_axis);
 
-  // Do the base cap which is a point at the centre and nslices points around it
+  // The points around the base of the cylinder. Those of the other stacks are
+  // the same points shifted along the axis, so each side of the cylinder is
+  // summed stack by stack from one pair of rotated base points.
   const int nslices(Mantid::Geometry::Cylinder::g_nslices);
   const double angle_step = 2 * M_PI / static_cast<double>(nslices);
+  const auto basePoint = [&](const int sl) {
+    Kernel::V3D pt(radius * std::cos(angle_step * sl),
+                   radius * std::sin(angle_step * sl), 0.0);
+    transform.rotate(pt);
+    return pt + centre;
+  };
 
   const int nstacks(Mantid::Geometry::Cylinder::g_nstacks);
   const double z_step = height / nstacks;
-  double z0(0.0), z1(z_step);
   double solid_angle(0.0);
-  for (int st = 1; st <= nstacks; ++st) {
-    if (st == nstacks)
-      z1 = height;
-
-    for (int sl = 0; sl < nslices; ++sl) {
-      double x = radius * std::cos(angle_step * sl);
-      double y = radius * std::sin(angle_step * sl);
-      Kernel::V3D pt1 = Kernel::V3D(x, y, z0);
-      Kernel::V3D pt2 = Kernel::V3D(x, y, z1);
-      int vertex = (sl + 1) % nslices;
-      x = radius * std::cos(angle_step * vertex);
-      y = radius * std::sin(angle_step * vertex);
-      Kernel::V3D pt3 = Kernel::V3D(x, y, z0);
-      Kernel::V3D pt4 = Kernel::V3D(x, y, z1);
-      // Rotations
-      transform.rotate(pt1);
-      transform.rotate(pt3);
-      transform.rotate(pt2);
-      transform.rotate(pt4);
-
-      pt1 += centre;
-      pt2 += centre;
-      pt3 += centre;
-      pt4 += centre;
+  Kernel::V3D first = basePoint(0);
+  Kernel::V3D second;
+  for (int sl = 0; sl < nslices; ++sl) {
+    second = basePoint((sl + 1) % nslices);
+    double z0(0.0), z1(z_step);
+    for (int st = 1; st <= nstacks; ++st) {
+      if (st == nstacks)
+        z1 = height;
+      const Kernel::V3D offset0 = axis_direction * z0;
+      const Kernel::V3D offset1 = axis_direction * z1;
+      const Kernel::V3D pt1 = first + offset0;
+      const Kernel::V3D pt2 = first + offset1;
+      const Kernel::V3D pt3 = second + offset0;
+      const Kernel::V3D pt4 = second + offset1;
 
       double sa = getTriangleSolidAngle(pt1, pt4, pt3, observer);
       if (sa > 0.0) {
@@ -1319,9 +1276,10 @@ double CSGObject::CylinderSolidAngle(const V3D &observer,
       if (sa > 0.0) {
         solid_angle += sa;
       }
+      z0 = z1;
+      z1 += z_step;
     }
-    z0 = z1;
-    z1 += z_step;
+    first = second;
   }
 
   return solid_angle;
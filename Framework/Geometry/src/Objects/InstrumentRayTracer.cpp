@@ -4,17 +4,269 @@
 #include "MantidGeometry/Objects/InstrumentRayTracer.h"
 #include "MantidGeometry/Objects/Track.h"
 #include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidGeometry/Instrument/RectangularDetector.h"
 #include "MantidGeometry/IComponent.h"
+#include "MantidGeometry/IObjComponent.h"
 #include "MantidKernel/V3D.h"
 #include "MantidKernel/Exception.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/Tolerance.h"
+#include "MantidKernel/make_unique.h"
+#include <algorithm>
+#include <array>
+#include <cmath>
 #include <deque>
 #include <iterator>
+#include <limits>
+#include <mutex>
 
 namespace Mantid {
 namespace Geometry {
 
 using Kernel::V3D;
 
+namespace {
+/// Axis-aligned box stored as xmin, ymin, zmin, xmax, ymax, zmax
+using Box = std::array<double, 6>;
+
+/// Maximum number of children tested together at a leaf of a hierarchy
+const size_t MAX_LEAF_SIZE = 4;
+
+/// Serializes the expansion of assemblies. Components cache their bounding
+/// boxes without locking so they must not be asked for them concurrently.
+std::mutex g_expandMutex;
+
+/// Grow a box to include another
+void growBox(Box &box, const Box &other) {
+  for (size_t i = 0; i < 3; ++i) {
+    box[i] = std::min(box[i], other[i]);
+    box[i + 3] = std::max(box[i + 3], other[i + 3]);
+  }
+}
+
+/// An empty box that any other box can be grown from
+Box emptyBox() {
+  const double inf = std::numeric_limits<double>::infinity();
+  return {{inf, inf, inf, -inf, -inf, -inf}};
+}
+
+/**
+ * Test whether a half-line crosses a box, using the slab method. Unlike
+ * BoundingBox::doesLineIntersect the comparisons are inclusive so that
+ * touching boxes are never skipped.
+ * @param box :: The box
+ * @param start :: The start of the line
+ * @param dir :: The direction of the line
+ * @return True if the line crosses the box or starts inside it
+ */
+bool lineCrossesBox(const Box &box, const V3D &start, const V3D &dir) {
+  double tmin(0.0);
+  double tmax(std::numeric_limits<double>::infinity());
+  for (size_t i = 0; i < 3; ++i) {
+    if (std::abs(dir[i]) < Kernel::Tolerance) {
+      if (start[i] < box[i] || start[i] > box[i + 3])
+        return false;
+      continue;
+    }
+    double t1 = (box[i] - start[i]) / dir[i];
+    double t2 = (box[i + 3] - start[i]) / dir[i];
+    if (t1 > t2)
+      std::swap(t1, t2);
+    tmin = std::max(tmin, t1);
+    tmax = std::min(tmax, t2);
+    if (tmin > tmax)
+      return false;
+  }
+  return true;
+}
+} // namespace
+
+/**
+ * An assembly of the instrument. On first use its children are collected and
+ * a bounding volume hierarchy is built over their boxes. Child assemblies are
+ * expanded in the same way when a ray first reaches them.
+ */
+struct InstrumentRayTracer::AssemblyNode {
+  /// How a ray is intersected with a child
+  enum class ChildType { Object, Assembly, RectangularDetector };
+
+  struct Child {
+    ChildType type;
+    Box box;
+    /// Keeps the (possibly parametrized) component alive
+    IComponent_const_sptr component;
+    /// Set for ChildType::Object
+    const IObjComponent *object = nullptr;
+    /// Set for ChildType::RectangularDetector
+    const ICompAssembly *detector = nullptr;
+    /// Set for ChildType::Assembly
+    std::unique_ptr<AssemblyNode> assembly;
+  };
+
+  /// A node of the hierarchy. Leaves refer to a range of m_order, inner
+  /// nodes have their first child next to them and the second at secondChild.
+  struct HierarchyNode {
+    Box box;
+    size_t firstChild;
+    size_t childCount;
+    size_t secondChild;
+  };
+
+  explicit AssemblyNode(ICompAssembly_const_sptr assembly)
+      : m_assembly(std::move(assembly)) {}
+
+  void intersect(Track &track) const;
+
+private:
+  void expand() const;
+  size_t build(size_t begin, size_t end) const;
+
+  ICompAssembly_const_sptr m_assembly;
+  mutable std::once_flag m_expanded;
+  mutable std::vector<Child> m_children;
+  mutable std::vector<size_t> m_order;
+  mutable std::vector<HierarchyNode> m_hierarchy;
+};
+
+/**
+ * Collect the children of the assembly with their boxes and build the
+ * hierarchy over them. Children without a box or a shape cannot be hit.
+ */
+void InstrumentRayTracer::AssemblyNode::expand() const {
+  const int nchildren = m_assembly->nelements();
+  m_children.reserve(nchildren);
+  for (int i = 0; i < nchildren; ++i) {
+    IComponent_const_sptr comp = m_assembly->getChild(i);
+    Child child;
+    if (auto childAssembly =
+            boost::dynamic_pointer_cast<const ICompAssembly>(comp)) {
+      if (boost::dynamic_pointer_cast<const RectangularDetector>(comp)) {
+        child.type = ChildType::RectangularDetector;
+        child.detector = childAssembly.get();
+      } else {
+        child.type = ChildType::Assembly;
+        child.assembly = Kernel::make_unique<AssemblyNode>(childAssembly);
+      }
+    } else if (auto object =
+                   boost::dynamic_pointer_cast<const IObjComponent>(comp)) {
+      if (!object->shape())
+        continue;
+      child.type = ChildType::Object;
+      child.object = object.get();
+    } else {
+      continue;
+    }
+    BoundingBox bbox;
+    comp->getBoundingBox(bbox);
+    if (bbox.isNull())
+      continue;
+    const double pad = Kernel::Tolerance;
+    child.box = {{bbox.xMin() - pad, bbox.yMin() - pad, bbox.zMin() - pad,
+                  bbox.xMax() + pad, bbox.yMax() + pad, bbox.zMax() + pad}};
+    child.component = std::move(comp);
+    m_children.push_back(std::move(child));
+  }
+  m_order.resize(m_children.size());
+  for (size_t i = 0; i < m_order.size(); ++i)
+    m_order[i] = i;
+  if (!m_children.empty()) {
+    m_hierarchy.reserve(2 * m_children.size() / MAX_LEAF_SIZE + 1);
+    build(0, m_children.size());
+  }
+}
+
+/**
+ * Build the hierarchy over m_order[begin, end) by splitting at the median
+ * centre along the longest axis of the centres.
+ * @param begin :: First position in m_order
+ * @param end :: One past the last position in m_order
+ * @return The index of the new node in m_hierarchy
+ */
+size_t InstrumentRayTracer::AssemblyNode::build(const size_t begin,
+                                                const size_t end) const {
+  const size_t nodeIndex = m_hierarchy.size();
+  m_hierarchy.push_back(HierarchyNode{emptyBox(), begin, end - begin, 0});
+  Box centres = emptyBox();
+  for (size_t i = begin; i < end; ++i) {
+    const Box &box = m_children[m_order[i]].box;
+    growBox(m_hierarchy[nodeIndex].box, box);
+    const Box centre = {{0.5 * (box[0] + box[3]), 0.5 * (box[1] + box[4]),
+                         0.5 * (box[2] + box[5]), 0.5 * (box[0] + box[3]),
+                         0.5 * (box[1] + box[4]), 0.5 * (box[2] + box[5])}};
+    growBox(centres, centre);
+  }
+  if (end - begin <= MAX_LEAF_SIZE)
+    return nodeIndex;
+
+  size_t axis(0);
+  for (size_t i = 1; i < 3; ++i) {
+    if (centres[i + 3] - centres[i] > centres[axis + 3] - centres[axis])
+      axis = i;
+  }
+  const size_t middle = begin + (end - begin) / 2;
+  std::nth_element(m_order.begin() + begin, m_order.begin() + middle,
+                   m_order.begin() + end, [this, axis](size_t a, size_t b) {
+                     const Box &boxA = m_children[a].box;
+                     const Box &boxB = m_children[b].box;
+                     return boxA[axis] + boxA[axis + 3] <
+                            boxB[axis] + boxB[axis + 3];
+                   });
+  m_hierarchy[nodeIndex].childCount = 0;
+  build(begin, middle);
+  const size_t second = build(middle, end);
+  m_hierarchy[nodeIndex].secondChild = second;
+  return nodeIndex;
+}
+
+/**
+ * Intersect a track with the children of this assembly whose boxes it
+ * crosses, accumulating the results in the track.
+ * @param track :: The track
+ */
+void InstrumentRayTracer::AssemblyNode::intersect(Track &track) const {
+  std::call_once(m_expanded, [this]() {
+    std::lock_guard<std::mutex> lock(g_expandMutex);
+    expand();
+  });
+  if (m_hierarchy.empty())
+    return;
+
+  const V3D &start = track.startPoint();
+  const V3D &dir = track.direction();
+  std::vector<size_t> stack(1, 0);
+  while (!stack.empty()) {
+    const auto &node = m_hierarchy[stack.back()];
+    const size_t nodeIndex = stack.back();
+    stack.pop_back();
+    if (!lineCrossesBox(node.box, start, dir))
+      continue;
+    if (node.childCount == 0) {
+      stack.push_back(node.secondChild);
+      stack.push_back(nodeIndex + 1);
+      continue;
+    }
+    for (size_t i = node.firstChild; i < node.firstChild + node.childCount;
+         ++i) {
+      const Child &child = m_children[m_order[i]];
+      if (node.childCount > 1 && !lineCrossesBox(child.box, start, dir))
+        continue;
+      switch (child.type) {
+      case ChildType::Object:
+        child.object->interceptSurface(track);
+        break;
+      case ChildType::Assembly:
+        child.assembly->intersect(track);
+        break;
+      case ChildType::RectangularDetector: {
+        std::deque<IComponent_const_sptr> unused;
+        child.detector->testIntersectionWithChildren(track, unused);
+        break;
+      }
+      }
+    }
+  }
+}
+
 //-------------------------------------------------------------
 // Public member functions
 //-------------------------------------------------------------
@@ -39,8 +291,12 @@ InstrumentRayTracer::InstrumentRayTracer(Instrument_const_sptr instrument)
                            "no defined source.\n";
     throw std::invalid_argument(errorMsg);
   }
+  m_root = Kernel::make_unique<AssemblyNode>(m_instrument);
 }
 
+/// Destructor
+InstrumentRayTracer::~InstrumentRayTracer() = default;
+
 /**
  * Trace a given track from the instrument source in the given direction. For
  * performance reasons the
@@ -73,6 +329,41 @@ void InstrumentRayTracer::traceFromSample(const V3D &dir) const {
   fireRay(m_resultsTrack);
 }
 
+/**
+ * Trace a track through the instrument. The intersections are accumulated in
+ * the track itself so that this may be called from several threads at once.
+ * @param track :: The track to trace. Intersections are added to it.
+ */
+void InstrumentRayTracer::trace(Track &track) const { fireRay(track); }
+
+/**
+ * Trace a track from the sample position in the given direction. The
+ * intersections are accumulated in the track itself so that this may be
+ * called from several threads at once.
+ * @param dir :: A directional vector. The starting point is defined by
+ * the instrument sample.
+ * @param track :: The track to reset and trace. Intersections from previous
+ * traces are cleared.
+ */
+void InstrumentRayTracer::traceFromSample(const V3D &dir, Track &track) const {
+  track.reset(m_instrument->getSample()->getPos(), dir);
+  track.clearIntersectionResults();
+  fireRay(track);
+}
+
+/**
+ * Trace several tracks through the instrument, sharing the hierarchy of
+ * bounding volumes between threads.
+ * @param tracks :: The tracks to trace. Intersections are added to each.
+ */
+void InstrumentRayTracer::trace(std::vector<Track> &tracks) const {
+  const auto ntracks = static_cast<int64_t>(tracks.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < ntracks; ++i) {
+    fireRay(tracks[static_cast<size_t>(i)]);
+  }
+}
+
 /**
  * Return the results of any trace() calls since the last call the getResults.
  * @returns A collection of links defining intersection information
@@ -89,11 +380,21 @@ Links InstrumentRayTracer::getResults() const {
  * @return sptr to IDetector, or an invalid sptr if not found
  */
 IDetector_const_sptr InstrumentRayTracer::getDetectorResult() const {
-  Links results = this->getResults();
+  auto det = getDetectorResult(m_resultsTrack);
+  m_resultsTrack.clearIntersectionResults();
+  return det;
+}
 
+/** Returns the first detector (that is NOT a monitor) intersected by a track
+ * traced by the caller.
+ * @param track :: A track passed to trace() or traceFromSample()
+ * @return sptr to IDetector, or an invalid sptr if not found
+ */
+IDetector_const_sptr
+InstrumentRayTracer::getDetectorResult(const Track &track) const {
   // Go through all results
-  Links::const_iterator resultItr = results.begin();
-  for (; resultItr != results.end(); ++resultItr) {
+  auto resultItr = track.cbegin();
+  for (; resultItr != track.cend(); ++resultItr) {
     IComponent_const_sptr component =
         m_instrument->getComponentByID(resultItr->componentID);
     IDetector_const_sptr det =
@@ -111,46 +412,14 @@ IDetector_const_sptr InstrumentRayTracer::getDetectorResult() const {
 // Private member functions
 //-------------------------------------------------------------
 /**
- * Fire the test ray at the instrument and perform a bread-first search of the
- * object tree to find the objects that were intersected.
+ * Fire the test ray at the instrument and find the objects that were
+ * intersected, descending only into the boxes the ray crosses.
  * @param testRay :: An input/output parameter that defines the track and
  * accumulates the
  *        intersection results
  */
 void InstrumentRayTracer::fireRay(Track &testRay) const {
-  // Go through the instrument tree and see if we get any hits by
-  // (a) first testing the bounding box and if we're inside that then
-  // (b) test the lower components.
-  std::deque<IComponent_const_sptr> nodeQueue;
-
-  // Start at the root of the tree
-  nodeQueue.push_back(m_instrument);
-
-  IComponent_const_sptr node;
-  while (!nodeQueue.empty()) {
-    node = nodeQueue.front();
-    nodeQueue.pop_front();
-    BoundingBox bbox;
-    auto it = m_boxCache.find(node->getComponentID());
-    if (it != m_boxCache.end()) {
-      bbox = it->second;
-    } else {
-      node->getBoundingBox(bbox);
-      std::lock_guard<std::mutex> lock(m_mutex);
-      m_boxCache[node->getComponentID()] = bbox;
-    }
-
-    // Quick test. If this suceeds moved on to test the children
-    if (bbox.doesLineIntersect(testRay)) {
-      if (ICompAssembly_const_sptr assembly =
-              boost::dynamic_pointer_cast<const ICompAssembly>(node)) {
-        assembly->testIntersectionWithChildren(testRay, nodeQueue);
-      } else {
-        throw Kernel::Exception::NotImplementedError(
-            "Implement non-comp assembly interactions");
-      }
-    }
-  }
+  m_root->intersect(testRay);
 }
 
 ///**
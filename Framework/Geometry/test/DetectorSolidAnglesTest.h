@@ -0,0 +1,93 @@
+#ifndef MANTID_GEOMETRY_DETECTORSOLIDANGLESTEST_H_
+#define MANTID_GEOMETRY_DETECTORSOLIDANGLESTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidGeometry/Instrument.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
+#include "MantidGeometry/Instrument/DetectorSolidAngles.h"
+#include "MantidGeometry/Instrument/InstrumentVisitor.h"
+#include "MantidTestHelpers/ComponentCreationHelper.h"
+
+using namespace Mantid::Geometry;
+using Mantid::Kernel::V3D;
+
+class DetectorSolidAnglesTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static DetectorSolidAnglesTest *createSuite() {
+    return new DetectorSolidAnglesTest();
+  }
+  static void destroySuite(DetectorSolidAnglesTest *suite) { delete suite; }
+
+  void setUp() override { DetectorSolidAngles::clearCache(); }
+
+  void test_values_match_componentInfo_for_cylinders() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(2);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &componentInfo = *std::get<0>(wrappers);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    const V3D samplePos = detectorInfo.samplePosition();
+
+    DetectorSolidAngles solidAngles(componentInfo, samplePos);
+    TS_ASSERT_EQUALS(solidAngles.size(), detectorInfo.size());
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      TS_ASSERT_DELTA(solidAngles[i],
+                      componentInfo.solidAngle(i, samplePos), 1e-12);
+    }
+  }
+
+  void test_values_match_componentInfo_for_cuboid_pixels() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentRectangular(1, 5);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    const auto &componentInfo = *std::get<0>(wrappers);
+    const auto &detectorInfo = *std::get<1>(wrappers);
+    const V3D samplePos = detectorInfo.samplePosition();
+
+    DetectorSolidAngles solidAngles(componentInfo, samplePos);
+    TS_ASSERT_EQUALS(solidAngles.size(), detectorInfo.size());
+    for (size_t i = 0; i < detectorInfo.size(); ++i) {
+      TS_ASSERT_DELTA(solidAngles[i],
+                      componentInfo.solidAngle(i, samplePos), 1e-12);
+    }
+  }
+
+  void test_moved_detector_is_not_taken_from_cache() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    const V3D samplePos = std::get<1>(wrappers)->samplePosition();
+
+    const DetectorSolidAngles before(componentInfo, samplePos);
+    const DetectorSolidAngles again(componentInfo, samplePos);
+    TS_ASSERT_EQUALS(before[0], again[0]);
+
+    // Moving the detector further away reduces its solid angle
+    componentInfo.setPosition(0, componentInfo.position(0) * 2.0);
+    const DetectorSolidAngles after(componentInfo, samplePos);
+    TS_ASSERT(after[0] < before[0]);
+    TS_ASSERT_DELTA(after[0], componentInfo.solidAngle(0, samplePos), 1e-12);
+    TS_ASSERT_EQUALS(after[1], before[1]);
+  }
+
+  void test_scaled_detector_is_not_taken_from_cache() {
+    auto instrument =
+        ComponentCreationHelper::createTestInstrumentCylindrical(1);
+    auto wrappers = InstrumentVisitor::makeWrappers(*instrument);
+    auto &componentInfo = *std::get<0>(wrappers);
+    const V3D samplePos = std::get<1>(wrappers)->samplePosition();
+
+    const DetectorSolidAngles before(componentInfo, samplePos);
+    componentInfo.setScaleFactor(0, V3D(2.0, 2.0, 2.0));
+    const DetectorSolidAngles after(componentInfo, samplePos);
+    TS_ASSERT(after[0] > before[0]);
+    TS_ASSERT_DELTA(after[0], componentInfo.solidAngle(0, samplePos), 1e-12);
+  }
+};
+
+#endif /* MANTID_GEOMETRY_DETECTORSOLIDANGLESTEST_H_ */
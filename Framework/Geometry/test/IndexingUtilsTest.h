@@ -214,6 +214,24 @@ public:
     }
   }
 
+  void test_Find_UB_using_FFT_with_fine_steps() {
+    // a step much finer than the FFT peak width uses the coarse-to-fine scan
+    Matrix<double> UB(3, 3, false);
+    std::vector<V3D> q_vectors = getNatroliteQs();
+
+    double d_min = 6;
+    double d_max = 10;
+    double required_tolerance = 0.08;
+    double degrees_per_step = 0.5;
+
+    IndexingUtils::Find_UB(UB, q_vectors, d_min, d_max, required_tolerance,
+                           degrees_per_step);
+
+    int num_indexed =
+        IndexingUtils::NumberIndexed(UB, q_vectors, required_tolerance);
+    TS_ASSERT_EQUALS(num_indexed, 12);
+  }
+
   void test_Optimize_UB_given_indexing() {
     std::vector<V3D> q_list = getNatroliteQs();
     std::vector<V3D> hkl_list = getNatroliteIndices();
@@ -141,6 +141,37 @@ public:
     TS_ASSERT_EQUALS(results.size(), 0);
   }
 
+  void test_Tracing_Many_Tracks_Gives_Same_Results_As_Single_Traces() {
+    Instrument_sptr testInst = setupInstrument();
+    InstrumentRayTracer tracker(testInst);
+    const V3D sourcePos = testInst->getSource()->getPos();
+    std::vector<V3D> directions = {V3D(0., 0., 1.),
+                                   V3D(0.010, 0.0, 15.004),
+                                   V3D(0.0, 1.0, 0.0)};
+    std::vector<Track> tracks;
+    for (auto &dir : directions) {
+      dir.normalize();
+      tracks.emplace_back(sourcePos, dir);
+    }
+    tracker.trace(tracks);
+
+    for (size_t i = 0; i < directions.size(); ++i) {
+      tracker.trace(directions[i]);
+      const Links expected = tracker.getResults();
+      TS_ASSERT_EQUALS(tracks[i].count(), static_cast<int>(expected.size()));
+      auto link = tracks[i].cbegin();
+      for (const auto &expectedLink : expected) {
+        TS_ASSERT_EQUALS(link->componentID, expectedLink.componentID);
+        TS_ASSERT_DELTA(link->distFromStart, expectedLink.distFromStart,
+                        1e-12);
+        ++link;
+      }
+    }
+    TS_ASSERT_EQUALS(tracks[0].count(), 2);
+    TS_ASSERT_EQUALS(tracks[1].count(), 1);
+    TS_ASSERT_EQUALS(tracks[2].count(), 0);
+  }
+
   /** Test ray tracing into a rectangular detector
    *
    * @param inst :: instrument with 1 rect
@@ -211,6 +242,22 @@ public:
     doTestRectangularDetector("Zero-beam", inst, V3D(0.0, 0.0, 0.0), -1, -1);
   }
 
+  void test_traceFromSample_into_a_track_clears_previous_results() {
+    Instrument_sptr inst =
+        ComponentCreationHelper::createTestInstrumentRectangular(1, 100);
+    InstrumentRayTracer tracker(inst);
+    Track track;
+    V3D hit(0.0, 0.0, 5.0);
+    hit.normalize();
+    tracker.traceFromSample(hit, track);
+    TS_ASSERT(tracker.getDetectorResult(track));
+
+    V3D miss(-0.008, 0.0, 5.0);
+    miss.normalize();
+    tracker.traceFromSample(miss, track);
+    TS_ASSERT(!tracker.getDetectorResult(track));
+  }
+
 private:
   /// Setup the shared test instrument
   Instrument_sptr setupInstrument() {
@@ -4,13 +4,17 @@
 #include "MantidGeometry/Instrument/Parameter.h"
 #include "MantidGeometry/Instrument/ParameterFactory.h"
 #include "MantidGeometry/Instrument/ParameterMap.h"
+#include "MantidGeometry/Instrument/ComponentInfo.h"
 #include "MantidGeometry/Instrument/Detector.h"
+#include "MantidGeometry/Instrument/DetectorInfo.h"
 #include "MantidBeamline/ComponentInfo.h"
 #include "MantidBeamline/DetectorInfo.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidKernel/V3D.h"
 #include <cxxtest/TestSuite.h>
 
+#include <cmath>
+
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
 
@@ -632,6 +636,59 @@ public:
     TS_ASSERT_EQUALS(oldA->value<bool>(), false);
   }
 
+  void test_getDetectorColumn_matches_getRecursive() {
+    ParameterMap pmap;
+    pmap.setInstrument(m_testInstrument.get());
+    const auto &compInfo = pmap.componentInfo();
+    const auto numberOfDetectors = pmap.detectorInfo().size();
+    TS_ASSERT(numberOfDetectors > 1);
+    pmap.addDouble(m_testInstrument.get(), "Efixed", 2.0);
+    pmap.addInt(compInfo.componentID(1), "Efixed", 3);
+
+    const auto column = pmap.getDetectorColumn("Efixed");
+    TS_ASSERT_EQUALS(column->size(), numberOfDetectors);
+    TS_ASSERT_EQUALS((*column)[0], 2.0);
+    TS_ASSERT_EQUALS((*column)[1], 3.0);
+    for (size_t i = 0; i < numberOfDetectors; ++i) {
+      auto param = pmap.getRecursive(compInfo.componentID(i), "Efixed");
+      const double expected = param->type() == ParameterMap::pInt()
+                                  ? param->value<int>()
+                                  : param->value<double>();
+      TS_ASSERT_EQUALS((*column)[i], expected);
+    }
+  }
+
+  void test_getDetectorColumn_is_NaN_if_not_found_or_not_numeric() {
+    ParameterMap pmap;
+    pmap.setInstrument(m_testInstrument.get());
+    pmap.addString(m_testInstrument.get(), "Name", "text");
+    for (const auto value : *pmap.getDetectorColumn("Efixed"))
+      TS_ASSERT(std::isnan(value));
+    for (const auto value : *pmap.getDetectorColumn("Name"))
+      TS_ASSERT(std::isnan(value));
+  }
+
+  void test_getDetectorColumn_is_cached_until_parameters_change() {
+    ParameterMap pmap;
+    pmap.setInstrument(m_testInstrument.get());
+    pmap.addDouble(m_testInstrument.get(), "Efixed", 2.0);
+    const auto column = pmap.getDetectorColumn("Efixed");
+    TS_ASSERT_EQUALS(pmap.getDetectorColumn("Efixed"), column);
+
+    // Parameters on an assembly override those of the instrument
+    const auto bank = m_testInstrument->getChild(0);
+    pmap.addDouble(bank.get(), "Efixed", 4.0);
+    const auto changed = pmap.getDetectorColumn("Efixed");
+    TS_ASSERT_DIFFERS(changed, column);
+    TS_ASSERT_EQUALS((*column)[0], 2.0);
+    TS_ASSERT_EQUALS((*changed)[0], 4.0);
+
+    pmap.clearParametersByName("Efixed", bank.get());
+    TS_ASSERT_EQUALS((*pmap.getDetectorColumn("Efixed"))[0], 2.0);
+    pmap.clear();
+    TS_ASSERT(std::isnan((*pmap.getDetectorColumn("Efixed"))[0]));
+  }
+
 private:
   template <typename ValueType>
   void doCopyAndUpdateTestUsingGenericAdd(const std::string &type,
@@ -7,6 +7,7 @@
 #include "MantidKernel/DllConfig.h"
 #include "MantidKernel/Exception.h"
 #include "MantidKernel/Instantiator.h"
+#include "MantidKernel/LibraryManager.h"
 #include "MantidKernel/RegistrationHelper.h"
 #include "MantidKernel/CaseInsensitiveMap.h"
 
@@ -112,7 +113,7 @@ public:
   /// @param className :: the name of the class you wish to create
   /// @return a shared pointer ot the base class
   virtual boost::shared_ptr<Base> create(const std::string &className) const {
-    auto it = _map.find(className);
+    auto it = find(className);
     if (it != _map.end())
       return it->second->createInstance();
     else
@@ -130,7 +131,7 @@ public:
   /// @param className :: the name of the class you wish to create
   /// @return a pointer to the base class
   virtual Base *createUnwrapped(const std::string &className) const {
-    auto it = _map.find(className);
+    auto it = find(className);
     if (it != _map.end())
       return it->second->createUnwrappedInstance();
     else
@@ -172,6 +173,8 @@ public:
       if (it != _map.end() && it->second)
         delete it->second;
       _map[className] = pAbstractFactory;
+      if (!m_manifestKind.empty())
+        LibraryManagerImpl::notifyRegistration(m_manifestKind, className);
       sendUpdateNotificationIfEnabled();
     } else {
       delete pAbstractFactory;
@@ -199,12 +202,21 @@ public:
   /// @param className :: the name of the class you wish to check
   /// @returns true is the class is subscribed
   bool exists(const std::string &className) const {
-    return _map.find(className) != _map.end();
+    return find(className) != _map.end();
   }
 
-  /// Returns the keys in the map
+  /// Returns the keys in the map, after opening the plugin libraries whose
+  /// loading was deferred and whose manifest lists classes for this factory
   /// @return A string vector of keys
   virtual const std::vector<std::string> getKeys() const {
+    if (!m_manifestKind.empty())
+      LibraryManager::Instance().openDeferredLibraries(m_manifestKind);
+    return getOpenedKeys();
+  }
+
+  /// Returns the keys in the map without opening any plugin libraries
+  /// @return A string vector of keys
+  const std::vector<std::string> getOpenedKeys() const {
     std::vector<std::string> names;
     names.reserve(_map.size());
     std::transform(
@@ -223,7 +235,13 @@ public:
 
 protected:
   /// Protected constructor for base class
-  DynamicFactory() : notificationCenter(), _map(), m_notifyStatus(Disabled) {}
+  /// @param manifestKind :: the kind of item in plugin manifests that are
+  /// registered with this factory. If empty, no plugin library is opened on
+  /// behalf of the factory, so only libraries that are opened eagerly may
+  /// register classes with it.
+  explicit DynamicFactory(const std::string &manifestKind = "")
+      : notificationCenter(), _map(), m_notifyStatus(Disabled),
+        m_manifestKind(manifestKind) {}
 
 private:
   /// Send an update notification if they are enabled
@@ -238,10 +256,24 @@ private:
 
   /// A typedef for the map of registered classes
   typedef std::map<std::string, AbstractFactory *, Comparator> FactoryMap;
+
+  /// Find a registered class. If it is not found, the plugin library whose
+  /// manifest lists it is opened if its loading was deferred.
+  typename FactoryMap::const_iterator find(const std::string &className) const {
+    auto it = _map.find(className);
+    if (it == _map.end() && !m_manifestKind.empty() &&
+        LibraryManager::Instance().openLibraryProviding(m_manifestKind,
+                                                        className))
+      it = _map.find(className);
+    return it;
+  }
+
   /// The map holding the registered class names and their instantiators
   FactoryMap _map;
   /// Flag marking whether we should dispatch notifications
   NotificationStatus m_notifyStatus;
+  /// The kind of item in plugin manifests registered with this factory
+  const std::string m_manifestKind;
 };
 
 } // namespace Kernel
@@ -4,8 +4,13 @@
 //----------------------------------------------------------------------
 // Includes
 //----------------------------------------------------------------------
+#include <functional>
+#include <mutex>
+#include <set>
 #include <string>
 #include <unordered_map>
+#include <utility>
+#include <vector>
 
 #include "MantidKernel/DllConfig.h"
 #include "MantidKernel/LibraryWrapper.h"
@@ -50,6 +55,37 @@ public:
   enum LoadLibraries { Recursive, NonRecursive };
   int openLibraries(const std::string &libpath, LoadLibraries loadingBehaviour,
                     const std::vector<std::string> &excludes);
+  /// Open the libraries without a manifest, deferring the others until
+  /// something they provide is requested
+  int openLibrariesLazily(const std::string &libpath,
+                          LoadLibraries loadingBehaviour,
+                          const std::vector<std::string> &excludes);
+  /// Open the deferred library providing the named item, if any
+  bool openLibraryProviding(const std::string &kind, const std::string &name);
+  /// Open the deferred libraries providing items of a kind, or all of them
+  int openDeferredLibraries(const std::string &kind = "");
+  /// Returns true if a deferred library provides the named item
+  bool hasDeferredLibrary(const std::string &kind,
+                          const std::string &name) const;
+  /// The names of the items of a kind provided by deferred libraries
+  std::vector<std::string> deferredItems(const std::string &kind) const;
+
+  /// The manifest listing the items provided by a library
+  static std::string manifestPath(const std::string &libraryPath);
+  /// Read the (kind, name) pairs listed in a manifest
+  static std::vector<std::pair<std::string, std::string>>
+  readManifest(const std::string &filename);
+
+  /// Receives the kind and name of each class registered with a factory
+  using RegistrationObserver =
+      std::function<void(const std::string &, const std::string &)>;
+  /// Set the function told about classes registered from now on, to write
+  /// them in a manifest
+  static void setRegistrationObserver(RegistrationObserver observer);
+  /// Tell the registration observer, if any, about a registered class
+  static void notifyRegistration(const std::string &kind,
+                                 const std::string &name);
+
   LibraryManagerImpl(const LibraryManagerImpl &) = delete;
   LibraryManagerImpl &operator=(const LibraryManagerImpl &) = delete;
 
@@ -64,7 +100,9 @@ private:
   /// Load libraries from the given Poco::File path
   /// Private so Poco::File doesn't leak to the public interface
   int openLibraries(const Poco::File &libpath, LoadLibraries loadingBehaviour,
-                    const std::vector<std::string> &excludes);
+                    const std::vector<std::string> &excludes, const bool lazy);
+  /// Record a library with a manifest instead of opening it
+  bool deferLibrary(const Poco::File &filepath, const std::string &cacheKey);
   /// Check if the library should be loaded
   bool shouldBeLoaded(const std::string &filename,
                       const std::vector<std::string> &excludes) const;
@@ -78,6 +116,22 @@ private:
 
   /// Storage for the LibraryWrappers.
   std::unordered_map<std::string, LibraryWrapper> m_openedLibs;
+
+  /// A library that has not been opened yet
+  struct DeferredLibrary {
+    std::string path;
+    std::set<std::string> kinds;
+    /// The (kind, name) pairs listed in the manifest
+    std::vector<std::pair<std::string, std::string>> items;
+  };
+  /// Libraries whose opening was deferred, keyed as m_openedLibs
+  std::unordered_map<std::string, DeferredLibrary> m_deferredLibs;
+  /// The deferred library providing each item, keyed by kind and lower-case
+  /// name
+  std::unordered_map<std::string, std::string> m_providers;
+  /// Guards the library maps. Opening a library may recursively request
+  /// another one from its static initialisers.
+  mutable std::recursive_mutex m_mutex;
 };
 
 EXTERN_MANTID_KERNEL template class MANTID_KERNEL_DLL
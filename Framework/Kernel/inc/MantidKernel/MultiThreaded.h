@@ -2,6 +2,7 @@
 #define MANTID_KERNEL_MULTITHREADED_H_
 
 #include "MantidKernel/DataItem.h"
+#include "MantidKernel/ThreadBudget.h"
 
 #include <atomic>
 #include <mutex>
@@ -125,20 +126,32 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #include <omp.h>
 
+/** The number of threads for a parallel region, limited by the ThreadBudget
+ * shared with ThreadPool and reduced when nested.
+ */
+#define PARALLEL_TEAM_SIZE ::Mantid::Kernel::ThreadBudget::teamSize()
+
+/** The number of threads for a parallel region with an if clause. Nothing is
+ * taken from the ThreadBudget if the condition is false.
+ */
+#define PARALLEL_TEAM_SIZE_IF(condition)                                       \
+  ::Mantid::Kernel::ThreadBudget::teamSize(condition)
+
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
 *   This includes an arbirary check: condition.
 *   "condition" must evaluate to TRUE in order for the
 *   code to be executed in parallel
 */
 #define PARALLEL_FOR_IF(condition)                                             \
-    PRAGMA(omp parallel for if (condition) )
+    PRAGMA(omp parallel for if (condition)                                     \
+               num_threads(PARALLEL_TEAM_SIZE_IF(condition)))
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
 *   This includes no checks to see if workspaces are suitable
 *   and therefore should not be used in any loops that access workspaces.
 */
 #define PARALLEL_FOR_NO_WSP_CHECK()                                            \
-    PRAGMA(omp parallel for)
+    PRAGMA(omp parallel for num_threads(PARALLEL_TEAM_SIZE))
 
 /** Includes code to add OpenMP commands to run the next for loop in parallel.
  *  and declare the varialbes to be firstprivate.
@@ -146,10 +159,12 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
  *  and therefore should not be used in any loops that access workspace.
  */
 #define PARALLEL_FOR_NOWS_CHECK_FIRSTPRIVATE(variable)                         \
-  PRAGMA(omp parallel for firstprivate(variable) )
+  PRAGMA(omp parallel for firstprivate(variable)                               \
+             num_threads(PARALLEL_TEAM_SIZE))
 
 #define PARALLEL_FOR_NO_WSP_CHECK_FIRSTPRIVATE2(variable1, variable2)          \
-  PRAGMA(omp parallel for firstprivate(variable1, variable2) )
+  PRAGMA(omp parallel for firstprivate(variable1, variable2)                   \
+             num_threads(PARALLEL_TEAM_SIZE))
 
 /** Ensures that the next execution line or block is only executed if
 * there are multple threads execting in this region
@@ -186,7 +201,10 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 
 #define PARALLEL_THREAD_NUMBER omp_get_thread_num()
 
-#define PARALLEL PRAGMA(omp parallel)
+/// True if called from within an OpenMP parallel region
+#define PARALLEL_IN_REGION omp_in_parallel()
+
+#define PARALLEL PRAGMA(omp parallel num_threads(PARALLEL_TEAM_SIZE))
 
 #define PARALLEL_SECTIONS PRAGMA(omp sections nowait)
 
@@ -210,6 +228,7 @@ void AtomicOp(std::atomic<T> &f, T d, BinaryOp op) {
 #define PARALLEL_CRITICAL(name)
 #define PARALLEL_ATOMIC
 #define PARALLEL_THREAD_NUMBER 0
+#define PARALLEL_IN_REGION false
 #define PARALLEL_SET_NUM_THREADS(MaxCores)
 #define PARALLEL_SET_DYNAMIC(val)
 #define PARALLEL_NUMBER_OF_THREADS 1
@@ -0,0 +1,86 @@
+#ifndef MANTID_KERNEL_THREADBUDGET_H_
+#define MANTID_KERNEL_THREADBUDGET_H_
+
+#include "MantidKernel/DllConfig.h"
+
+#include <cstddef>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadBudget : The number of threads the framework may use at once,
+  shared between OpenMP parallel regions and ThreadPool.
+
+  The budget is set by FrameworkManager::setNumOMPThreads, which also sizes
+  the OpenMP and TBB thread pools, and defaults to the number of hardware
+  threads. The OpenMP macros in MultiThreaded.h and ThreadPool ask teamSize()
+  how many threads a new parallel region may use:
+
+  - At the top level, all of the budget not taken by busy ThreadPool workers.
+  - Inside a ThreadPool task, an equal share of the budget between the busy
+    workers, so that e.g. a child algorithm with an OpenMP loop does not
+    start a full team in every worker.
+  - Inside an OpenMP parallel region, one thread.
+
+  Counters record how often regions were nested, reduced or oversubscribed.
+  Regions that run serially are not counted.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL ThreadBudget {
+public:
+  /// Statistics of the parallel regions started since the last reset
+  struct Counters {
+    /// Parallel regions and thread pools started
+    size_t regions{0};
+    /// Regions started from within another region or a ThreadPool task
+    size_t nestedRegions{0};
+    /// Regions given fewer threads than the budget
+    size_t reducedRegions{0};
+    /// Times the busy threads exceeded the budget
+    size_t oversubscriptions{0};
+  };
+
+  /** Marks the calling thread as a busy worker of a ThreadPool for the
+   * lifetime of the object, so that parallel regions it starts are reduced.
+   */
+  class MANTID_KERNEL_DLL Worker {
+  public:
+    Worker();
+    ~Worker();
+    Worker(const Worker &) = delete;
+    Worker &operator=(const Worker &) = delete;
+  };
+
+  static void setMaxThreads(const int numThreads);
+  static int maxThreads();
+  static int teamSize(const bool parallel = true);
+  static bool inParallelRegion();
+  static int busyWorkers();
+  static Counters counters();
+  static void resetCounters();
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADBUDGET_H_ */
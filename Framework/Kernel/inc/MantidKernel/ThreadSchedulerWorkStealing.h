@@ -0,0 +1,100 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_
+
+#include "MantidKernel/DllConfig.h"
+#include "MantidKernel/ThreadScheduler.h"
+
+#include <atomic>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Mantid {
+namespace Kernel {
+
+/** ThreadSchedulerWorkStealing : A ThreadScheduler that keeps one queue of
+  tasks per worker thread instead of a single queue shared by all of them.
+
+  - A worker takes tasks from the back of its own queue. When that is empty it
+    steals from the front of the queue holding the largest cost.
+  - Tasks pushed from inside a running task (nested submission) go to the
+    queue of the worker running it. Other tasks go to the queue holding the
+    smallest cost, using Task::cost() as a hint.
+  - The scheduler only reports empty() once no task is queued or running,
+    so that workers do not exit while a running task may still push more.
+  - cancel() discards all queued tasks and any pushed afterwards. Running
+    tasks can check cancelled() to stop early.
+
+  This suits large numbers of small tasks, such as splitting MD boxes, which
+  contend on the lock of the single-queue schedulers.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class MANTID_KERNEL_DLL ThreadSchedulerWorkStealing : public ThreadScheduler {
+public:
+  explicit ThreadSchedulerWorkStealing(size_t numQueues = 0);
+  ~ThreadSchedulerWorkStealing() override;
+
+  void push(Task *newTask) override;
+  Task *pop(size_t threadnum) override;
+  void finished(Task *task, size_t threadnum) override;
+  void abort(std::runtime_error exception) override;
+  size_t size() override;
+  bool empty() override;
+  void clear() override;
+  double totalCost() override;
+
+  void cancel();
+  bool cancelled() const;
+  size_t numQueues() const;
+  size_t numSteals() const;
+
+private:
+  /// The tasks of one worker
+  struct Queue {
+    std::mutex lock;
+    std::deque<Task *> tasks;
+    /// Total cost of the tasks, only modified while holding the lock
+    std::atomic<double> cost{0.0};
+  };
+
+  size_t pushTarget() const;
+  Task *take(Queue &queue, const bool fromBack);
+  Task *steal(const size_t thief);
+
+  /// Identifies the calling thread as one of the workers of this scheduler
+  const size_t m_id;
+  std::vector<std::unique_ptr<Queue>> m_queues;
+  /// Number of tasks in the queues
+  std::atomic<size_t> m_queued{0};
+  /// Number of tasks queued or running
+  std::atomic<size_t> m_pending{0};
+  /// Number of tasks taken from the queue of another worker
+  std::atomic<size_t> m_steals{0};
+  std::atomic<bool> m_cancelled{false};
+};
+
+} // namespace Kernel
+} // namespace Mantid
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALING_H_ */
@@ -9,11 +9,28 @@
 #include <Poco/DirectoryIterator.h>
 #include <boost/algorithm/string.hpp>
 
+#include <fstream>
+#include <sstream>
+
 namespace Mantid {
 namespace Kernel {
 namespace {
 /// static logger
 Logger g_log("LibraryManager");
+/// Suffix appended to the path of a library to give its manifest
+const char *MANIFEST_SUFFIX = ".plugin-manifest";
+
+/// Key of an item in the map of providers
+std::string providerKey(const std::string &kind, const std::string &name) {
+  return kind + "/" + boost::algorithm::to_lower_copy(name);
+}
+
+/// The observer told about registered classes. Classes are registered from
+/// static initialisers, so it is created on first use.
+LibraryManagerImpl::RegistrationObserver &registrationObserver() {
+  static LibraryManagerImpl::RegistrationObserver observer;
+  return observer;
+}
 }
 
 /// Constructor
@@ -35,7 +52,9 @@ int LibraryManagerImpl::openLibraries(
     const std::vector<std::string> &excludes) {
   g_log.debug("Opening all libraries in " + filepath + "\n");
   try {
-    return openLibraries(Poco::File(filepath), loadingBehaviour, excludes);
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return openLibraries(Poco::File(filepath), loadingBehaviour, excludes,
+                         false);
   } catch (std::exception &exc) {
     g_log.debug() << "Error occurred while opening libraries: " << exc.what()
                   << "\n";
@@ -46,6 +65,170 @@ int LibraryManagerImpl::openLibraries(
   }
 }
 
+/**
+ * Opens the libraries on a given path that have no manifest. The others are
+ * only recorded, and opened by openLibraryProviding() or
+ * openDeferredLibraries() once something listed in their manifest is
+ * requested.
+ *  @param filepath The filepath to the directory where the libraries are.
+ *  @param loadingBehaviour Control how libraries are searched for
+ *  @param excludes Substrings of the names of libraries to skip
+ *  @return The number of libraries opened or deferred.
+ */
+int LibraryManagerImpl::openLibrariesLazily(
+    const std::string &filepath, LoadLibraries loadingBehaviour,
+    const std::vector<std::string> &excludes) {
+  g_log.debug("Opening or deferring all libraries in " + filepath + "\n");
+  try {
+    std::lock_guard<std::recursive_mutex> lock(m_mutex);
+    return openLibraries(Poco::File(filepath), loadingBehaviour, excludes,
+                         true);
+  } catch (std::exception &exc) {
+    g_log.debug() << "Error occurred while opening libraries: " << exc.what()
+                  << "\n";
+    return 0;
+  }
+}
+
+/**
+ * Opens the deferred library whose manifest lists the given item
+ * @param kind The kind of item, e.g. Algorithm or Function
+ * @param name The name of the item, compared case-insensitively
+ * @return True if a library was opened
+ */
+bool LibraryManagerImpl::openLibraryProviding(const std::string &kind,
+                                              const std::string &name) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  if (m_deferredLibs.empty())
+    return false;
+  const auto provider = m_providers.find(providerKey(kind, name));
+  if (provider == m_providers.end())
+    return false;
+  const auto library = m_deferredLibs.find(provider->second);
+  if (library == m_deferredLibs.end())
+    return false;
+  const std::string cacheKey = library->first;
+  const std::string path = library->second.path;
+  m_deferredLibs.erase(library);
+  g_log.debug() << "Opening " << path << " providing " << kind << " " << name
+                << "\n";
+  return openLibrary(Poco::File(path), cacheKey) == 1;
+}
+
+/**
+ * Opens the deferred libraries providing any item of the given kind
+ * @param kind The kind of item, or an empty string to open all of them
+ * @return The number of libraries opened
+ */
+int LibraryManagerImpl::openDeferredLibraries(const std::string &kind) {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::pair<std::string, std::string>> toOpen;
+  for (auto it = m_deferredLibs.begin(); it != m_deferredLibs.end();) {
+    if (kind.empty() || it->second.kinds.count(kind) > 0) {
+      toOpen.emplace_back(it->first, it->second.path);
+      it = m_deferredLibs.erase(it);
+    } else {
+      ++it;
+    }
+  }
+  int libCount(0);
+  for (const auto &library : toOpen)
+    libCount += openLibrary(Poco::File(library.second), library.first);
+  return libCount;
+}
+
+/**
+ * @param kind The kind of item, e.g. Algorithm or Function
+ * @param name The name of the item, compared case-insensitively
+ * @return True if the item is provided by a library that is not open yet
+ */
+bool LibraryManagerImpl::hasDeferredLibrary(const std::string &kind,
+                                            const std::string &name) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  const auto provider = m_providers.find(providerKey(kind, name));
+  return provider != m_providers.end() &&
+         m_deferredLibs.count(provider->second) > 0;
+}
+
+/**
+ * @param kind The kind of item, e.g. Algorithm or Function
+ * @return The names of the items of the given kind listed in the manifests of
+ * libraries that are not open yet, as written in the manifests
+ */
+std::vector<std::string>
+LibraryManagerImpl::deferredItems(const std::string &kind) const {
+  std::lock_guard<std::recursive_mutex> lock(m_mutex);
+  std::vector<std::string> names;
+  for (const auto &library : m_deferredLibs) {
+    for (const auto &item : library.second.items) {
+      if (item.first == kind)
+        names.push_back(item.second);
+    }
+  }
+  return names;
+}
+
+/**
+ * @param libraryPath The path to a library
+ * @return The path to the manifest of the library, which need not exist
+ */
+std::string LibraryManagerImpl::manifestPath(const std::string &libraryPath) {
+  return libraryPath + MANIFEST_SUFFIX;
+}
+
+/**
+ * Reads a manifest. Each line holds the kind and name of an item provided by
+ * the library, separated by whitespace. Empty lines and lines starting with
+ * '#' are ignored.
+ * @param filename The path to the manifest
+ * @return The (kind, name) pairs
+ * @throws std::runtime_error if the file cannot be read or a line is invalid
+ */
+std::vector<std::pair<std::string, std::string>>
+LibraryManagerImpl::readManifest(const std::string &filename) {
+  std::ifstream manifest(filename);
+  if (!manifest)
+    throw std::runtime_error("Cannot read plugin manifest " + filename);
+  std::vector<std::pair<std::string, std::string>> items;
+  std::string line;
+  while (std::getline(manifest, line)) {
+    boost::algorithm::trim(line);
+    if (line.empty() || line[0] == '#')
+      continue;
+    std::istringstream fields(line);
+    std::string kind, name, extra;
+    fields >> kind >> name;
+    if (name.empty() || fields >> extra)
+      throw std::runtime_error("Invalid line in plugin manifest " + filename +
+                               ": " + line);
+    items.emplace_back(kind, name);
+  }
+  return items;
+}
+
+/**
+ * Set the function told about the classes registered with a factory from now
+ * on. PluginManifest uses it to list every class a library registers.
+ * @param observer The function taking the kind of the factory and the name
+ * of the class, or an empty function to stop observing
+ */
+void LibraryManagerImpl::setRegistrationObserver(
+    RegistrationObserver observer) {
+  registrationObserver() = std::move(observer);
+}
+
+/**
+ * Called by the factories for each class registered with them
+ * @param kind The kind of item in the manifests the factory looks up
+ * @param name The name of the class
+ */
+void LibraryManagerImpl::notifyRegistration(const std::string &kind,
+                                            const std::string &name) {
+  const auto &observer = registrationObserver();
+  if (observer)
+    observer(kind, name);
+}
+
 //-------------------------------------------------------------------------
 // Private members
 //-------------------------------------------------------------------------
@@ -57,12 +240,13 @@ int LibraryManagerImpl::openLibraries(
  *  @param excludes If not empty then each string is considered as a substring
  * to search within each library to be opened. If the substring is found then
  * the library is not opened.
- *  @return The number of libraries opened.
+ *  @param lazy If true, libraries with a manifest are deferred
+ *  @return The number of libraries opened or deferred.
  */
 int LibraryManagerImpl::openLibraries(
     const Poco::File &libpath,
     LibraryManagerImpl::LoadLibraries loadingBehaviour,
-    const std::vector<std::string> &excludes) {
+    const std::vector<std::string> &excludes, const bool lazy) {
   int libCount(0);
   if (libpath.exists() && libpath.isDirectory()) {
     // Iterate over the available files
@@ -70,13 +254,17 @@ int LibraryManagerImpl::openLibraries(
     for (Poco::DirectoryIterator itr(libpath); itr != end_itr; ++itr) {
       const Poco::File &item = *itr;
       if (item.isFile()) {
-        if (shouldBeLoaded(itr.path().getFileName(), excludes))
-          libCount += openLibrary(itr.path(), itr.path().getFileName());
-        else
+        const auto filename = itr.path().getFileName();
+        if (!shouldBeLoaded(filename, excludes))
           continue;
+        if (lazy && deferLibrary(item, filename))
+          ++libCount;
+        else
+          libCount += openLibrary(item, filename);
       } else if (loadingBehaviour == LoadLibraries::Recursive) {
         // it must be a directory
-        libCount += openLibraries(item, LoadLibraries::Recursive, excludes);
+        libCount +=
+            openLibraries(item, LoadLibraries::Recursive, excludes, lazy);
       }
     }
   } else {
@@ -107,7 +295,42 @@ bool LibraryManagerImpl::shouldBeLoaded(
  * @return True if the library has been seen before
  */
 bool LibraryManagerImpl::isLoaded(const std::string &filename) const {
-  return m_openedLibs.find(filename) != m_openedLibs.cend();
+  return m_openedLibs.find(filename) != m_openedLibs.cend() ||
+         m_deferredLibs.find(filename) != m_deferredLibs.cend();
+}
+
+/**
+ * Record a library for opening later if it has a manifest listing something.
+ * A library with an empty manifest registers nothing that could be requested
+ * by name, so it is opened now to run its static initialisers.
+ * @param filepath :: The full path to the library
+ * @param cacheKey :: An identifier for the cache once it is opened
+ * @return True if the library was deferred, false if it has no valid or an
+ * empty manifest
+ */
+bool LibraryManagerImpl::deferLibrary(const Poco::File &filepath,
+                                      const std::string &cacheKey) {
+  const auto manifest = manifestPath(filepath.path());
+  if (!Poco::File(manifest).exists())
+    return false;
+  std::vector<std::pair<std::string, std::string>> items;
+  try {
+    items = readManifest(manifest);
+  } catch (std::runtime_error &exc) {
+    g_log.warning() << exc.what() << ". Opening the library now.\n";
+    return false;
+  }
+  if (items.empty())
+    return false;
+  for (const auto &item : items)
+    m_providers.emplace(providerKey(item.first, item.second), cacheKey);
+  g_log.debug() << "Deferred opening " << filepath.path() << " providing "
+                << items.size() << " items\n";
+  DeferredLibrary library{filepath.path(), {}, std::move(items)};
+  for (const auto &item : library.items)
+    library.kinds.insert(item.first);
+  m_deferredLibs.emplace(cacheKey, std::move(library));
+  return true;
 }
 
 /**
@@ -0,0 +1,110 @@
+#include "MantidKernel/ThreadBudget.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// The budget, 0 meaning the number of hardware threads
+std::atomic<int> g_maxThreads{0};
+/// Number of threads currently running a ThreadPool task
+std::atomic<int> g_busyWorkers{0};
+/// Depth of ThreadPool tasks on the calling thread
+thread_local int t_workerDepth = 0;
+
+std::atomic<size_t> g_regions{0};
+std::atomic<size_t> g_nestedRegions{0};
+std::atomic<size_t> g_reducedRegions{0};
+std::atomic<size_t> g_oversubscriptions{0};
+} // namespace
+
+/** Set the number of threads the framework may use at once.
+ * @param numThreads :: the budget. Zero or less means the number of hardware
+ *        threads.
+ */
+void ThreadBudget::setMaxThreads(const int numThreads) {
+  g_maxThreads = std::max(numThreads, 0);
+}
+
+/// @return the number of threads the framework may use at once
+int ThreadBudget::maxThreads() {
+  const int maxThreads = g_maxThreads;
+  if (maxThreads > 0)
+    return maxThreads;
+  return std::max(static_cast<int>(std::thread::hardware_concurrency()), 1);
+}
+
+/** The number of threads a parallel region started now by the calling thread
+ * may use. This is never more than OpenMP would use for the region. Regions
+ * that run serially, because their if clause is false or they are nested in
+ * another OpenMP region, get one thread and are not counted.
+ * @param parallel :: false if the region will run serially anyway
+ * @return the number of threads, at least 1
+ */
+int ThreadBudget::teamSize(const bool parallel) {
+  // Nested OpenMP regions only get one thread anyway
+  if (!parallel || PARALLEL_IN_REGION)
+    return 1;
+  ++g_regions;
+  const int budget = maxThreads();
+  const int busy = g_busyWorkers;
+  int team;
+  if (t_workerDepth > 0) {
+    ++g_nestedRegions;
+    team = budget / std::max(busy, 1);
+  } else {
+    team = budget - busy;
+  }
+  team = std::max(std::min(team, PARALLEL_GET_MAX_THREADS), 1);
+  if (team < budget)
+    ++g_reducedRegions;
+  if (busy + team - (t_workerDepth > 0 ? 1 : 0) > budget)
+    ++g_oversubscriptions;
+  return team;
+}
+
+/// @return true if called from an OpenMP parallel region or ThreadPool task
+bool ThreadBudget::inParallelRegion() {
+  return t_workerDepth > 0 || PARALLEL_IN_REGION;
+}
+
+/// @return the number of threads currently running a ThreadPool task
+int ThreadBudget::busyWorkers() { return g_busyWorkers; }
+
+/// @return the counters accumulated since the last call to resetCounters()
+ThreadBudget::Counters ThreadBudget::counters() {
+  Counters counters;
+  counters.regions = g_regions;
+  counters.nestedRegions = g_nestedRegions;
+  counters.reducedRegions = g_reducedRegions;
+  counters.oversubscriptions = g_oversubscriptions;
+  return counters;
+}
+
+/// Set all counters back to zero
+void ThreadBudget::resetCounters() {
+  g_regions = 0;
+  g_nestedRegions = 0;
+  g_reducedRegions = 0;
+  g_oversubscriptions = 0;
+}
+
+/// Register the calling thread as a busy worker
+ThreadBudget::Worker::Worker() {
+  ++t_workerDepth;
+  if (++g_busyWorkers > maxThreads())
+    ++g_oversubscriptions;
+}
+
+/// Unregister the calling thread
+ThreadBudget::Worker::~Worker() {
+  --g_busyWorkers;
+  --t_workerDepth;
+}
+
+} // namespace Kernel
+} // namespace Mantid
@@ -7,6 +7,7 @@
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
 
 #include <Poco/Thread.h>
@@ -27,9 +28,10 @@ namespace Kernel {
  *
  * @param scheduler :: an instance of a ThreadScheduler to schedule tasks.
  *        NOTE: The ThreadPool destructor will delete this ThreadScheduler.
- * @param numThreads :: number of cores to use; default = 0, meaning auto-detect
- *all
- *        available physical cores.
+ * @param numThreads :: number of cores to use; default = 0, meaning the
+ *        number of threads allowed by the ThreadBudget. This is all available
+ *        physical cores unless the pool is created from within another
+ *        parallel region.
  * @param prog :: optional pointer to a Progress reporter object. If passed,
  *then
  *        automatic progress reporting will be handled by the thread pool.
@@ -42,11 +44,12 @@ ThreadPool::ThreadPool(ThreadScheduler *scheduler, size_t numThreads,
     throw std::invalid_argument(
         "NULL ThreadScheduler passed to ThreadPool constructor.");
 
+  // An explicit number of threads is a maximum, never more than the budget
+  const auto budget = static_cast<size_t>(ThreadBudget::teamSize());
   if (numThreads == 0) {
-    // Uses Poco to find how many cores there are.
-    m_numThreads = getNumPhysicalCores();
+    m_numThreads = std::min(getNumPhysicalCores(), budget);
   } else
-    m_numThreads = numThreads;
+    m_numThreads = std::min(numThreads, budget);
   // std::cout << m_numThreads << " m_numThreads \n";
 }
 
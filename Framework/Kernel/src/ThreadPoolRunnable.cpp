@@ -1,5 +1,6 @@
 #include "MantidKernel/ProgressBase.h"
 #include "MantidKernel/Task.h"
+#include "MantidKernel/ThreadBudget.h"
 #include "MantidKernel/ThreadPoolRunnable.h"
 #include "MantidKernel/ThreadScheduler.h"
 
@@ -58,7 +59,9 @@ void ThreadPoolRunnable::run() {
         mutex->lock();
 
       try {
-        // Run the task (synchronously within this thread)
+        // Run the task (synchronously within this thread). Parallel regions
+        // started by the task share the thread budget with the other workers.
+        ThreadBudget::Worker worker;
         task->run();
       } catch (std::exception &e) {
         // The task threw an exception!
@@ -0,0 +1,209 @@
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+#include "MantidKernel/ThreadPool.h"
+#include "MantidKernel/make_unique.h"
+
+namespace Mantid {
+namespace Kernel {
+
+namespace {
+/// Source of identifiers for schedulers, 0 meaning none
+std::atomic<size_t> g_nextId{1};
+/// Identifier of the scheduler the calling thread last popped a task from.
+/// This is used rather than a pointer, which a later scheduler may reuse.
+thread_local size_t t_schedulerId = 0;
+/// The queue owned by the calling thread in that scheduler
+thread_local size_t t_queue = 0;
+} // namespace
+
+/** Constructor
+ * @param numQueues :: number of queues, one per worker thread. Default 0,
+ *        meaning one per physical core as used by ThreadPool.
+ */
+ThreadSchedulerWorkStealing::ThreadSchedulerWorkStealing(size_t numQueues)
+    : m_id(g_nextId++) {
+  if (numQueues == 0)
+    numQueues = ThreadPool::getNumPhysicalCores();
+  m_queues.reserve(numQueues);
+  for (size_t i = 0; i < numQueues; ++i)
+    m_queues.emplace_back(Kernel::make_unique<Queue>());
+}
+
+/// Destructor. Deletes all tasks still queued.
+ThreadSchedulerWorkStealing::~ThreadSchedulerWorkStealing() { clear(); }
+
+/** Add a task. It goes to the queue of the calling worker if called from a
+ * running task, otherwise to the queue holding the smallest cost.
+ * A task pushed after cancel() is deleted without being queued.
+ * @param newTask :: the task to add. The scheduler takes ownership.
+ */
+void ThreadSchedulerWorkStealing::push(Task *newTask) {
+  if (m_cancelled) {
+    delete newTask;
+    return;
+  }
+  // Count the task before queuing it so that empty() cannot return true while
+  // it is being handed over.
+  ++m_pending;
+  Queue &queue = *m_queues[pushTarget()];
+  std::lock_guard<std::mutex> lock(queue.lock);
+  queue.tasks.push_back(newTask);
+  queue.cost.store(queue.cost.load() + newTask->cost());
+  ++m_queued;
+}
+
+/** Get the next task for a worker: the most recently pushed task of its own
+ * queue or, failing that, the oldest task of another queue.
+ * @param threadnum :: the index of the calling worker thread
+ * @return the task, or nullptr if none is queued
+ */
+Task *ThreadSchedulerWorkStealing::pop(size_t threadnum) {
+  const size_t own = threadnum % m_queues.size();
+  t_schedulerId = m_id;
+  t_queue = own;
+  if (m_cancelled || m_queued == 0)
+    return nullptr;
+  if (auto task = take(*m_queues[own], true))
+    return task;
+  return steal(own);
+}
+
+/** Signal that a task popped from this scheduler has completed.
+ * @param task :: the completed task
+ * @param threadnum :: the thread that ran it
+ */
+void ThreadSchedulerWorkStealing::finished(Task *task, size_t threadnum) {
+  UNUSED_ARG(task);
+  UNUSED_ARG(threadnum);
+  --m_pending;
+}
+
+/** Abort all tasks, discarding the queued ones.
+ * @param exception :: the exception that caused the abort
+ */
+void ThreadSchedulerWorkStealing::abort(std::runtime_error exception) {
+  m_cancelled = true;
+  ThreadScheduler::abort(exception);
+}
+
+/// @return the number of tasks in the queues, not counting running tasks
+size_t ThreadSchedulerWorkStealing::size() { return m_queued; }
+
+/// @return true once no task is queued or running, or after cancellation
+bool ThreadSchedulerWorkStealing::empty() {
+  return m_cancelled || m_pending == 0;
+}
+
+/// Delete all tasks in the queues
+void ThreadSchedulerWorkStealing::clear() {
+  for (auto &queue : m_queues) {
+    std::lock_guard<std::mutex> lock(queue->lock);
+    const size_t numTasks = queue->tasks.size();
+    for (auto task : queue->tasks)
+      delete task;
+    queue->tasks.clear();
+    queue->cost.store(0.0);
+    m_queued -= numTasks;
+    m_pending -= numTasks;
+  }
+}
+
+/// @return the total cost of the tasks in the queues
+double ThreadSchedulerWorkStealing::totalCost() {
+  double cost(0.0);
+  for (const auto &queue : m_queues)
+    cost += queue->cost.load();
+  return cost;
+}
+
+/** Stop scheduling: all queued tasks are deleted, as are tasks pushed later.
+ * Tasks already running are left to finish, and may check cancelled().
+ */
+void ThreadSchedulerWorkStealing::cancel() {
+  m_cancelled = true;
+  clear();
+}
+
+/// @return true if cancel() was called or a task threw
+bool ThreadSchedulerWorkStealing::cancelled() const { return m_cancelled; }
+
+/// @return the number of queues, one per worker thread
+size_t ThreadSchedulerWorkStealing::numQueues() const {
+  return m_queues.size();
+}
+
+/// @return the number of tasks taken from the queue of another worker
+size_t ThreadSchedulerWorkStealing::numSteals() const { return m_steals; }
+
+/// @return the index of the queue a task pushed by this thread should go to
+size_t ThreadSchedulerWorkStealing::pushTarget() const {
+  if (t_schedulerId == m_id)
+    return t_queue;
+  size_t target(0);
+  double lowest = m_queues[0]->cost.load();
+  for (size_t i = 1; i < m_queues.size() && lowest > 0.0; ++i) {
+    const double cost = m_queues[i]->cost.load();
+    if (cost < lowest) {
+      target = i;
+      lowest = cost;
+    }
+  }
+  return target;
+}
+
+/** Take a task out of a queue.
+ * @param queue :: the queue
+ * @param fromBack :: take the newest task if true, otherwise the oldest
+ * @return the task, or nullptr if the queue is empty
+ */
+Task *ThreadSchedulerWorkStealing::take(Queue &queue, const bool fromBack) {
+  std::lock_guard<std::mutex> lock(queue.lock);
+  if (queue.tasks.empty())
+    return nullptr;
+  Task *task;
+  if (fromBack) {
+    task = queue.tasks.back();
+    queue.tasks.pop_back();
+  } else {
+    task = queue.tasks.front();
+    queue.tasks.pop_front();
+  }
+  // Reset rather than subtract at the end to avoid accumulating rounding
+  if (queue.tasks.empty())
+    queue.cost.store(0.0);
+  else
+    queue.cost.store(queue.cost.load() - task->cost());
+  --m_queued;
+  return task;
+}
+
+/** Take the oldest task of another queue, trying the queue holding the
+ * largest cost first.
+ * @param thief :: the index of the queue of the calling worker
+ * @return the task, or nullptr if all other queues are empty
+ */
+Task *ThreadSchedulerWorkStealing::steal(const size_t thief) {
+  const size_t numQueues = m_queues.size();
+  size_t victim = thief;
+  double highest(0.0);
+  for (size_t i = 1; i < numQueues; ++i) {
+    const size_t index = (thief + i) % numQueues;
+    const double cost = m_queues[index]->cost.load();
+    if (cost > highest) {
+      victim = index;
+      highest = cost;
+    }
+  }
+  Task *task = nullptr;
+  if (victim != thief)
+    task = take(*m_queues[victim], false);
+  // The costs are only a hint: zero-cost tasks or a race with another thief
+  // mean the other queues must still be checked.
+  for (size_t i = 1; !task && i < numQueues; ++i)
+    task = take(*m_queues[(thief + i) % numQueues], false);
+  if (task)
+    ++m_steals;
+  return task;
+}
+
+} // namespace Kernel
+} // namespace Mantid
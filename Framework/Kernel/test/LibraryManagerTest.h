@@ -0,0 +1,176 @@
+#ifndef MANTID_KERNEL_LIBRARYMANAGERTEST_H_
+#define MANTID_KERNEL_LIBRARYMANAGERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/DynamicFactory.h"
+#include "MantidKernel/LibraryManager.h"
+
+#include <Poco/File.h>
+#include <Poco/Path.h>
+
+#include <fstream>
+
+using Mantid::Kernel::DynamicFactory;
+using Mantid::Kernel::LibraryManager;
+using Mantid::Kernel::LibraryManagerImpl;
+
+namespace {
+class FactoryBase {};
+class KindFactory : public DynamicFactory<FactoryBase> {
+public:
+  explicit KindFactory(const std::string &kind)
+      : DynamicFactory<FactoryBase>(kind) {}
+};
+}
+
+class LibraryManagerTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static LibraryManagerTest *createSuite() { return new LibraryManagerTest(); }
+  static void destroySuite(LibraryManagerTest *suite) { delete suite; }
+
+  void setUp() override {
+    m_dir = Poco::Path(Poco::Path::temp(), "LibraryManagerTest").toString();
+    Poco::File(m_dir).createDirectories();
+  }
+
+  void tearDown() override { Poco::File(m_dir).remove(true); }
+
+  void test_manifestPath() {
+    TS_ASSERT_EQUALS(LibraryManagerImpl::manifestPath("/a/libB.so"),
+                     "/a/libB.so.plugin-manifest");
+  }
+
+  void test_readManifest_skips_comments_and_blank_lines() {
+    const auto manifest = write("manifest", "# comment\n"
+                                            "Algorithm Rebin\n"
+                                            "\n"
+                                            "  Function   Gaussian  \n");
+    const auto items = LibraryManagerImpl::readManifest(manifest);
+    TS_ASSERT_EQUALS(items.size(), 2);
+    TS_ASSERT_EQUALS(items[0].first, "Algorithm");
+    TS_ASSERT_EQUALS(items[0].second, "Rebin");
+    TS_ASSERT_EQUALS(items[1].first, "Function");
+    TS_ASSERT_EQUALS(items[1].second, "Gaussian");
+  }
+
+  void test_readManifest_throws_for_invalid_lines() {
+    TS_ASSERT_THROWS(
+        LibraryManagerImpl::readManifest(write("one", "Algorithm\n")),
+        std::runtime_error);
+    TS_ASSERT_THROWS(
+        LibraryManagerImpl::readManifest(write("three", "Algorithm A B\n")),
+        std::runtime_error);
+    TS_ASSERT_THROWS(LibraryManagerImpl::readManifest(m_dir + "/missing"),
+                     std::runtime_error);
+  }
+
+  void test_library_with_manifest_is_deferred() {
+    auto &libraryManager = LibraryManager::Instance();
+    const auto library = write(libraryName(), "not a library");
+    write(libraryName() + ".plugin-manifest",
+          "Algorithm LibraryManagerTestAlg\nLoader LibraryManagerTestAlg\n");
+
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesLazily(
+                         m_dir, LibraryManagerImpl::NonRecursive, {}),
+                     1);
+    TS_ASSERT(libraryManager.hasDeferredLibrary("Algorithm",
+                                                "librarymanagertestalg"));
+    TS_ASSERT(
+        libraryManager.hasDeferredLibrary("Loader", "LibraryManagerTestAlg"));
+    TS_ASSERT(!libraryManager.hasDeferredLibrary("Function",
+                                                 "LibraryManagerTestAlg"));
+    const auto algorithms = libraryManager.deferredItems("Algorithm");
+    TS_ASSERT_EQUALS(algorithms.size(), 1);
+    TS_ASSERT_EQUALS(algorithms.front(), "LibraryManagerTestAlg");
+    TS_ASSERT(libraryManager.deferredItems("Function").empty());
+    // Seen already, so not deferred again
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesLazily(
+                         m_dir, LibraryManagerImpl::NonRecursive, {}),
+                     0);
+
+    // Opening fails as the file is not a library, but it is no longer pending
+    TS_ASSERT_EQUALS(libraryManager.openDeferredLibraries("Function"), 0);
+    TS_ASSERT(libraryManager.hasDeferredLibrary("Algorithm",
+                                                "LibraryManagerTestAlg"));
+    TS_ASSERT(!libraryManager.openLibraryProviding("Algorithm",
+                                                   "LibraryManagerTestAlg"));
+    TS_ASSERT(!libraryManager.hasDeferredLibrary("Algorithm",
+                                                 "LibraryManagerTestAlg"));
+  }
+
+  void test_factory_only_opens_libraries_of_its_kind() {
+    auto &libraryManager = LibraryManager::Instance();
+    write(libraryName("Kinds"), "not a library");
+    write(libraryName("Kinds") + ".plugin-manifest",
+          "Function LibraryManagerTestFunction\n");
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesLazily(
+                         m_dir, LibraryManagerImpl::NonRecursive, {}),
+                     1);
+
+    KindFactory noKind(""), otherKind("Algorithm"), functions("Function");
+    noKind.getKeys();
+    TS_ASSERT(!noKind.exists("LibraryManagerTestFunction"));
+    otherKind.getKeys();
+    TS_ASSERT(!otherKind.exists("LibraryManagerTestFunction"));
+    TS_ASSERT(!functions.exists("Unlisted"));
+    TS_ASSERT(libraryManager.hasDeferredLibrary("Function",
+                                                "LibraryManagerTestFunction"));
+
+    // A miss for a listed name opens the library
+    TS_ASSERT(!functions.exists("LibraryManagerTestFunction"));
+    TS_ASSERT(!libraryManager.hasDeferredLibrary(
+        "Function", "LibraryManagerTestFunction"));
+  }
+
+  void test_library_with_an_empty_manifest_is_not_deferred() {
+    auto &libraryManager = LibraryManager::Instance();
+    write(libraryName("Empty"), "not a library");
+    write(libraryName("Empty") + ".plugin-manifest", "# Generated\n");
+    // Opening is attempted straight away, and fails as it is not a library
+    TS_ASSERT_EQUALS(libraryManager.openLibrariesLazily(
+                         m_dir, LibraryManagerImpl::NonRecursive, {}),
+                     0);
+    TS_ASSERT_EQUALS(libraryManager.openDeferredLibraries(), 0);
+  }
+
+  void test_registrations_are_passed_to_the_observer() {
+    std::vector<std::string> registered;
+    LibraryManagerImpl::setRegistrationObserver(
+        [&registered](const std::string &kind, const std::string &name) {
+          registered.push_back(kind + " " + name);
+        });
+    KindFactory noKind(""), listeners("LiveListener");
+    noKind.subscribe<FactoryBase>("Unlisted");
+    listeners.subscribe<FactoryBase>("TestListener");
+    LibraryManagerImpl::setRegistrationObserver(nullptr);
+    listeners.subscribe<FactoryBase>("AfterObserving");
+
+    TS_ASSERT_EQUALS(registered,
+                     std::vector<std::string>({"LiveListener TestListener"}));
+  }
+
+private:
+  std::string write(const std::string &filename, const std::string &contents) {
+    const auto path = m_dir + "/" + filename;
+    std::ofstream file(path);
+    file << contents;
+    return path;
+  }
+
+  std::string libraryName(const std::string &suffix = "") const {
+#if defined(_WIN32)
+    return "LibraryManagerTestPlugin" + suffix + ".dll";
+#elif defined(__APPLE__)
+    return "libLibraryManagerTestPlugin" + suffix + ".dylib";
+#else
+    return "libLibraryManagerTestPlugin" + suffix + ".so";
+#endif
+  }
+
+  std::string m_dir;
+};
+
+#endif /* MANTID_KERNEL_LIBRARYMANAGERTEST_H_ */
@@ -0,0 +1,119 @@
+#ifndef MANTID_KERNEL_THREADBUDGETTEST_H_
+#define MANTID_KERNEL_THREADBUDGETTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidKernel/ThreadBudget.h"
+
+#include <algorithm>
+#include <thread>
+
+using Mantid::Kernel::ThreadBudget;
+
+class ThreadBudgetTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadBudgetTest *createSuite() { return new ThreadBudgetTest(); }
+  static void destroySuite(ThreadBudgetTest *suite) { delete suite; }
+
+  void setUp() override { ThreadBudget::resetCounters(); }
+
+  void tearDown() override { ThreadBudget::setMaxThreads(0); }
+
+  void test_default_is_at_least_one_thread() {
+    ThreadBudget::setMaxThreads(0);
+    TS_ASSERT(ThreadBudget::maxThreads() >= 1);
+  }
+
+  void test_setMaxThreads() {
+    ThreadBudget::setMaxThreads(3);
+    TS_ASSERT_EQUALS(ThreadBudget::maxThreads(), 3);
+  }
+
+  void test_top_level_region_gets_the_budget() {
+    ThreadBudget::setMaxThreads(4);
+    TS_ASSERT(!ThreadBudget::inParallelRegion());
+    TS_ASSERT_EQUALS(ThreadBudget::teamSize(), capped(4));
+    const auto counters = ThreadBudget::counters();
+    TS_ASSERT_EQUALS(counters.regions, 1);
+    TS_ASSERT_EQUALS(counters.nestedRegions, 0);
+    TS_ASSERT_EQUALS(counters.oversubscriptions, 0);
+  }
+
+  void test_region_in_worker_gets_a_share() {
+    ThreadBudget::setMaxThreads(4);
+    {
+      ThreadBudget::Worker first;
+      TS_ASSERT(ThreadBudget::inParallelRegion());
+      TS_ASSERT_EQUALS(ThreadBudget::busyWorkers(), 1);
+      TS_ASSERT_EQUALS(ThreadBudget::teamSize(), capped(4));
+      ThreadBudget::Worker second;
+      TS_ASSERT_EQUALS(ThreadBudget::teamSize(), capped(2));
+    }
+    TS_ASSERT_EQUALS(ThreadBudget::busyWorkers(), 0);
+    TS_ASSERT(!ThreadBudget::inParallelRegion());
+    TS_ASSERT_EQUALS(ThreadBudget::counters().nestedRegions, 2);
+  }
+
+  void test_top_level_region_leaves_busy_workers_their_threads() {
+    ThreadBudget::setMaxThreads(4);
+    int team(0);
+    {
+      ThreadBudget::Worker worker;
+      // Pretend the caller is not a worker by asking from another thread
+      std::thread other([&team] { team = ThreadBudget::teamSize(); });
+      other.join();
+    }
+    TS_ASSERT_EQUALS(team, capped(3));
+    TS_ASSERT_EQUALS(ThreadBudget::counters().nestedRegions, 0);
+  }
+
+  void test_oversubscription_is_counted() {
+    ThreadBudget::setMaxThreads(1);
+    ThreadBudget::Worker first;
+    TS_ASSERT_EQUALS(ThreadBudget::counters().oversubscriptions, 0);
+    ThreadBudget::Worker second;
+    TS_ASSERT_EQUALS(ThreadBudget::counters().oversubscriptions, 1);
+    TS_ASSERT_EQUALS(ThreadBudget::teamSize(), 1);
+    TS_ASSERT_EQUALS(ThreadBudget::counters().reducedRegions, 0);
+  }
+
+  void test_region_inside_openmp_region_is_serial() {
+    ThreadBudget::setMaxThreads(4);
+    int inner(0);
+    bool active(false);
+    PARALLEL_FOR_NO_WSP_CHECK()
+    for (int i = 0; i < 1; ++i) {
+      active = PARALLEL_IN_REGION;
+      inner = ThreadBudget::teamSize();
+    }
+    // The outer region only runs in parallel if several threads are available
+    if (active) {
+      TS_ASSERT_EQUALS(inner, 1);
+    } else {
+      TS_ASSERT_EQUALS(inner, capped(4));
+    }
+  }
+
+  void test_serial_region_is_not_counted() {
+    ThreadBudget::setMaxThreads(4);
+    TS_ASSERT_EQUALS(ThreadBudget::teamSize(false), 1);
+    int team(0);
+    PARALLEL_FOR_IF(false)
+    for (int i = 0; i < 1; ++i)
+      team = PARALLEL_NUMBER_OF_THREADS;
+    TS_ASSERT_EQUALS(team, 1);
+    const auto counters = ThreadBudget::counters();
+    TS_ASSERT_EQUALS(counters.regions, 0);
+    TS_ASSERT_EQUALS(counters.reducedRegions, 0);
+  }
+
+private:
+  int capped(const int team) {
+    return std::max(std::min(team, PARALLEL_GET_MAX_THREADS), 1);
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADBUDGETTEST_H_ */
@@ -9,6 +9,7 @@
 #include <MantidKernel/ThreadPool.h>
 #include "MantidKernel/ThreadScheduler.h"
 #include "MantidKernel/ThreadSchedulerMutexes.h"
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
 
 #include <Poco/Thread.h>
 
@@ -370,6 +371,10 @@ public:
     do_StressTest_scheduler(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_ThreadSchedulerWorkStealing() {
+    do_StressTest_scheduler(new ThreadSchedulerWorkStealing());
+  }
+
   //--------------------------------------------------------------------
   /** Perform a stress test on the given scheduler.
    * This one creates tasks that create new tasks; e.g. 10 tasks each add
@@ -408,6 +413,10 @@ public:
     do_StressTest_TasksThatCreateTasks(new ThreadSchedulerMutexes());
   }
 
+  void test_StressTest_TasksThatCreateTasks_ThreadSchedulerWorkStealing() {
+    do_StressTest_TasksThatCreateTasks(new ThreadSchedulerWorkStealing());
+  }
+
   //=======================================================================================
   /** Task that throws an exception */
   class TaskThatThrows : public Task {
@@ -430,6 +439,19 @@ public:
     // And only one of the tasks actually ran (since we're on one core)
     TS_ASSERT_EQUALS(ThreadPoolTest_TaskThatThrows_counter, 1);
   }
+
+  void test_TaskThatThrows_ThreadSchedulerWorkStealing() {
+    auto scheduler = new ThreadSchedulerWorkStealing(1);
+    ThreadPool p(scheduler, 1); // one core
+    ThreadPoolTest_TaskThatThrows_counter = 0;
+    for (int i = 0; i < 10; i++) {
+      p.schedule(new TaskThatThrows());
+    }
+    TS_ASSERT_THROWS(p.joinAll(), std::runtime_error);
+    // The exception cancels the remaining tasks
+    TS_ASSERT_EQUALS(ThreadPoolTest_TaskThatThrows_counter, 1);
+    TS_ASSERT(scheduler->cancelled());
+  }
 };
 
 #endif
@@ -0,0 +1,160 @@
+#ifndef MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+#define MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidKernel/ThreadSchedulerWorkStealing.h"
+
+#include <thread>
+
+using namespace Mantid::Kernel;
+
+namespace {
+int ThreadSchedulerWorkStealingTest_timesDeleted;
+
+/// Task that counts its deletions
+class CountedTask : public Task {
+public:
+  explicit CountedTask(double cost) { m_cost = cost; }
+  ~CountedTask() override { ThreadSchedulerWorkStealingTest_timesDeleted++; }
+  void run() override {}
+};
+} // namespace
+
+class ThreadSchedulerWorkStealingTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static ThreadSchedulerWorkStealingTest *createSuite() {
+    return new ThreadSchedulerWorkStealingTest();
+  }
+  static void destroySuite(ThreadSchedulerWorkStealingTest *suite) {
+    delete suite;
+  }
+
+  void setUp() override { ThreadSchedulerWorkStealingTest_timesDeleted = 0; }
+
+  void test_default_has_a_queue_per_core() {
+    ThreadSchedulerWorkStealing sc;
+    TS_ASSERT(sc.numQueues() > 0);
+    ThreadSchedulerWorkStealing two(2);
+    TS_ASSERT_EQUALS(two.numQueues(), 2);
+  }
+
+  void test_push_and_pop() {
+    ThreadSchedulerWorkStealing sc(1);
+    TS_ASSERT(sc.empty());
+    sc.push(new CountedTask(1.0));
+    sc.push(new CountedTask(2.0));
+    TS_ASSERT_EQUALS(sc.size(), 2);
+    TS_ASSERT_EQUALS(sc.totalCost(), 3.0);
+    TS_ASSERT(!sc.empty());
+
+    // A worker takes the newest task of its own queue
+    std::unique_ptr<Task> task(sc.pop(0));
+    TS_ASSERT_EQUALS(task->cost(), 2.0);
+    TS_ASSERT_EQUALS(sc.size(), 1);
+    TS_ASSERT_EQUALS(sc.totalCost(), 1.0);
+    task.reset(sc.pop(0));
+    TS_ASSERT_EQUALS(task->cost(), 1.0);
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT(!sc.pop(0));
+  }
+
+  void test_not_empty_while_a_task_is_running() {
+    ThreadSchedulerWorkStealing sc(1);
+    sc.push(new CountedTask(1.0));
+    std::unique_ptr<Task> task(sc.pop(0));
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    // The running task could still push more
+    TS_ASSERT(!sc.empty());
+    sc.finished(task.get(), 0);
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_external_push_goes_to_the_cheapest_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    sc.push(new CountedTask(5.0));
+    sc.push(new CountedTask(1.0));
+    sc.push(new CountedTask(2.0));
+    // Costs are now 5 in queue 0 and 3 in queue 1
+    std::thread worker([&sc] {
+      std::unique_ptr<Task> task(sc.pop(1));
+      TS_ASSERT_EQUALS(task->cost(), 2.0);
+      task.reset(sc.pop(1));
+      TS_ASSERT_EQUALS(task->cost(), 1.0);
+    });
+    worker.join();
+  }
+
+  void test_nested_push_goes_to_own_queue() {
+    ThreadSchedulerWorkStealing sc(2);
+    sc.push(new CountedTask(1.0));
+    sc.push(new CountedTask(1.0));
+    std::thread worker([&sc] {
+      std::unique_ptr<Task> task(sc.pop(1));
+      // Pushed while running a task of queue 1, so it stays there
+      sc.push(new CountedTask(10.0));
+      task.reset(sc.pop(1));
+      TS_ASSERT_EQUALS(task->cost(), 10.0);
+    });
+    worker.join();
+    TS_ASSERT_EQUALS(sc.numSteals(), 0);
+  }
+
+  void test_steal_takes_oldest_task_of_largest_queue() {
+    ThreadSchedulerWorkStealing sc(3);
+    std::thread owner([&sc] {
+      sc.pop(2);
+      sc.push(new CountedTask(3.0));
+      sc.push(new CountedTask(4.0));
+    });
+    owner.join();
+    sc.push(new CountedTask(1.0));
+    std::thread thief([&sc] {
+      // Queue 1 is empty and queue 2 holds the largest cost
+      std::unique_ptr<Task> task(sc.pop(1));
+      TS_ASSERT_EQUALS(task->cost(), 3.0);
+    });
+    thief.join();
+    TS_ASSERT_EQUALS(sc.numSteals(), 1);
+    TS_ASSERT_EQUALS(sc.size(), 2);
+  }
+
+  void test_clear_deletes_tasks() {
+    ThreadSchedulerWorkStealing sc(2);
+    for (int i = 0; i < 4; ++i)
+      sc.push(new CountedTask(1.0));
+    sc.clear();
+    TS_ASSERT_EQUALS(ThreadSchedulerWorkStealingTest_timesDeleted, 4);
+    TS_ASSERT_EQUALS(sc.size(), 0);
+    TS_ASSERT_EQUALS(sc.totalCost(), 0.0);
+    TS_ASSERT(sc.empty());
+  }
+
+  void test_cancel() {
+    ThreadSchedulerWorkStealing sc(2);
+    sc.push(new CountedTask(1.0));
+    sc.push(new CountedTask(1.0));
+    TS_ASSERT(!sc.cancelled());
+    sc.cancel();
+    TS_ASSERT(sc.cancelled());
+    TS_ASSERT(sc.empty());
+    TS_ASSERT_EQUALS(ThreadSchedulerWorkStealingTest_timesDeleted, 2);
+    // Tasks pushed later are discarded
+    sc.push(new CountedTask(1.0));
+    TS_ASSERT_EQUALS(ThreadSchedulerWorkStealingTest_timesDeleted, 3);
+    TS_ASSERT(!sc.pop(0));
+  }
+
+  void test_abort_cancels() {
+    ThreadSchedulerWorkStealing sc(1);
+    sc.push(new CountedTask(1.0));
+    sc.abort(std::runtime_error("test"));
+    TS_ASSERT(sc.getAborted());
+    TS_ASSERT(sc.cancelled());
+    TS_ASSERT_EQUALS(sc.size(), 0);
+  }
+};
+
+#endif /* MANTID_KERNEL_THREADSCHEDULERWORKSTEALINGTEST_H_ */
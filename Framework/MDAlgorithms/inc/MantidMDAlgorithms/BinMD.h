@@ -49,6 +49,11 @@ public:
     return "MDAlgorithms\\Slicing";
   }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   /// Initialise the properties
   void init() override;
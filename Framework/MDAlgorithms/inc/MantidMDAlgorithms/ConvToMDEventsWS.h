@@ -66,6 +66,14 @@ private:
   // the pointer to the source event workspace as event ws does not work through
   // the public Matrix WS interface
   DataObjects::EventWorkspace_const_sptr m_EventWS;
+  /// Buffers of the converted events which have not been added yet: the
+  /// coordinates, signal and error squared, run index and detector ID
+  std::vector<coord_t> m_allCoord;
+  std::vector<float> m_sigErr;
+  std::vector<uint16_t> m_runIndex;
+  std::vector<uint32_t> m_detIds;
+
+  void flushEvents();
 
   /**function converts particular type of events into MD space and add these
    * events to the workspace itself    */
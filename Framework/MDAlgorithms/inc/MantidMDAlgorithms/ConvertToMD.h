@@ -65,6 +65,11 @@ public:
   /// Algorithm's version for identification
   int version() const override;
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   std::map<std::string, std::string> validateInputs() override;
   void exec() override;
@@ -42,6 +42,11 @@ public:
 
   int version() const override { return 1; }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 protected: // for testing
   void findMinMaxValues(MDWSDescription &WSDescription,
                         MDTransfInterface *const pQtransf,
@@ -87,7 +87,11 @@ public:
   /// the accessor verify if there are boxes in box-splitter cash which need
   /// splitting;
   bool ifNeedsSplitting() const { return m_needSplitting; }
-  /// method splits list of boxes not yet uses thread sheduler but may be later
+  /// set the most OpenMP threads used to add data and split boxes; negative
+  /// for all cores, 0 (the default) to add and split serially
+  void setNumThreads(int numThreads) { m_numThreads = numThreads; }
+  /// method splits all boxes which need splitting, using up to the number of
+  /// OpenMP threads set by setNumThreads() rather than the thread sheduler
   void splitList(Kernel::ThreadScheduler *) {
     (this->*(mdBoxListSplitter[m_NDimensions]))();
   }
@@ -139,6 +143,8 @@ private:
   // the variable, which informs the user of MD Event WS wrapper that there are
   // boxes to split; Very simple for the time being
   mutable bool m_needSplitting;
+  /// the most OpenMP threads used to add data and split boxes
+  int m_numThreads;
 };
 
 } // endnamespace MDAlgorithms
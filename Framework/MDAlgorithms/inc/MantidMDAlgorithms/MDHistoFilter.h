@@ -0,0 +1,67 @@
+#ifndef MANTID_MDALGORITHMS_MDHISTOFILTER_H_
+#define MANTID_MDALGORITHMS_MDHISTOFILTER_H_
+
+#include "MantidKernel/System.h"
+
+#include <vector>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+/** MDHistoFilter : Convolves arrays laid out like the signal array of an
+  MDHistoWorkspace, i.e. with the first dimension varying fastest, with 1D
+  kernels along one dimension at a time.
+
+  A separable kernel, such as a hat or Gaussian, is applied to the whole
+  array by convolving along each dimension in turn. This costs O(N k) rather
+  than O(N k^d) for a kernel of width k in d dimensions. The lines of bins
+  parallel to the dimension are spread over threads. Each line is convolved
+  directly, or via FFT when the kernel is wide compared to the line and the
+  line holds only finite values.
+
+  Kernels are truncated at the ends of the lines, as if the array was padded
+  with zeros. Normalised filters that respect masks are built by convolving
+  the masked data and the mask itself and dividing the results.
+
+  Copyright &copy; 2017 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+  National Laboratory & European Spallation Source
+
+  This file is part of Mantid.
+
+  Mantid is free software; you can redistribute it and/or modify
+  it under the terms of the GNU General Public License as published by
+  the Free Software Foundation; either version 3 of the License, or
+  (at your option) any later version.
+
+  Mantid is distributed in the hope that it will be useful,
+  but WITHOUT ANY WARRANTY; without even the implied warranty of
+  MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+  GNU General Public License for more details.
+
+  You should have received a copy of the GNU General Public License
+  along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+  File change history is stored at: <https://github.com/mantidproject/mantid>
+  Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+class DLLExport MDHistoFilter {
+public:
+  explicit MDHistoFilter(const std::vector<size_t> &shape);
+
+  size_t size() const;
+  void convolve(std::vector<double> &data, const size_t dimension,
+                const std::vector<double> &kernel) const;
+  static bool useFFT(const size_t length, const size_t kernelSize);
+
+private:
+  /// Number of bins along each dimension
+  std::vector<size_t> m_shape;
+  /// Distance between neighbouring bins along each dimension
+  std::vector<size_t> m_strides;
+  size_t m_size;
+};
+
+} // namespace MDAlgorithms
+} // namespace Mantid
+
+#endif /* MANTID_MDALGORITHMS_MDHISTOFILTER_H_ */
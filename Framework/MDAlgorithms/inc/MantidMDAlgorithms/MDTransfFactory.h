@@ -100,7 +100,8 @@ public:
 
 private:
   /// Private Constructor for singleton class
-  MDTransfFactoryImpl() = default;
+  MDTransfFactoryImpl()
+      : Kernel::DynamicFactory<MDTransfInterface>("MDTransf") {}
   friend struct Kernel::CreateUsingNew<MDTransfFactoryImpl>;
   /// Stores pointers to already created unit instances, with their name as the
   /// key
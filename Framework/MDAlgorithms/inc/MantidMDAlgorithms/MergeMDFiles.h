@@ -74,11 +74,27 @@ private:
 
   uint64_t loadEventsFromSubBoxes(API::IMDNode *TargetBox);
 
+  void mergeBoxesInBatches();
+  void readBatch(const std::vector<API::IMDNode *> &batch);
+  void addBatchToBoxes(const std::vector<API::IMDNode *> &batch);
+
   // the class which flatten the box structure and deal with it
   DataObjects::MDBoxFlatTree m_BoxStruct;
   // the vector of box structures for contributing files components
   std::vector<DataObjects::MDBoxFlatTree> m_fileComponentsStructure;
 
+  /// Event data of a batch of boxes read from one of the files
+  struct BatchRows {
+    /// Rows of consecutive boxes in the file, each read with one call
+    std::vector<std::vector<coord_t>> blocks;
+    /// Block and first row of each box of the batch
+    std::vector<std::pair<size_t, size_t>> boxRows;
+    /// Number of columns of a row, zero if nothing was read
+    size_t nColumns = 0;
+  };
+  // the event data of the current batch from all files
+  std::vector<BatchRows> m_batchRows;
+
 protected:
   /// Set to true if the output is cloned of the first one
   // bool clonedFirst;
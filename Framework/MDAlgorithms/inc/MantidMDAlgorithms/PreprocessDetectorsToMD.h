@@ -61,6 +61,11 @@ public:
     return "MDAlgorithms\\Utility";
   }
 
+protected:
+  Parallel::ExecutionMode getParallelExecutionMode(
+      const std::map<std::string, Parallel::StorageMode> &storageModes)
+      const override;
+
 private:
   void init() override;
   void exec() override;
@@ -65,6 +65,13 @@ public:
 private:
   void init() override;
   void exec() override;
+
+  boost::shared_ptr<Mantid::API::IMDHistoWorkspace> separableSmooth(
+      boost::shared_ptr<const Mantid::API::IMDHistoWorkspace> toSmooth,
+      const std::vector<std::vector<double>> &kernels,
+      boost::optional<boost::shared_ptr<const Mantid::API::IMDHistoWorkspace>>
+          weightingWS,
+      const bool propagateErrors);
 };
 
 } // namespace MDAlgorithms
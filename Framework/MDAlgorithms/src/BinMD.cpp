@@ -15,6 +15,8 @@
 #include "MantidKernel/Strings.h"
 #include "MantidKernel/System.h"
 #include "MantidKernel/Utils.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
 #include <boost/algorithm/string.hpp>
 
 namespace Mantid {
@@ -28,6 +30,17 @@ using namespace Mantid::API;
 using namespace Mantid::Geometry;
 using namespace Mantid::DataObjects;
 
+namespace {
+/// Replace values by their sum over all ranks
+void sumOverRanks(const Parallel::Communicator &comm, signal_t *values,
+                  const size_t size) {
+  std::vector<signal_t> sum(size);
+  Parallel::all_reduce(comm, values, static_cast<int>(size), sum.data(),
+                       std::plus<signal_t>());
+  std::copy(sum.begin(), sum.end(), values);
+}
+}
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -429,6 +442,15 @@ void BinMD::exec() {
 
   CALL_MDEVENT_FUNCTION(this->binByIterating, m_inWS);
 
+  // Each rank binned the events it holds, sum the partial histograms
+  if (m_inWS->storageMode() == Parallel::StorageMode::Distributed &&
+      communicator().size() > 1) {
+    const size_t nPoints = outWS->getNPoints();
+    sumOverRanks(communicator(), outWS->getSignalArray(), nPoints);
+    sumOverRanks(communicator(), outWS->getErrorSquaredArray(), nPoints);
+    sumOverRanks(communicator(), outWS->getNumEventsArray(), nPoints);
+  }
+
   // Copy the coordinate system & experiment infos to the output
   IMDEventWorkspace_sptr inEWS =
       boost::dynamic_pointer_cast<IMDEventWorkspace>(m_inWS);
@@ -452,5 +474,17 @@ void BinMD::exec() {
   setProperty("OutputWorkspace", boost::dynamic_pointer_cast<Workspace>(outWS));
 }
 
+Parallel::ExecutionMode BinMD::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  const auto inputMode = storageModes.at("InputWorkspace");
+  // Accumulating into a cloned workspace would add its content once per rank
+  if (inputMode == Parallel::StorageMode::Distributed &&
+      storageModes.count("TemporaryDataWorkspace"))
+    throw std::runtime_error("TemporaryDataWorkspace cannot be used with a " +
+                             Parallel::toString(inputMode) +
+                             " InputWorkspace.");
+  return Parallel::getCorrespondingExecutionMode(inputMode);
+}
+
 } // namespace Mantid
 } // namespace DataObjects
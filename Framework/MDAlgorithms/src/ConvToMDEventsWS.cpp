@@ -28,17 +28,9 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
     return 0; // skip if any y outsize of the range of interest;
   localUnitConv.updateConversion(workspaceIndex);
   //
-  // allocate temporary buffers for MD Events data
-  // MD events coordinates buffer
-  std::vector<coord_t> allCoord;
-  std::vector<float> sig_err;      // array for signal and error.
-  std::vector<uint16_t> run_index; // Buffer for run index for each event
-  std::vector<uint32_t> det_ids;   // Buffer of det Id-s for each event
-
-  allCoord.reserve(this->m_NDims * numEvents);
-  sig_err.reserve(2 * numEvents);
-  run_index.reserve(numEvents);
-  det_ids.reserve(numEvents);
+  // the events are appended to the buffers of MD Events data, which are added
+  // to the workspace by flushEvents()
+  const size_t nBufferedEvents = m_runIndex.size();
 
   // This little dance makes the getting vector of events more general (since
   // you can't overload by return type).
@@ -54,18 +46,25 @@ size_t ConvToMDEventsWS::convertEventList(size_t workspaceIndex) {
     if (!m_QConverter->calcMatrixCoord(val, locCoord, signal, errorSq))
       continue; // skip ND outside the range
 
-    sig_err.push_back(static_cast<float>(signal));
-    sig_err.push_back(static_cast<float>(errorSq));
-    run_index.push_back(runIndexLoc);
-    det_ids.push_back(detID);
-    allCoord.insert(allCoord.end(), locCoord.begin(), locCoord.end());
+    m_sigErr.push_back(static_cast<float>(signal));
+    m_sigErr.push_back(static_cast<float>(errorSq));
+    m_runIndex.push_back(runIndexLoc);
+    m_detIds.push_back(detID);
+    m_allCoord.insert(m_allCoord.end(), locCoord.begin(), locCoord.end());
   }
 
-  // Add them to the MDEW
-  size_t n_added_events = run_index.size();
-  m_OutWSWrapper->addMDData(sig_err, run_index, det_ids, allCoord,
-                            n_added_events);
-  return n_added_events;
+  return m_runIndex.size() - nBufferedEvents;
+}
+
+/** Add the converted events collected in the buffers to the workspace in one
+ * go and empty the buffers */
+void ConvToMDEventsWS::flushEvents() {
+  m_OutWSWrapper->addMDData(m_sigErr, m_runIndex, m_detIds, m_allCoord,
+                            m_runIndex.size());
+  m_allCoord.clear();
+  m_sigErr.clear();
+  m_runIndex.clear();
+  m_detIds.clear();
 }
 
 /** The method runs conversion for a single event list, corresponding to a
@@ -124,50 +123,35 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
   // preprocessed detectors insure that each detector has its own spectra
   size_t nValidSpectra = m_NSpectra;
 
-  //--->>> Thread control stuff
-  Kernel::ThreadSchedulerFIFO *ts(nullptr);
-
-  int nThreads(m_NumThreads);
-  if (nThreads < 0)
-    nThreads = 0; // negative m_NumThreads correspond to all cores used, 0 no
-                  // threads and positive number -- nThreads requested;
-  bool runMultithreaded = false;
-  if (m_NumThreads != 0) {
-    runMultithreaded = true;
-    // Create the thread pool that will run all of these. It will be deleted by
-    // the threadpool
-    ts = new Kernel::ThreadSchedulerFIFO();
-    // it will initiate thread pool with number threads or machine's cores (0 in
-    // tp constructor)
+  // negative m_NumThreads correspond to all cores used, 0 no threads and
+  // positive number -- nThreads requested; the events are added and the boxes
+  // split with up to that many OpenMP threads
+  m_OutWSWrapper->setNumThreads(m_NumThreads);
+  if (m_NumThreads != 0)
     pProgress->resetNumSteps(nValidSpectra, 0, 1);
-  }
-  Kernel::ThreadPool tp(ts, nThreads, new API::Progress(*pProgress));
-  //<<<--  Thread control stuff
 
   // if any property dimension is outside of the data range requested, the job
   // is done;
   if (!m_QConverter->calcGenericVariables(m_Coord, m_NDims))
     return;
 
+  // The converted events of several spectra are added together, so that each
+  // thread gets enough events from a bulk insertion
+  const size_t eventsPerFlush = bc->getAddingEvents_eventsPerTask() *
+                                bc->getAddingEvents_numTasksPerBlock();
+
   size_t eventsAdded = 0;
   for (size_t wi = 0; wi < nValidSpectra; wi++) {
 
     size_t nConverted = this->conversionChunk(wi);
     eventsAdded += nConverted;
     nEventsInWS += nConverted;
+    if (m_runIndex.size() >= eventsPerFlush)
+      flushEvents();
     // Keep a running total of how many events we've added
     if (bc->shouldSplitBoxes(nEventsInWS, eventsAdded, lastNumBoxes)) {
-      if (runMultithreaded) {
-        // Now do all the splitting tasks
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
-        if (ts->size() > 0)
-          tp.joinAll();
-      } else {
-        m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(
-            nullptr); // it is done this way as it is possible trying to do
-                      // single
-                      // threaded split more efficiently
-      }
+      flushEvents();
+      m_OutWSWrapper->splitList(nullptr);
       // Count the new # of boxes.
       lastNumBoxes = m_OutWSWrapper->pWorkspace()
                          ->getBoxController()
@@ -177,12 +161,8 @@ void ConvToMDEventsWS::runConversion(API::Progress *pProgress) {
     }
   }
   // Do a final splitting of everything
-  if (runMultithreaded) {
-    m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(ts);
-    tp.joinAll();
-  } else {
-    m_OutWSWrapper->pWorkspace()->splitAllIfNeeded(nullptr);
-  }
+  flushEvents();
+  m_OutWSWrapper->splitList(nullptr);
 
   // Recount totals at the end.
   m_OutWSWrapper->pWorkspace()->refreshCache();
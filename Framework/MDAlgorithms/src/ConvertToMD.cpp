@@ -16,6 +16,8 @@
 #include "MantidKernel/ListValidator.h"
 #include "MantidKernel/PhysicalConstants.h"
 #include "MantidKernel/VisibleWhenProperty.h"
+#include "MantidParallel/Collectives.h"
+#include "MantidParallel/Communicator.h"
 
 #include "MantidDataObjects/EventWorkspace.h"
 #include "MantidDataObjects/TableWorkspace.h"
@@ -129,6 +131,13 @@ std::map<std::string, std::string> ConvertToMD::validateInputs() {
     result["Filename"] = "Filename must be given if FileBackEnd is required.";
   }
 
+  MatrixWorkspace_const_sptr inputWS = this->getProperty("InputWorkspace");
+  if (fileBackEnd && inputWS && communicator().size() > 1 &&
+      inputWS->storageMode() == Parallel::StorageMode::Distributed) {
+    result["FileBackEnd"] =
+        "FileBackEnd is not supported for distributed input workspaces.";
+  }
+
   std::vector<double> minVals = this->getProperty("MinValues");
   std::vector<double> maxVals = this->getProperty("MaxValues");
 
@@ -227,9 +236,11 @@ void ConvertToMD::exec() {
                                dimMax, QFrame, convertTo_, targWSDescr);
 
   // create and initiate new workspace or set up existing workspace as a target.
-  if (createNewTargetWs) // create new
+  if (createNewTargetWs) { // create new
     spws = this->createNewMDWorkspace(targWSDescr, fileBackEnd, out_filename);
-  else // setup existing MD workspace as workspace target.
+    // With distributed input every rank holds the events of its own spectra
+    spws->setStorageMode(m_InWS2D->storageMode());
+  } else // setup existing MD workspace as workspace target.
     m_OutWSWrapper->setMDWS(spws);
 
   // pre-process detectors;
@@ -667,7 +678,7 @@ void ConvertToMD::findMinMax(
     throw(std::runtime_error(
         "Can not create child ChildAlgorithm to found min/max values"));
 
-  childAlg->setPropertyValue("InputWorkspace", inWS->getName());
+  childAlg->setProperty("InputWorkspace", inWS);
   childAlg->setPropertyValue("QDimensions", QMode);
   childAlg->setPropertyValue("dEAnalysisMode", dEMode);
   childAlg->setPropertyValue("Q3DFrames", QFrame);
@@ -683,6 +694,19 @@ void ConvertToMD::findMinMax(
   minVal = childAlg->getProperty("MinValues");
   maxVal = childAlg->getProperty("MaxValues");
 
+  // All ranks of a distributed conversion must use the same extents
+  if (inWS->storageMode() == Parallel::StorageMode::Distributed &&
+      communicator().size() > 1) {
+    const auto &comm = communicator();
+    std::vector<double> extrema(comm.size());
+    for (size_t i = 0; i < minVal.size(); ++i) {
+      Parallel::all_gather(comm, minVal[i], extrema);
+      minVal[i] = *std::min_element(extrema.begin(), extrema.end());
+      Parallel::all_gather(comm, maxVal[i], extrema);
+      maxVal[i] = *std::max_element(extrema.begin(), extrema.end());
+    }
+  }
+
   // if some min-max values for dimensions produce ws with 0 width in this
   // direction, change it to have some width;
   for (unsigned int i = 0; i < nDim; i++) {
@@ -724,6 +748,12 @@ void ConvertToMD::findMinMax(
   }
 }
 
+Parallel::ExecutionMode ConvertToMD::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
+
 /**
  * Setup the filebackend for the output workspace. It assumes that the
  * box controller has already been initialized
@@ -179,5 +179,13 @@ void ConvertToMDMinMaxLocal::findMinMaxValues(MDWSDescription &WSDescription,
     }
   }
 }
+
+/// Limits are found for the spectra held by each rank. Callers needing
+/// limits of the whole distributed workspace must combine them.
+Parallel::ExecutionMode ConvertToMDMinMaxLocal::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
 } // namespace MDAlgorithms
 } // namespace Mantid
@@ -63,7 +63,9 @@ void MDEventWSWrapper::createEmptyEventWS<0>(const MDWSDescription &) {
 /** templated by number of dimensions function to add multidimensional data to
 the workspace
 * it is  expected that all MD coordinates are within the ranges of MD defined
-workspace, so no checks are performed
+workspace, so no checks are performed. If the wrapper was given threads by
+setNumThreads(), the events are added by several threads without locking the
+boxes, so no other thread may add data at the same time
 
    tempate parameter:
      * nd -- number of dimensions
@@ -88,11 +90,21 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
           DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *>(
           m_Workspace.get());
   if (pWs) {
+    if (m_numThreads == 0) {
+      for (size_t i = 0; i < dataSize; i++) {
+        pWs->addEvent(DataObjects::MDEvent<nd>(
+            *(sigErr + 2 * i), *(sigErr + 2 * i + 1), *(runIndex + i),
+            *(detId + i), (Coord + i * nd)));
+      }
+      return;
+    }
+    std::vector<DataObjects::MDEvent<nd>> events;
+    events.reserve(dataSize);
     for (size_t i = 0; i < dataSize; i++) {
-      pWs->addEvent(DataObjects::MDEvent<nd>(
-          *(sigErr + 2 * i), *(sigErr + 2 * i + 1), *(runIndex + i),
-          *(detId + i), (Coord + i * nd)));
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          *(runIndex + i), *(detId + i), (Coord + i * nd));
     }
+    pWs->addEventsInParallel(events, m_numThreads);
   } else {
     DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *const
         pLWs = dynamic_cast<
@@ -104,10 +116,20 @@ void MDEventWSWrapper::addMDDataND(float *sigErr, uint16_t *runIndex,
                                "does not correspond to type of events you try "
                                "to add to it");
 
+    if (m_numThreads == 0) {
+      for (size_t i = 0; i < dataSize; i++) {
+        pLWs->addEvent(DataObjects::MDLeanEvent<nd>(
+            *(sigErr + 2 * i), *(sigErr + 2 * i + 1), (Coord + i * nd)));
+      }
+      return;
+    }
+    std::vector<DataObjects::MDLeanEvent<nd>> events;
+    events.reserve(dataSize);
     for (size_t i = 0; i < dataSize; i++) {
-      pLWs->addEvent(DataObjects::MDLeanEvent<nd>(
-          *(sigErr + 2 * i), *(sigErr + 2 * i + 1), (Coord + i * nd)));
+      events.emplace_back(*(sigErr + 2 * i), *(sigErr + 2 * i + 1),
+                          (Coord + i * nd));
     }
+    pLWs->addEventsInParallel(events, m_numThreads);
   }
 }
 
@@ -120,14 +142,25 @@ void MDEventWSWrapper::addMDDataND<0>(float *, uint16_t *, uint32_t *,
                               "to 0-dimensional workspace"));
 }
 
-/***/
+/** templated by number of dimensions function to split all boxes of the
+ * workspace which contain too many events; the trees below the top-level boxes
+ * are split in parallel if the wrapper was given threads by setNumThreads() */
 template <size_t nd> void MDEventWSWrapper::splitBoxList() {
   DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *const pWs =
       dynamic_cast<
           DataObjects::MDEventWorkspace<DataObjects::MDEvent<nd>, nd> *>(
           m_Workspace.get());
-  if (!pWs)
-    throw(std::bad_cast());
+  if (pWs) {
+    pWs->splitAllInParallel(m_numThreads);
+  } else {
+    DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *const
+        pLWs = dynamic_cast<
+            DataObjects::MDEventWorkspace<DataObjects::MDLeanEvent<nd>, nd> *>(
+            m_Workspace.get());
+    if (!pLWs)
+      throw(std::bad_cast());
+    pLWs->splitAllInParallel(m_numThreads);
+  }
 
   m_needSplitting = false;
 }
@@ -265,7 +298,7 @@ public:
 
 /**constructor */
 MDEventWSWrapper::MDEventWSWrapper()
-    : m_NDimensions(0), m_needSplitting(false) {
+    : m_NDimensions(0), m_needSplitting(false), m_numThreads(0) {
   wsCreator.resize(MAX_N_DIM + 1);
   mdEvAddAndForget.resize(MAX_N_DIM + 1);
   mdCalCentroid.resize(MAX_N_DIM + 1);
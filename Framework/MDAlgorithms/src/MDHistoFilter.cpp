@@ -0,0 +1,197 @@
+#include "MantidMDAlgorithms/MDHistoFilter.h"
+#include "MantidKernel/MultiThreaded.h"
+
+#include <gsl/gsl_fft_complex.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+
+namespace Mantid {
+namespace MDAlgorithms {
+
+namespace {
+/// Smallest power of two not less than n
+size_t nextPowerOfTwo(const size_t n) {
+  size_t power = 1;
+  while (power < n)
+    power <<= 1;
+  return power;
+}
+
+/// Number of kernel elements either side of the centre that reach a bin of
+/// a line of the given length
+size_t effectiveRadius(const size_t length, const size_t kernelSize) {
+  return std::min(kernelSize / 2, length - 1);
+}
+
+/// Length of the zero-padded lines for convolution via FFT, long enough for
+/// the circular convolution not to wrap around
+size_t paddedLength(const size_t length, const size_t kernelSize) {
+  return nextPowerOfTwo(length + 2 * effectiveRadius(length, kernelSize));
+}
+
+/**
+ * Convolve one line directly, treating bins beyond its ends as zero.
+ * @param in : the line
+ * @param out : the result, of the same length
+ * @param length : number of bins in the line
+ * @param kernel : the kernel, centred on its middle element
+ */
+void convolveDirect(const double *in, double *out, const size_t length,
+                    const std::vector<double> &kernel) {
+  const auto radius = static_cast<int64_t>(kernel.size() / 2);
+  const auto n = static_cast<int64_t>(length);
+  for (int64_t i = 0; i < n; ++i) {
+    const int64_t first = std::max(-radius, -i);
+    const int64_t last = std::min(radius, n - 1 - i);
+    double sum = 0.0;
+    for (int64_t j = first; j <= last; ++j)
+      sum += kernel[radius + j] * in[i + j];
+    out[i] = sum;
+  }
+}
+
+/**
+ * Fourier transform of the kernel, arranged for the circular convolution of
+ * zero-padded lines.
+ * @param kernel : the kernel, centred on its middle element
+ * @param length : number of bins in the lines
+ * @return the transform as packed complex numbers
+ */
+std::vector<double> kernelSpectrum(const std::vector<double> &kernel,
+                                   const size_t length) {
+  const size_t padded = paddedLength(length, kernel.size());
+  const auto radius =
+      static_cast<int64_t>(effectiveRadius(length, kernel.size()));
+  const auto centre = static_cast<int64_t>(kernel.size() / 2);
+  std::vector<double> spectrum(2 * padded, 0.0);
+  for (int64_t shift = -radius; shift <= radius; ++shift) {
+    const auto index = static_cast<size_t>(shift + padded) % padded;
+    spectrum[2 * index] = kernel[centre - shift];
+  }
+  gsl_fft_complex_radix2_forward(spectrum.data(), 1, padded);
+  return spectrum;
+}
+
+/**
+ * Convolve one line via FFT, treating bins beyond its ends as zero.
+ * @param in : the line
+ * @param out : the result, of the same length
+ * @param length : number of bins in the line
+ * @param spectrum : transform of the kernel from kernelSpectrum()
+ * @param buffer : workspace of the same size as the spectrum
+ */
+void convolveFFT(const double *in, double *out, const size_t length,
+                 const std::vector<double> &spectrum,
+                 std::vector<double> &buffer) {
+  const size_t padded = spectrum.size() / 2;
+  std::fill(buffer.begin(), buffer.end(), 0.0);
+  for (size_t i = 0; i < length; ++i)
+    buffer[2 * i] = in[i];
+  gsl_fft_complex_radix2_forward(buffer.data(), 1, padded);
+  for (size_t k = 0; k < padded; ++k) {
+    const double re = buffer[2 * k];
+    const double im = buffer[2 * k + 1];
+    buffer[2 * k] = re * spectrum[2 * k] - im * spectrum[2 * k + 1];
+    buffer[2 * k + 1] = re * spectrum[2 * k + 1] + im * spectrum[2 * k];
+  }
+  gsl_fft_complex_radix2_inverse(buffer.data(), 1, padded);
+  for (size_t i = 0; i < length; ++i)
+    out[i] = buffer[2 * i];
+}
+} // namespace
+
+/**
+ * Constructor
+ * @param shape : number of bins along each dimension, the first varying
+ * fastest in the arrays to filter
+ */
+MDHistoFilter::MDHistoFilter(const std::vector<size_t> &shape)
+    : m_shape(shape), m_strides(shape.size()), m_size(shape.empty() ? 0 : 1) {
+  for (size_t dim = 0; dim < shape.size(); ++dim) {
+    m_strides[dim] = m_size;
+    m_size *= shape[dim];
+  }
+}
+
+/// @return the number of bins in the arrays to filter
+size_t MDHistoFilter::size() const { return m_size; }
+
+/**
+ * Convolve an array with a kernel along one dimension.
+ * @param data : the array, which is replaced by the result
+ * @param dimension : index of the dimension to convolve along
+ * @param kernel : the kernel, with an odd number of elements and centred on
+ * the middle one
+ * @throw std::invalid_argument if the arguments do not match the shape
+ */
+void MDHistoFilter::convolve(std::vector<double> &data, const size_t dimension,
+                             const std::vector<double> &kernel) const {
+  if (dimension >= m_shape.size())
+    throw std::invalid_argument("MDHistoFilter: dimension out of range");
+  if (kernel.size() % 2 == 0)
+    throw std::invalid_argument(
+        "MDHistoFilter: the kernel must have an odd number of elements");
+  if (data.size() != m_size)
+    throw std::invalid_argument(
+        "MDHistoFilter: the array does not match the shape");
+
+  const size_t length = m_shape[dimension];
+  if (length == 0)
+    return;
+  const size_t stride = m_strides[dimension];
+  const size_t numLines = m_size / length;
+  const bool fft = useFFT(length, kernel.size());
+  const std::vector<double> spectrum =
+      fft ? kernelSpectrum(kernel, length) : std::vector<double>();
+
+  // Lines are handed out in blocks so that each block allocates its buffers
+  // only once
+  const auto numBlocks = static_cast<int>(std::min(
+      numLines, static_cast<size_t>(8 * PARALLEL_GET_MAX_THREADS)));
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int block = 0; block < numBlocks; ++block) {
+    std::vector<double> in(length);
+    std::vector<double> out(length);
+    std::vector<double> buffer(spectrum.size());
+    const size_t firstLine = numLines * block / numBlocks;
+    const size_t lastLine = numLines * (block + 1) / numBlocks;
+    for (size_t line = firstLine; line < lastLine; ++line) {
+      const size_t start = (line / stride) * stride * length + line % stride;
+      for (size_t i = 0; i < length; ++i)
+        in[i] = data[start + i * stride];
+      // A single NaN or infinity would spoil the whole line in an FFT
+      if (fft && std::all_of(in.cbegin(), in.cend(),
+                             [](const double x) { return std::isfinite(x); }))
+        convolveFFT(in.data(), out.data(), length, spectrum, buffer);
+      else
+        convolveDirect(in.data(), out.data(), length, kernel);
+      for (size_t i = 0; i < length; ++i)
+        data[start + i * stride] = out[i];
+    }
+  }
+}
+
+/**
+ * Whether convolve() uses FFT rather than direct convolution.
+ * @param length : number of bins in a line
+ * @param kernelSize : number of elements in the kernel
+ * @return true if an FFT of the line is expected to be cheaper
+ */
+bool MDHistoFilter::useFFT(const size_t length, const size_t kernelSize) {
+  if (length == 0)
+    return false;
+  const size_t taps = 2 * effectiveRadius(length, kernelSize) + 1;
+  const size_t padded = paddedLength(length, kernelSize);
+  size_t log2Padded = 0;
+  while ((size_t(1) << log2Padded) < padded)
+    ++log2Padded;
+  // Two transforms of the padded line against one multiply-add per bin and
+  // kernel element
+  return length * taps > 4 * padded * log2Padded;
+}
+
+} // namespace MDAlgorithms
+} // namespace Mantid
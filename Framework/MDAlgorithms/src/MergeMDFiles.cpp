@@ -22,6 +22,11 @@ namespace MDAlgorithms {
 // Register the algorithm into the AlgorithmFactory
 DECLARE_ALGORITHM(MergeMDFiles)
 
+namespace {
+/// Approximate number of bytes of events merged at once by a parallel merge
+const uint64_t g_batchSize = 400000000;
+}
+
 //----------------------------------------------------------------------------------------------
 /** Constructor
  */
@@ -54,8 +59,9 @@ void MergeMDFiles::init() {
       "If not, it will be created in memory.");
 
   declareProperty("Parallel", false,
-                  "Run the loading tasks in parallel.\n"
-                  "This can be faster but might use more memory.");
+                  "Merge batches of boxes in parallel, reading and writing "
+                  "the events of a batch together.\n"
+                  "This is faster but uses more memory.");
 
   declareProperty(make_unique<WorkspaceProperty<IMDEventWorkspace>>(
                       "OutputWorkspace", "", Direction::Output),
@@ -182,6 +188,156 @@ uint64_t MergeMDFiles::loadEventsFromSubBoxes(API::IMDNode *TargetBox) {
   return nBoxEvents;
 }
 
+/** Merge the boxes holding events in batches of consecutive boxes, which
+ * limits the memory used to a few times the size of a batch.
+ *
+ * The rows of a batch are read from each file with one call per run of boxes
+ * stored one after another, rather than one call per box. The boxes of the
+ * batch are then assembled in parallel.
+ */
+void MergeMDFiles::mergeBoxesInBatches() {
+  std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
+  const std::vector<uint64_t> &targetEventIndexes = m_BoxStruct.getEventIndex();
+  const uint64_t maxBatchEvents =
+      std::max(uint64_t(1), g_batchSize / m_OutIWS->sizeofEvent());
+
+  std::vector<API::IMDNode *> batch;
+  uint64_t batchEvents(0);
+  for (size_t ib = 0; ib <= boxes.size(); ib++) {
+    uint64_t nEvents(0);
+    if (ib < boxes.size()) {
+      if (!boxes[ib]->isBox())
+        continue;
+      nEvents = targetEventIndexes[2 * boxes[ib]->getID() + 1];
+    }
+    if (!batch.empty() &&
+        (ib == boxes.size() || batchEvents + nEvents > maxBatchEvents)) {
+      this->readBatch(batch);
+      this->addBatchToBoxes(batch);
+      m_progress->reportIncrement(batch.size(), "Loading and merging box data");
+      batch.clear();
+      batchEvents = 0;
+    }
+    if (ib < boxes.size()) {
+      boxes[ib]->clear();
+      batch.push_back(boxes[ib]);
+      batchEvents += nEvents;
+    }
+  }
+  m_batchRows.clear();
+}
+
+/** Read the events of a batch of boxes from all files
+ * @param batch :: boxes of the target workspace holding events
+ */
+void MergeMDFiles::readBatch(const std::vector<API::IMDNode *> &batch) {
+  m_batchRows.resize(m_EventLoader.size());
+  for (size_t iw = 0; iw < m_EventLoader.size(); iw++) {
+    const std::vector<uint64_t> &eventIndex =
+        m_fileComponentsStructure[iw].getEventIndex();
+    BatchRows &rows = m_batchRows[iw];
+    rows.boxRows.assign(batch.size(), std::make_pair(size_t(0), size_t(0)));
+
+    // Find the runs of boxes stored one after another in the file
+    std::vector<std::pair<uint64_t, size_t>> runs;
+    for (size_t i = 0; i < batch.size(); i++) {
+      const size_t ID = batch[i]->getID();
+      const uint64_t fileLocation = eventIndex[2 * ID + 0];
+      const auto nEvents = static_cast<size_t>(eventIndex[2 * ID + 1]);
+      if (nEvents == 0)
+        continue;
+      if (runs.empty() ||
+          runs.back().first + runs.back().second != fileLocation)
+        runs.emplace_back(fileLocation, 0);
+      rows.boxRows[i] = std::make_pair(runs.size() - 1, runs.back().second);
+      runs.back().second += nEvents;
+    }
+
+    rows.blocks.resize(runs.size());
+    for (size_t ir = 0; ir < runs.size(); ir++) {
+      m_EventLoader[iw]->loadBlock(rows.blocks[ir], runs[ir].first,
+                                   runs[ir].second);
+      rows.nColumns = rows.blocks[ir].size() / runs[ir].second;
+    }
+  }
+}
+
+/** Put the events read for a batch into the boxes of the target workspace.
+ *
+ * The rows of every box are gathered from all files in parallel. The boxes
+ * of a file-backed target are stored one after another, so the rows of the
+ * whole batch are written with one call and the boxes are left on disk.
+ *
+ * @param batch :: boxes of the target workspace holding events
+ */
+void MergeMDFiles::addBatchToBoxes(const std::vector<API::IMDNode *> &batch) {
+  const std::vector<uint64_t> &targetEventIndexes = m_BoxStruct.getEventIndex();
+  const uint64_t batchStart = targetEventIndexes[2 * batch.front()->getID()];
+  size_t nColumns(0);
+  for (const auto &rows : m_batchRows)
+    nColumns = std::max(nColumns, rows.nColumns);
+
+  std::vector<coord_t> batchData;
+  if (m_fileBasedTargetWS) {
+    const size_t lastID = batch.back()->getID();
+    batchData.resize(static_cast<size_t>(targetEventIndexes[2 * lastID] +
+                                         targetEventIndexes[2 * lastID + 1] -
+                                         batchStart) *
+                     nColumns);
+  }
+
+  const auto nBoxes = static_cast<int64_t>(batch.size());
+  PRAGMA_OMP(parallel for schedule(dynamic) num_threads(PARALLEL_TEAM_SIZE))
+  for (int64_t i = 0; i < nBoxes; i++) {
+    PARALLEL_START_INTERUPT_REGION
+    API::IMDNode *box = batch[i];
+    const size_t ID = box->getID();
+    const uint64_t fileLocation = targetEventIndexes[2 * ID];
+    const auto nEvents = static_cast<size_t>(targetEventIndexes[2 * ID + 1]);
+
+    std::vector<coord_t> boxData;
+    coord_t *out;
+    if (m_fileBasedTargetWS) {
+      out = batchData.data() + (fileLocation - batchStart) * nColumns;
+    } else {
+      boxData.resize(nEvents * nColumns);
+      out = boxData.data();
+    }
+
+    double signal(0), errorSquared(0);
+    for (size_t iw = 0; iw < m_batchRows.size(); iw++) {
+      const BatchRows &rows = m_batchRows[iw];
+      const auto nFileEvents = static_cast<size_t>(
+          m_fileComponentsStructure[iw].getEventIndex()[2 * ID + 1]);
+      if (nFileEvents == 0)
+        continue;
+      const coord_t *in = rows.blocks[rows.boxRows[i].first].data() +
+                          rows.boxRows[i].second * nColumns;
+      const size_t nValues = nFileEvents * nColumns;
+      // The signal and squared error are the first two columns of a row
+      for (size_t j = 0; j < nValues; j += nColumns) {
+        signal += in[j];
+        errorSquared += in[j + 1];
+      }
+      out = std::copy(in, in + nValues, out);
+    }
+
+    if (!m_fileBasedTargetWS) {
+      box->setEventsData(boxData);
+    } else if (nEvents > 0) {
+      box->setSignal(static_cast<signal_t>(signal));
+      box->setErrorSquared(static_cast<signal_t>(errorSquared));
+      box->getISaveable()->setFilePosition(fileLocation, nEvents, true);
+    }
+    PARALLEL_END_INTERUPT_REGION
+  }
+  PARALLEL_CHECK_INTERUPT_REGION
+
+  if (!batchData.empty())
+    m_OutIWS->getBoxController()->getFileIO()->saveBlock(batchData,
+                                                         batchStart);
+}
+
 //----------------------------------------------------------------------------------------------
 /** Perform the merging, but clone the initial workspace and use the same
  *splitting
@@ -196,8 +352,7 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   m_OutIWS = ws;
   m_MDEventType = ws->getEventTypeName();
 
-  // Run the tasks in parallel? TODO: enable
-  // bool Parallel = this->getProperty("Parallel");
+  bool Parallel = this->getProperty("Parallel");
 
   // Fix the box controller settings in the output workspace so that it splits
   // normally
@@ -251,41 +406,33 @@ void MergeMDFiles::doExecByCloning(Mantid::API::IMDEventWorkspace_sptr ws,
   this->m_totalLoaded = 0;
   std::vector<API::IMDNode *> &boxes = m_BoxStruct.getBoxes();
 
-  for (size_t ib = 0; ib < numBoxes; ib++) {
-    auto box = boxes[ib];
-    if (!box->isBox())
-      continue;
-    // load all contributed events into current box;
-    this->loadEventsFromSubBoxes(boxes[ib]);
-
-    if (DiskBuf) {
-      if (box->getDataInMemorySize() >
-          0) { // data position has been already pre-calculated
-        box->getISaveable()->save();
-        box->clearDataFromMemory();
-        // Kernel::ISaveable *Saver = box->getISaveable();
-        // DiskBuf->toWrite(Saver);
+  if (Parallel) {
+    this->mergeBoxesInBatches();
+  } else {
+    for (size_t ib = 0; ib < numBoxes; ib++) {
+      auto box = boxes[ib];
+      if (!box->isBox())
+        continue;
+      // load all contributed events into current box;
+      this->loadEventsFromSubBoxes(boxes[ib]);
+
+      if (DiskBuf) {
+        if (box->getDataInMemorySize() >
+            0) { // data position has been already pre-calculated
+          box->getISaveable()->save();
+          box->clearDataFromMemory();
+          // Kernel::ISaveable *Saver = box->getISaveable();
+          // DiskBuf->toWrite(Saver);
+        }
       }
+      // else
+      //{   size_t ID = box->getID();
+      //    uint64_t filePosition = targetEventIndexes[2*ID];
+      //    box->saveAt(saver.get(), filePosition);
+      //}
+
+      m_progress->reportIncrement(ib, "Loading and merging box data");
     }
-    // else
-    //{   size_t ID = box->getID();
-    //    uint64_t filePosition = targetEventIndexes[2*ID];
-    //    box->saveAt(saver.get(), filePosition);
-    //}
-    //
-    // if (!Parallel)
-    //{
-    //  // Run the task serially only
-    //  task->run();
-    //  delete task;
-    //}
-    // else
-    //{
-    //  // Enqueue to run in parallel (at the joinAll() call below).
-    //  ts->push(task);
-    //}
-
-    m_progress->reportIncrement(ib, "Loading and merging box data");
   }
   if (DiskBuf) {
     DiskBuf->flushCache();
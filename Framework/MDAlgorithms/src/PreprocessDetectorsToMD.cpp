@@ -449,5 +449,12 @@ double PreprocessDetectorsToMD::getEi(
 
   return Efi;
 }
+
+/// The table has one row per spectrum held by the rank.
+Parallel::ExecutionMode PreprocessDetectorsToMD::getParallelExecutionMode(
+    const std::map<std::string, Parallel::StorageMode> &storageModes) const {
+  return Parallel::getCorrespondingExecutionMode(
+      storageModes.at("InputWorkspace"));
+}
 }
 }
@@ -9,7 +9,8 @@ namespace MDAlgorithms {
 /**
  * Default constructor required by the SingletonHolder
  */
-ForegroundModelFactoryImpl::ForegroundModelFactoryImpl() {}
+ForegroundModelFactoryImpl::ForegroundModelFactoryImpl()
+    : Kernel::DynamicFactory<ForegroundModel>("ForegroundModel") {}
 
 /**
  *  A create method to ensure the model is initialized properly
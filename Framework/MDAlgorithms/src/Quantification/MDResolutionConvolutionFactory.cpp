@@ -8,7 +8,8 @@ namespace MDAlgorithms {
  * Default constructor
  */
 MDResolutionConvolutionFactoryImpl::MDResolutionConvolutionFactoryImpl()
-    : Kernel::DynamicFactory<MDResolutionConvolution>() {}
+    : Kernel::DynamicFactory<MDResolutionConvolution>(
+          "MDResolutionConvolution") {}
 
 /**
  * A create method to ensure the type is initialized properly
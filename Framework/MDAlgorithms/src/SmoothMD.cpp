@@ -1,9 +1,8 @@
 #include "MantidMDAlgorithms/SmoothMD.h"
-#include "MantidAPI/FrameworkManager.h"
 #include "MantidAPI/IMDHistoWorkspace.h"
-#include "MantidAPI/IMDIterator.h"
 #include "MantidAPI/Progress.h"
-#include "MantidDataObjects/MDHistoWorkspaceIterator.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidGeometry/MDGeometry/IMDDimension.h"
 #include "MantidKernel/ArrayBoundedValidator.h"
 #include "MantidKernel/ArrayProperty.h"
 #include "MantidKernel/CompositeValidator.h"
@@ -11,10 +10,10 @@
 #include "MantidKernel/MandatoryValidator.h"
 #include "MantidKernel/MultiThreaded.h"
 #include "MantidKernel/PropertyWithValue.h"
+#include "MantidMDAlgorithms/MDHistoFilter.h"
 #include <boost/bind.hpp>
 #include <boost/function.hpp>
 #include <boost/make_shared.hpp>
-#include <boost/scoped_ptr.hpp>
 #include <boost/tuple/tuple.hpp>
 #include <limits>
 #include <map>
@@ -27,7 +26,6 @@
 
 using namespace Mantid::Kernel;
 using namespace Mantid::API;
-using namespace Mantid::DataObjects;
 
 // Typedef for width vector
 typedef std::vector<double> WidthVector;
@@ -174,92 +172,14 @@ IMDHistoWorkspace_sptr
 SmoothMD::hatSmooth(IMDHistoWorkspace_const_sptr toSmooth,
                     const WidthVector &widthVector,
                     OptionalIMDHistoWorkspace_const_sptr weightingWS) {
-
-  const bool useWeights = weightingWS.is_initialized();
-  uint64_t nPoints = toSmooth->getNPoints();
-  Progress progress(this, 0.0, 1.0, size_t(double(nPoints) * 1.1));
-  // Create the output workspace.
-  IMDHistoWorkspace_sptr outWS(toSmooth->clone());
-  progress.reportIncrement(
-      size_t(double(nPoints) * 0.1)); // Report ~10% progress
-
-  const int nThreads = Mantid::API::FrameworkManager::Instance()
-                           .getNumOMPThreads(); // NThreads to Request
-
-  auto iterators = toSmooth->createIterators(nThreads, nullptr);
-
-  PARALLEL_FOR_NO_WSP_CHECK()
-  for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
-
-    PARALLEL_START_INTERUPT_REGION
-    boost::scoped_ptr<MDHistoWorkspaceIterator> iterator(
-        dynamic_cast<MDHistoWorkspaceIterator *>(iterators[it]));
-
-    if (!iterator) {
-      throw std::logic_error(
-          "Failed to cast IMDIterator to MDHistoWorkspaceIterator");
-    }
-
-    do {
-      // Gets all vertex-touching neighbours
-      size_t iteratorIndex = iterator->getLinearIndex();
-
-      if (useWeights) {
-
-        // Check that we could measure here.
-        if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-          outWS->setSignalAt(iteratorIndex,
-                             std::numeric_limits<double>::quiet_NaN());
-          outWS->setErrorSquaredAt(iteratorIndex,
-                                   std::numeric_limits<double>::quiet_NaN());
-
-          continue; // Skip we couldn't measure here.
-        }
-      }
-
-      // Explicitly cast the doubles to int
-      // We've already checked in the validator that the doubles we have are odd
-      // integer values and well below max int
-      std::vector<int> widthVectorInt;
-      widthVectorInt.reserve(widthVector.size());
-      for (auto const widthEntry : widthVector) {
-        widthVectorInt.push_back(static_cast<int>(widthEntry));
-      }
-
-      std::vector<size_t> neighbourIndexes =
-          iterator->findNeighbourIndexesByWidth(widthVectorInt);
-
-      size_t nNeighbours = neighbourIndexes.size();
-      double sumSignal = iterator->getSignal();
-      double sumSqError = iterator->getError();
-      for (auto neighbourIndex : neighbourIndexes) {
-        if (useWeights) {
-          if ((*weightingWS)->getSignalAt(neighbourIndex) == 0) {
-            // Nothing measured here. We cannot use that neighbouring point.
-            nNeighbours -= 1;
-            continue;
-          }
-        }
-        sumSignal += toSmooth->getSignalAt(neighbourIndex);
-        double error = toSmooth->getErrorAt(neighbourIndex);
-        sumSqError += (error * error);
-      }
-
-      // Calculate the mean
-      outWS->setSignalAt(iteratorIndex, sumSignal / double(nNeighbours + 1));
-      // Calculate the sample variance
-      outWS->setErrorSquaredAt(iteratorIndex,
-                               sumSqError / double(nNeighbours + 1));
-
-      progress.report();
-
-    } while (iterator->next());
-    PARALLEL_END_INTERUPT_REGION
+  // We've already checked in the validator that the widths are odd integers
+  std::vector<KernelVector> hat_kernels;
+  hat_kernels.reserve(widthVector.size());
+  for (const auto width : widthVector) {
+    hat_kernels.emplace_back(static_cast<size_t>(width), 1.0);
   }
-  PARALLEL_CHECK_INTERUPT_REGION
-
-  return outWS;
+  // The error is the mean of the squared errors of the contributing pixels
+  return separableSmooth(toSmooth, hat_kernels, weightingWS, false);
 }
 
 /**
@@ -277,108 +197,105 @@ IMDHistoWorkspace_sptr
 SmoothMD::gaussianSmooth(IMDHistoWorkspace_const_sptr toSmooth,
                          const WidthVector &widthVector,
                          OptionalIMDHistoWorkspace_const_sptr weightingWS) {
-
-  const bool useWeights = weightingWS.is_initialized();
-  uint64_t nPoints = toSmooth->getNPoints();
-  Progress progress(this, 0.0, 1.0, size_t(double(nPoints) * 1.1));
-  // Create the output workspace
-  IMDHistoWorkspace_sptr outWS(toSmooth->clone().release());
-  // Create a temporary workspace
-  IMDHistoWorkspace_sptr tempWS(toSmooth->clone().release());
-  progress.reportIncrement(
-      size_t(double(nPoints) * 0.1)); // Report ~10% progress
-
-  // Create a kernel for each dimension and
+  // Create a kernel for each dimension
   std::vector<KernelVector> gaussian_kernels;
   gaussian_kernels.reserve(widthVector.size());
   for (const auto width : widthVector) {
     gaussian_kernels.push_back(gaussianKernel(width));
   }
+  // The errors are propagated through the weighted sum
+  return separableSmooth(toSmooth, gaussian_kernels, weightingWS, true);
+}
 
-  const int nThreads = Mantid::API::FrameworkManager::Instance()
-                           .getNumOMPThreads(); // NThreads to Request
-
-  auto read_ws = outWS;
-  auto write_ws = tempWS;
-  for (size_t dimension_number = 0; dimension_number < widthVector.size();
-       ++dimension_number) {
-
-    auto iterators = toSmooth->createIterators(nThreads, nullptr);
-
-    // Alternately write to each workspace
-    if (dimension_number % 2 == 0) {
-      read_ws = outWS;
-      write_ws = tempWS;
-    } else {
-      read_ws = tempWS;
-      write_ws = outWS;
-    }
-
-    PARALLEL_FOR_NO_WSP_CHECK()
-    for (int it = 0; it < int(iterators.size()); ++it) { // NOLINT
-
-      PARALLEL_START_INTERUPT_REGION
-      boost::scoped_ptr<MDHistoWorkspaceIterator> iterator(
-          dynamic_cast<MDHistoWorkspaceIterator *>(iterators[it]));
-
-      if (!iterator) {
-        throw std::logic_error(
-            "Failed to cast IMDIterator to MDHistoWorkspaceIterator");
+/**
+ * Smoothing with a kernel that is the product of a 1D kernel in each
+ * dimension. The kernel is renormalised at each pixel to the pixels that are
+ * inside the workspace, are not masked and, if a weighting workspace is
+ * given, could be measured. This is done by convolving the data and the
+ * weights separably along each dimension and dividing the results. Masked
+ * pixels keep their values and stay masked.
+ * @param toSmooth : Workspace to smooth
+ * @param kernels : Kernel for each dimension, centred on the middle element
+ * @param weightingWS : Weighting workspace (optional). Pixels where its
+ * signal is zero are ignored and set to NaN in the output.
+ * @param propagateErrors : If true, the squared error is the sum of the
+ * squared errors weighted by the squared normalised kernel. Otherwise it is
+ * the sum weighted by the normalised kernel.
+ * @return Smoothed MDHistoWorkspace
+ */
+IMDHistoWorkspace_sptr SmoothMD::separableSmooth(
+    IMDHistoWorkspace_const_sptr toSmooth,
+    const std::vector<KernelVector> &kernels,
+    OptionalIMDHistoWorkspace_const_sptr weightingWS,
+    const bool propagateErrors) {
+
+  std::vector<size_t> shape;
+  for (size_t dim = 0; dim < toSmooth->getNumDims(); ++dim) {
+    shape.push_back(toSmooth->getDimension(dim)->getNBins());
+  }
+  const MDHistoFilter filter(shape);
+  const auto nPoints = static_cast<int64_t>(filter.size());
+  Progress progress(this, 0.0, 1.0, 3 * kernels.size() + 2);
+
+  const signal_t *signal = toSmooth->getSignalArray();
+  const signal_t *errorSquared = toSmooth->getErrorSquaredArray();
+  const signal_t *measured =
+      weightingWS ? (*weightingWS)->getSignalArray() : nullptr;
+  const auto histoWS =
+      boost::dynamic_pointer_cast<const DataObjects::MDHistoWorkspace>(
+          toSmooth);
+  const bool *masked = histoWS ? histoWS->getMaskArray() : nullptr;
+
+  // Unmeasured and masked pixels get zero weight
+  std::vector<double> weight(filter.size());
+  std::vector<double> weightedSignal(filter.size());
+  std::vector<double> weightedErrorSquared(filter.size());
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nPoints; ++i) {
+    const bool use = (!measured || measured[i] != 0) && !(masked && masked[i]);
+    weight[i] = use ? 1.0 : 0.0;
+    weightedSignal[i] = use ? signal[i] : 0.0;
+    weightedErrorSquared[i] = use ? errorSquared[i] : 0.0;
+  }
+  progress.report();
+
+  for (size_t dim = 0; dim < kernels.size(); ++dim) {
+    filter.convolve(weightedSignal, dim, kernels[dim]);
+    progress.report();
+    KernelVector errorKernel = kernels[dim];
+    if (propagateErrors) {
+      for (auto &pixel : errorKernel) {
+        pixel *= pixel;
       }
+    }
+    filter.convolve(weightedErrorSquared, dim, errorKernel);
+    progress.report();
+    filter.convolve(weight, dim, kernels[dim]);
+    progress.report();
+  }
 
-      do {
-
-        // Gets linear index at current position
-        size_t iteratorIndex = iterator->getLinearIndex();
-
-        if (useWeights) {
-
-          // Check that we could measure here.
-          if ((*weightingWS)->getSignalAt(iteratorIndex) == 0) {
-
-            write_ws->setSignalAt(iteratorIndex,
-                                  std::numeric_limits<double>::quiet_NaN());
-            write_ws->setErrorSquaredAt(
-                iteratorIndex, std::numeric_limits<double>::quiet_NaN());
-
-            continue; // Skip we couldn't measure here.
-          }
-        }
-
-        std::pair<std::vector<size_t>, std::vector<bool>> indexesAndValidity =
-            iterator->findNeighbourIndexesByWidth1D(
-                static_cast<int>(gaussian_kernels[dimension_number].size()),
-                static_cast<int>(dimension_number));
-        std::vector<size_t> neighbourIndexes = std::get<0>(indexesAndValidity);
-        std::vector<bool> indexValidity = std::get<1>(indexesAndValidity);
-        auto normalised_kernel = renormaliseKernel(
-            gaussian_kernels[dimension_number], indexValidity);
-
-        // Convolve signal with kernel
-        double sumSignal = 0;
-        double sumSquareError = 0;
-        double error = 0;
-        for (size_t i = 0; i < neighbourIndexes.size(); ++i) {
-          if (indexValidity[i]) {
-            sumSignal += read_ws->getSignalAt(neighbourIndexes[i]) *
-                         normalised_kernel[i];
-            error =
-                read_ws->getErrorAt(neighbourIndexes[i]) * normalised_kernel[i];
-            sumSquareError += error * error;
-          }
-
-          write_ws->setSignalAt(iteratorIndex, sumSignal);
-          write_ws->setErrorSquaredAt(iteratorIndex, sumSquareError);
-        }
-        progress.report();
-
-      } while (iterator->next());
-      PARALLEL_END_INTERUPT_REGION
+  IMDHistoWorkspace_sptr outWS(toSmooth->clone());
+  signal_t *outSignal = outWS->getSignalArray();
+  signal_t *outErrorSquared = outWS->getErrorSquaredArray();
+  PARALLEL_FOR_NO_WSP_CHECK()
+  for (int64_t i = 0; i < nPoints; ++i) {
+    if (measured && measured[i] == 0) {
+      // Skip we couldn't measure here.
+      outSignal[i] = std::numeric_limits<double>::quiet_NaN();
+      outErrorSquared[i] = std::numeric_limits<double>::quiet_NaN();
+    } else if (masked && masked[i]) {
+      // Masked pixels are copied unchanged by clone()
+      continue;
+    } else {
+      const double norm = weight[i];
+      outSignal[i] = weightedSignal[i] / norm;
+      outErrorSquared[i] =
+          weightedErrorSquared[i] / (propagateErrors ? norm * norm : norm);
     }
-    PARALLEL_CHECK_INTERUPT_REGION
   }
+  progress.report();
 
-  return write_ws;
+  return outWS;
 }
 
 //----------------------------------------------------------------------------------------------
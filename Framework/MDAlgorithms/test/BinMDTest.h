@@ -19,6 +19,8 @@
 #include "MantidMDAlgorithms/LoadMD.h"
 #include "MantidMDAlgorithms/SaveMD2.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 
 #include <cmath>
 
@@ -33,6 +35,29 @@ using namespace Mantid::Kernel;
 using namespace Mantid::MDAlgorithms;
 using Mantid::coord_t;
 
+namespace {
+void run_distributed_binning(const Mantid::Parallel::Communicator &comm) {
+  // Every rank holds one event per box, i.e., 8 events per output bin
+  auto ws = MDEventsTestHelper::makeMDEW<3>(10, 0.0, 10.0, 1);
+  ws->setStorageMode(Mantid::Parallel::StorageMode::Distributed);
+  auto alg = ParallelTestHelpers::create<BinMD>(comm);
+  alg->setProperty("InputWorkspace", ws);
+  alg->setPropertyValue("AlignedDim0", "Axis0,0.0,10.0,5");
+  alg->setPropertyValue("AlignedDim1", "Axis1,0.0,10.0,5");
+  alg->setPropertyValue("AlignedDim2", "Axis2,0.0,10.0,5");
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  IMDHistoWorkspace_sptr histo = alg->getProperty("OutputWorkspace");
+  auto out = boost::dynamic_pointer_cast<MDHistoWorkspace>(histo);
+  TS_ASSERT_EQUALS(out->getNPoints(), 125);
+  const double expected = 8.0 * comm.size();
+  for (size_t i = 0; i < out->getNPoints(); ++i) {
+    TS_ASSERT_DELTA(out->getSignalAt(i), expected, 1e-10);
+    TS_ASSERT_DELTA(out->getErrorAt(i), std::sqrt(expected), 1e-10);
+    TS_ASSERT_DELTA(out->getNumEventsAt(i), expected, 1e-10);
+  }
+}
+}
+
 class BinMDTest : public CxxTest::TestSuite {
   GCC_DIAG_OFF_SUGGEST_OVERRIDE
 private:
@@ -292,6 +317,10 @@ public:
                  true /*IterateEvents*/, 20 /*numEventsPerBox*/, VMD(0, 0, 1));
   }
 
+  void test_parallel() {
+    ParallelTestHelpers::runParallel(run_distributed_binning);
+  }
+
   bool etta(int x, int base) {
     int ii = x - base / 2;
     if (ii < 0)
@@ -1,13 +1,22 @@
 #ifndef MANTID_MD_CONVERT2_Q_NDANY_TEST_H_
 #define MANTID_MD_CONVERT2_Q_NDANY_TEST_H_
 
+#include "MantidAPI/Axis.h"
 #include "MantidAPI/BoxController.h"
+#include "MantidDataObjects/MDHistoWorkspace.h"
+#include "MantidDataObjects/Workspace2D.h"
+#include "MantidDataObjects/WorkspaceCreation.h"
 #include "MantidGeometry/Instrument/Goniometer.h"
+#include "MantidIndexing/IndexInfo.h"
+#include "MantidKernel/UnitFactory.h"
+#include "MantidMDAlgorithms/BinMD.h"
 #include "MantidMDAlgorithms/ConvertToMD.h"
 #include "MantidMDAlgorithms/ConvToMDSelector.h"
 #include "MantidMDAlgorithms/PreprocessDetectorsToMD.h"
 #include "MantidTestHelpers/ComponentCreationHelper.h"
 #include "MantidTestHelpers/MDEventsTestHelper.h"
+#include "MantidTestHelpers/ParallelAlgorithmCreation.h"
+#include "MantidTestHelpers/ParallelRunner.h"
 #include "MantidTestHelpers/WorkspaceCreationHelper.h"
 
 #include "MantidAPI/AlgorithmManager.h"
@@ -47,6 +56,88 @@ Mantid::API::MatrixWorkspace_sptr createTestWorkspaces() {
 
   return ws;
 }
+
+MatrixWorkspace_sptr
+createDistributedInput(const Parallel::Communicator &comm,
+                       const Parallel::StorageMode storageMode) {
+  // Two banks with 9 detectors each
+  auto instrument = ComponentCreationHelper::createTestInstrumentCylindrical(2);
+  Indexing::IndexInfo indexInfo(18, storageMode, comm);
+  MatrixWorkspace_sptr ws = create<Workspace2D>(
+      instrument, indexInfo,
+      HistogramData::Histogram(HistogramData::BinEdges{1000.0, 2000.0, 3000.0,
+                                                       4000.0},
+                               HistogramData::Counts{1.0, 2.0, 3.0}));
+  ws->getAxis(0)->unit() = UnitFactory::Instance().create("TOF");
+  // Give every spectrum its own counts and X range, so each rank sees
+  // different extents
+  for (size_t i = 0; i < ws->getNumberHistograms(); ++i) {
+    const auto spectrumNumber =
+        static_cast<int>(ws->indexInfo().spectrumNumber(i));
+    const double x = 1000.0 + 100.0 * spectrumNumber;
+    ws->setBinEdges(i, HistogramData::BinEdges{x, x + 1000.0, x + 2000.0,
+                                               x + 3000.0});
+    ws->mutableY(i) *= static_cast<double>(spectrumNumber);
+  }
+  return ws;
+}
+
+IMDEventWorkspace_sptr runConvertToMD(const Parallel::Communicator &comm,
+                                      const MatrixWorkspace_sptr &input) {
+  auto alg = ParallelTestHelpers::create<ConvertToMD>(comm);
+  alg->setProperty("InputWorkspace", input);
+  alg->setPropertyValue("QDimensions", "|Q|");
+  alg->setPropertyValue("dEAnalysisMode", "Elastic");
+  alg->setPropertyValue("PreprocDetectorsWS", "");
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  return alg->getProperty("OutputWorkspace");
+}
+
+MDHistoWorkspace_sptr runBinMD(const Parallel::Communicator &comm,
+                               const IMDEventWorkspace_sptr &input) {
+  const auto dimension = input->getDimension(0);
+  auto alg = ParallelTestHelpers::create<BinMD>(comm);
+  alg->setProperty("InputWorkspace", input);
+  alg->setPropertyValue("AlignedDim0",
+                        dimension->getName() + "," +
+                            std::to_string(dimension->getMinimum()) + "," +
+                            std::to_string(dimension->getMaximum()) + ",20");
+  TS_ASSERT_THROWS_NOTHING(alg->execute());
+  IMDHistoWorkspace_sptr histo = alg->getProperty("OutputWorkspace");
+  return boost::dynamic_pointer_cast<MDHistoWorkspace>(histo);
+}
+
+void run_distributed_conversion(const Parallel::Communicator &comm) {
+  const auto reference = runConvertToMD(
+      Parallel::Communicator(),
+      createDistributedInput(Parallel::Communicator(),
+                             Parallel::StorageMode::Cloned));
+  const auto out = runConvertToMD(
+      comm, createDistributedInput(comm, Parallel::StorageMode::Distributed));
+  TS_ASSERT_EQUALS(out->storageMode(), Parallel::StorageMode::Distributed);
+
+  // The extents are combined over all ranks
+  TS_ASSERT_EQUALS(out->getNumDims(), reference->getNumDims());
+  for (size_t d = 0; d < reference->getNumDims(); ++d) {
+    TS_ASSERT_EQUALS(out->getDimension(d)->getMinimum(),
+                     reference->getDimension(d)->getMinimum());
+    TS_ASSERT_EQUALS(out->getDimension(d)->getMaximum(),
+                     reference->getDimension(d)->getMaximum());
+  }
+
+  // Binning sums the events of all ranks
+  const auto binnedReference = runBinMD(Parallel::Communicator(), reference);
+  const auto binned = runBinMD(comm, out);
+  TS_ASSERT_EQUALS(binned->getNPoints(), binnedReference->getNPoints());
+  for (size_t i = 0; i < binnedReference->getNPoints(); ++i) {
+    TS_ASSERT_DELTA(binned->getSignalAt(i), binnedReference->getSignalAt(i),
+                    1e-8);
+    TS_ASSERT_DELTA(binned->getErrorAt(i), binnedReference->getErrorAt(i),
+                    1e-8);
+    TS_ASSERT_DELTA(binned->getNumEventsAt(i),
+                    binnedReference->getNumEventsAt(i), 1e-8);
+  }
+}
 }
 
 class Convert2AnyTestHelper : public ConvertToMD {
@@ -530,6 +621,10 @@ public:
     }
   }
 
+  void test_distributed_conversion_matches_serial() {
+    ParallelTestHelpers::runParallel(run_distributed_conversion);
+  }
+
 private:
   void checkHistogramsHaveBeenStored(const std::string &wsName,
                                      double val = 0.34, double bin_min = 0.3,
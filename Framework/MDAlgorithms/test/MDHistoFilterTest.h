@@ -0,0 +1,93 @@
+#ifndef MANTID_MDALGORITHMS_MDHISTOFILTERTEST_H_
+#define MANTID_MDALGORITHMS_MDHISTOFILTERTEST_H_
+
+#include <cxxtest/TestSuite.h>
+
+#include "MantidMDAlgorithms/MDHistoFilter.h"
+
+#include <cmath>
+#include <limits>
+
+using Mantid::MDAlgorithms::MDHistoFilter;
+
+class MDHistoFilterTest : public CxxTest::TestSuite {
+public:
+  // This pair of boilerplate methods prevent the suite being created statically
+  // This means the constructor isn't called when running other tests
+  static MDHistoFilterTest *createSuite() { return new MDHistoFilterTest(); }
+  static void destroySuite(MDHistoFilterTest *suite) { delete suite; }
+
+  void test_size() {
+    MDHistoFilter filter({3, 4, 5});
+    TS_ASSERT_EQUALS(filter.size(), 60);
+  }
+
+  void test_convolve_along_first_dimension() {
+    MDHistoFilter filter({4, 2});
+    std::vector<double> data{1, 2, 3, 4, 5, 6, 7, 8};
+    filter.convolve(data, 0, {1, 1, 1});
+    // Bins beyond the ends count as zero
+    const std::vector<double> expected{3, 6, 9, 7, 11, 18, 21, 15};
+    TS_ASSERT_EQUALS(data, expected);
+  }
+
+  void test_convolve_along_second_dimension() {
+    MDHistoFilter filter({2, 3});
+    std::vector<double> data{1, 2, 3, 4, 5, 6};
+    filter.convolve(data, 1, {0, 1, 2});
+    // out(y) = in(y) + 2 in(y + 1)
+    const std::vector<double> expected{7, 10, 13, 16, 5, 6};
+    TS_ASSERT_EQUALS(data, expected);
+  }
+
+  void test_separable_convolution_matches_full_kernel() {
+    MDHistoFilter filter({3, 3});
+    std::vector<double> data(9, 0.0);
+    data[4] = 1.0;
+    filter.convolve(data, 0, {1, 2, 1});
+    filter.convolve(data, 1, {1, 2, 1});
+    const std::vector<double> expected{1, 2, 1, 2, 4, 2, 1, 2, 1};
+    TS_ASSERT_EQUALS(data, expected);
+  }
+
+  void test_wide_kernel_via_fft_matches_direct_sum() {
+    const size_t length = 100;
+    const std::vector<double> kernel(301, 1.0);
+    TS_ASSERT(MDHistoFilter::useFFT(length, kernel.size()));
+    TS_ASSERT(!MDHistoFilter::useFFT(length, 3));
+    MDHistoFilter filter({length});
+    std::vector<double> data(length);
+    for (size_t i = 0; i < length; ++i)
+      data[i] = static_cast<double>(i % 7);
+    const double total = 14 * 21.0 + 0 + 1; // Sum over all bins
+    filter.convolve(data, 0, kernel);
+    // The kernel covers the whole line from every bin
+    for (const auto value : data)
+      TS_ASSERT_LESS_THAN(std::abs(value - total), 1e-9);
+  }
+
+  void test_nan_stays_local() {
+    const size_t length = 100;
+    MDHistoFilter filter({length});
+    std::vector<double> data(length, 1.0);
+    data[50] = std::numeric_limits<double>::quiet_NaN();
+    filter.convolve(data, 0, {1, 1, 1});
+    TS_ASSERT_EQUALS(data[48], 3.0);
+    TS_ASSERT(std::isnan(data[49]));
+    TS_ASSERT(std::isnan(data[51]));
+    TS_ASSERT_EQUALS(data[52], 3.0);
+  }
+
+  void test_invalid_arguments_throw() {
+    MDHistoFilter filter({2, 2});
+    std::vector<double> data(4, 1.0);
+    TS_ASSERT_THROWS(filter.convolve(data, 2, {1}), std::invalid_argument &);
+    TS_ASSERT_THROWS(filter.convolve(data, 0, {1, 1}),
+                     std::invalid_argument &);
+    std::vector<double> wrongSize(3, 1.0);
+    TS_ASSERT_THROWS(filter.convolve(wrongSize, 0, {1}),
+                     std::invalid_argument &);
+  }
+};
+
+#endif /* MANTID_MDALGORITHMS_MDHISTOFILTERTEST_H_ */
@@ -373,6 +373,76 @@ public:
                std::isnan(out->getSignalAt(9)));
   }
 
+  void test_smooth_ignores_masked_bins() {
+    const size_t nd = 1;
+    MDHistoWorkspace_sptr toSmooth =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0 /*signal value*/, nd,
+                                                     10);
+    toSmooth->setSignalAt(7, 30);
+    toSmooth->getMaskArray()[7] = true;
+
+    /*
+     1D MDHistoWorkspace for smoothing, bin 7 is masked
+
+     2 - 2 - 2 - 2 - 2 - 2 - 2 - 30 - 2 - 2
+     */
+
+    SmoothMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    WidthVector widthVector(1, 3); // Smooth with width == 3
+    alg.setProperty("WidthVector", widthVector);
+    alg.setProperty("InputWorkspace", toSmooth);
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+    auto outHisto = boost::dynamic_pointer_cast<MDHistoWorkspace>(out);
+
+    TSM_ASSERT_EQUALS("Neighbours of the masked bin should only use the "
+                      "unmasked bins",
+                      2.0, out->getSignalAt(6));
+    TS_ASSERT_EQUALS(2.0, out->getSignalAt(8));
+    TSM_ASSERT_EQUALS("The masked bin should be unchanged", 30.0,
+                      out->getSignalAt(7));
+    TS_ASSERT(outHisto->getIsMaskedAt(7));
+    TS_ASSERT(!outHisto->getIsMaskedAt(6));
+  }
+
+  void test_gaussian_smooth_with_normalization_guidance() {
+
+    const size_t nd = 2;
+    MDHistoWorkspace_sptr toSmooth =
+        MDEventsTestHelper::makeFakeMDHistoWorkspace(2.0 /*signal value*/, nd,
+                                                     10);
+    toSmooth->setSignalAt(9, 100.0);
+
+    MDHistoWorkspace_sptr normWs = MDEventsTestHelper::makeFakeMDHistoWorkspace(
+        1.0 /*signal value*/, nd, 10);
+    normWs->setSignalAt(9, 0);
+
+    SmoothMD alg;
+    alg.setChild(true);
+    alg.initialize();
+    WidthVector widthVector(1, 3); // FWHM of 3 pixels
+    alg.setProperty("WidthVector", widthVector);
+    alg.setProperty("InputWorkspace", toSmooth);
+    alg.setProperty("InputNormalizationWorkspace", normWs);
+    alg.setProperty("Function", "Gaussian");
+    alg.setPropertyValue("OutputWorkspace", "dummy");
+    alg.execute();
+    IMDHistoWorkspace_sptr out = alg.getProperty("OutputWorkspace");
+
+    TSM_ASSERT("Unmeasured pixel should have a smoothed value of NaN",
+               std::isnan(out->getSignalAt(9)));
+    for (size_t i = 0; i < out->getNPoints(); ++i) {
+      if (i == 9)
+        continue;
+      TSM_ASSERT_DELTA("The unmeasured pixel should be ignored by its "
+                       "neighbours",
+                       2.0, out->getSignalAt(i), 1e-10);
+    }
+  }
+
   void test_gaussian_kernel_sigma_1() {
     // FWHM of 2.355 equivalent to sigma=1
     const std::vector<double> kernel =
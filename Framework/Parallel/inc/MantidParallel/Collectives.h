@@ -5,6 +5,9 @@
 #include "MantidParallel/DllConfig.h"
 #include "MantidParallel/Nonblocking.h"
 
+#include <algorithm>
+#include <vector>
+
 #ifdef MPI_EXPERIMENTAL
 #include <boost/mpi/collectives.hpp>
 #endif
@@ -88,6 +91,26 @@ void all_to_all(const Communicator &comm, const std::vector<T> &in_values,
     comm.send(rank, tag, in_values[rank]);
   wait_all(requests.begin(), requests.end());
 }
+
+template <typename T, typename Op>
+void all_reduce(const Communicator &comm, const T *in_values, int n,
+                T *out_values, Op op) {
+  int tag{0};
+  if (comm.rank() != 0) {
+    comm.send(0, tag, in_values, n);
+    comm.recv(0, tag, out_values, n);
+    return;
+  }
+  std::copy(in_values, in_values + n, out_values);
+  std::vector<T> buffer(n);
+  for (int rank = 1; rank < comm.size(); ++rank) {
+    comm.recv(rank, tag, buffer.data(), n);
+    for (int i = 0; i < n; ++i)
+      out_values[i] = op(out_values[i], buffer[i]);
+  }
+  for (int rank = 1; rank < comm.size(); ++rank)
+    comm.send(rank, tag, out_values, n);
+}
 }
 
 template <typename... T> void gather(const Communicator &comm, T &&... args) {
@@ -116,6 +139,15 @@ void all_to_all(const Communicator &comm, T &&... args) {
   detail::all_to_all(comm, std::forward<T>(args)...);
 }
 
+template <typename... T>
+void all_reduce(const Communicator &comm, T &&... args) {
+#ifdef MPI_EXPERIMENTAL
+  if (!comm.hasBackend())
+    return boost::mpi::all_reduce(comm, std::forward<T>(args)...);
+#endif
+  detail::all_reduce(comm, std::forward<T>(args)...);
+}
+
 } // namespace Parallel
 } // namespace Mantid
 
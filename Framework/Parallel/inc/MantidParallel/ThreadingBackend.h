@@ -9,14 +9,18 @@
 #include <boost/archive/binary_oarchive.hpp>
 #include <boost/archive/binary_iarchive.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstring>
 #include <functional>
 #include <istream>
 #include <map>
 #include <mutex>
 #include <ostream>
 #include <sstream>
+#include <stdexcept>
 #include <tuple>
+#include <type_traits>
 #include <vector>
 
 namespace Mantid {
@@ -27,6 +31,11 @@ namespace detail {
   in the case of non-MPI builds when communication between threads is used to
   mimic MPI calls. This is FOR UNIT TESTING ONLY and is NOT FOR PRODUCTION CODE.
 
+  Since all ranks share an address space, single values, std::vector and
+  arrays of trivial types are passed as raw bytes, i.e., copied with a single
+  memcpy (or moved in the case of std::vector<char>). Other types are
+  serialized using boost::archive.
+
   @author Simon Heybrock
   @date 2017
 
@@ -75,13 +84,80 @@ public:
   Request irecv(int dest, int source, int tag, T *data, const size_t count);
 
 private:
+  /// A message in transit, holding either raw bytes or serialized data.
+  struct Message {
+    bool raw{false};
+    std::vector<char> bytes;
+    // Must wrap std::stringbuf in a unique_ptr since gcc on RHEL7 does not
+    // support moving a stringbuf (incomplete C++11 support?).
+    std::unique_ptr<std::stringbuf> buf;
+  };
+
+  template <typename... T>
+  static void pack(Message &message, std::true_type, T &&... args);
+  template <typename... T>
+  static void pack(Message &message, std::false_type, T &&... args);
+  template <typename... T>
+  static size_t unpack(Message &message, std::true_type, T &&... args);
+  template <typename... T>
+  static size_t unpack(Message &message, std::false_type, T &&... args);
+
   int m_size{1};
-  std::map<std::tuple<int, int, int>,
-           std::vector<std::unique_ptr<std::stringbuf>>> m_buffer;
+  std::map<std::tuple<int, int, int>, std::vector<Message>> m_buffer;
   std::mutex m_mutex;
 };
 
 namespace detail {
+/// True if the arguments of send/recv can be transferred as raw bytes.
+template <class... T> struct IsRaw : std::false_type {};
+template <class T> struct IsRaw<T> : std::is_trivial<T> {};
+template <class T> struct IsRaw<std::vector<T>> : std::is_trivial<T> {};
+template <class T, class Count>
+struct IsRaw<T *, Count> : std::is_trivial<T> {};
+
+template <class... T>
+using IsRawArgs = IsRaw<typename std::decay<T>::type...>;
+
+template <class T> std::vector<char> toBytes(const T &data) {
+  std::vector<char> bytes(sizeof(T));
+  std::memcpy(bytes.data(), &data, sizeof(T));
+  return bytes;
+}
+template <class T>
+std::vector<char> toBytes(const T *data, const size_t count) {
+  std::vector<char> bytes(count * sizeof(T));
+  if (count > 0)
+    std::memcpy(bytes.data(), data, bytes.size());
+  return bytes;
+}
+template <class T> std::vector<char> toBytes(const std::vector<T> &data) {
+  return toBytes(data.data(), data.size());
+}
+inline std::vector<char> toBytes(std::vector<char> &&data) {
+  return std::move(data);
+}
+template <class T> size_t fromBytes(std::vector<char> &bytes, T &data) {
+  const size_t size = std::min(bytes.size(), sizeof(T));
+  std::memcpy(&data, bytes.data(), size);
+  return size;
+}
+template <class T>
+size_t fromBytes(std::vector<char> &bytes, T *data, const size_t count) {
+  const size_t size = std::min(bytes.size() / sizeof(T), count) * sizeof(T);
+  if (size > 0)
+    std::memcpy(data, bytes.data(), size);
+  return size;
+}
+template <class T>
+size_t fromBytes(std::vector<char> &bytes, std::vector<T> &data) {
+  data.resize(bytes.size() / sizeof(T));
+  return fromBytes(bytes, data.data(), data.size());
+}
+inline size_t fromBytes(std::vector<char> &bytes, std::vector<char> &data) {
+  data = std::move(bytes);
+  return data.size();
+}
+
 template <class T>
 void saveToStream(boost::archive::binary_oarchive &oa, const T &data) {
   oa.operator<<(data);
@@ -124,11 +200,15 @@ size_t loadFromStream(boost::archive::binary_iarchive &ia, T *data,
 }
 
 template <typename... T>
-void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
-  // Must wrap std::stringbuf in a unique_ptr since gcc on RHEL7 does not
-  // support moving a stringbuf (incomplete C++11 support?).
-  auto buf = Kernel::make_unique<std::stringbuf>();
-  std::ostream os(buf.get());
+void ThreadingBackend::pack(Message &message, std::true_type, T &&... args) {
+  message.raw = true;
+  message.bytes = detail::toBytes(std::forward<T>(args)...);
+}
+
+template <typename... T>
+void ThreadingBackend::pack(Message &message, std::false_type, T &&... args) {
+  message.buf = Kernel::make_unique<std::stringbuf>();
+  std::ostream os(message.buf.get());
   {
     // The binary_oarchive must be scoped to prevent a segmentation fault. I
     // believe the reason is that otherwise recv() may end up reading from the
@@ -138,14 +218,34 @@ void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
     boost::archive::binary_oarchive oa(os);
     detail::saveToStream(oa, std::forward<T>(args)...);
   }
+}
+
+template <typename... T>
+size_t ThreadingBackend::unpack(Message &message, std::true_type,
+                                T &&... args) {
+  return detail::fromBytes(message.bytes, std::forward<T>(args)...);
+}
+
+template <typename... T>
+size_t ThreadingBackend::unpack(Message &message, std::false_type,
+                                T &&... args) {
+  std::istream is(message.buf.get());
+  boost::archive::binary_iarchive ia(is);
+  return detail::loadFromStream(ia, std::forward<T>(args)...);
+}
+
+template <typename... T>
+void ThreadingBackend::send(int source, int dest, int tag, T &&... args) {
+  Message message;
+  pack(message, detail::IsRawArgs<T...>{}, std::forward<T>(args)...);
   std::lock_guard<std::mutex> lock(m_mutex);
-  m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(buf));
+  m_buffer[std::make_tuple(source, dest, tag)].push_back(std::move(message));
 }
 
 template <typename... T>
 Status ThreadingBackend::recv(int dest, int source, int tag, T &&... args) {
   const auto key = std::make_tuple(source, dest, tag);
-  std::unique_ptr<std::stringbuf> buf;
+  Message message;
   while (true) {
     // Sleep to reduce lock contention. Without this execution times can grow
     // enormously on Windows.
@@ -157,13 +257,15 @@ Status ThreadingBackend::recv(int dest, int source, int tag, T &&... args) {
     auto &queue = it->second;
     if (queue.empty())
       continue;
-    buf = std::move(queue.front());
+    message = std::move(queue.front());
     queue.erase(queue.begin());
     break;
   }
-  std::istream is(buf.get());
-  boost::archive::binary_iarchive ia(is);
-  return Status(detail::loadFromStream(ia, std::forward<T>(args)...));
+  if (message.raw != detail::IsRawArgs<T...>::value)
+    throw std::runtime_error(
+        "ThreadingBackend: received type does not match the type sent");
+  return Status(
+      unpack(message, detail::IsRawArgs<T...>{}, std::forward<T>(args)...));
 }
 
 template <typename... T>
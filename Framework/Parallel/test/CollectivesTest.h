@@ -6,6 +6,8 @@
 #include "MantidParallel/Collectives.h"
 #include "MantidTestHelpers/ParallelRunner.h"
 
+#include <functional>
+
 using namespace Mantid;
 using namespace Parallel;
 
@@ -61,6 +63,18 @@ void run_all_to_all(const Communicator &comm) {
     TS_ASSERT_EQUALS(result[i], 1000 * i + comm.rank());
   }
 }
+
+void run_all_reduce(const Communicator &comm) {
+  std::vector<double> data{1.0 * comm.rank(), 2.0, 0.5};
+  std::vector<double> result(data.size());
+  TS_ASSERT_THROWS_NOTHING(Parallel::all_reduce(
+      comm, data.data(), static_cast<int>(data.size()), result.data(),
+      std::plus<double>()));
+  const double size = comm.size();
+  TS_ASSERT_EQUALS(result[0], size * (size - 1.0) / 2.0);
+  TS_ASSERT_EQUALS(result[1], 2.0 * size);
+  TS_ASSERT_EQUALS(result[2], 0.5 * size);
+}
 }
 
 class CollectivesTest : public CxxTest::TestSuite {
@@ -79,6 +93,8 @@ public:
   void test_all_gather() { ParallelTestHelpers::runParallel(run_all_gather); }
 
   void test_all_to_all() { ParallelTestHelpers::runParallel(run_all_to_all); }
+
+  void test_all_reduce() { ParallelTestHelpers::runParallel(run_all_reduce); }
 };
 
 #endif /* MANTID_PARALLEL_COLLECTIVESTEST_H_ */
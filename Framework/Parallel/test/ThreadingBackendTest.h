@@ -5,6 +5,9 @@
 
 #include "MantidParallel/ThreadingBackend.h"
 
+#include <string>
+#include <vector>
+
 using Mantid::Parallel::detail::ThreadingBackend;
 
 class ThreadingBackendTest : public CxxTest::TestSuite {
@@ -25,6 +28,72 @@ public:
     ThreadingBackend backend{2};
     TS_ASSERT_EQUALS(backend.size(), 2);
   }
+
+  void test_send_recv_value() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 7, 42.5);
+    double data{0.0};
+    const auto status = backend.recv(1, 0, 7, data);
+    TS_ASSERT_EQUALS(data, 42.5);
+    TS_ASSERT_EQUALS(*status.count<double>(), 1);
+  }
+
+  void test_send_recv_vector() {
+    ThreadingBackend backend{2};
+    const std::vector<int64_t> sent{1, 2, 3, 4};
+    backend.send(0, 1, 0, sent);
+    std::vector<int64_t> received;
+    const auto status = backend.recv(1, 0, 0, received);
+    TS_ASSERT_EQUALS(received, sent);
+    TS_ASSERT_EQUALS(*status.count<int64_t>(), 4);
+  }
+
+  void test_send_vector_recv_array() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, std::vector<double>{1.0, 2.0, 3.0});
+    std::vector<double> received(5, 0.0);
+    const auto status = backend.recv(1, 0, 0, received.data(), size_t{5});
+    TS_ASSERT_EQUALS(received, std::vector<double>({1.0, 2.0, 3.0, 0.0, 0.0}));
+    TS_ASSERT_EQUALS(*status.count<double>(), 3);
+  }
+
+  void test_send_recv_moves_char_buffer() {
+    ThreadingBackend backend{2};
+    std::vector<char> sent(1000, 'x');
+    const char *address = sent.data();
+    backend.send(0, 1, 0, std::move(sent));
+    std::vector<char> received;
+    backend.recv(1, 0, 0, received);
+    TS_ASSERT_EQUALS(received.size(), 1000);
+    TS_ASSERT_EQUALS(received.data(), address);
+  }
+
+  void test_send_recv_serialized_type() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, std::string("abc"));
+    std::string received;
+    backend.recv(1, 0, 0, received);
+    TS_ASSERT_EQUALS(received, "abc");
+  }
+
+  void test_messages_are_received_in_order() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 1);
+    backend.send(0, 1, 0, 2);
+    int first{0};
+    int second{0};
+    backend.recv(1, 0, 0, first);
+    backend.recv(1, 0, 0, second);
+    TS_ASSERT_EQUALS(first, 1);
+    TS_ASSERT_EQUALS(second, 2);
+  }
+
+  void test_type_mismatch_throws() {
+    ThreadingBackend backend{2};
+    backend.send(0, 1, 0, 1);
+    std::string received;
+    TS_ASSERT_THROWS(backend.recv(1, 0, 0, received), std::runtime_error);
+  }
 };
 
 #endif /* MANTID_PARALLEL_THREADINGBACKENDTEST_H_ */
@@ -0,0 +1,126 @@
+/*
+  PluginManifest : Writes the manifest of a framework plugin library, listing
+  the algorithms and file loaders it registers when opened, every class it
+  registers with another factory, such as fit functions, live listeners or
+  script repositories, and the aliases and workspace methods of its
+  algorithms so that mantid.simpleapi can wrap them without opening it.
+
+  Usage: PluginManifest <library> <manifest>
+
+  The manifest allows LibraryManager to defer opening the library until one
+  of these is first requested. It is written by the ADD_PLUGIN_MANIFEST CMake
+  function after the library is built.
+*/
+#include "MantidAPI/AlgorithmFactory.h"
+#include "MantidAPI/IFileLoader.h"
+#include "MantidKernel/FileDescriptor.h"
+#include "MantidKernel/LibraryManager.h"
+#include "MantidKernel/LibraryWrapper.h"
+#include "MantidKernel/NexusDescriptor.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <set>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using namespace Mantid::API;
+using Mantid::Kernel::FileDescriptor;
+using Mantid::Kernel::LibraryManagerImpl;
+using Mantid::Kernel::LibraryWrapper;
+using Mantid::Kernel::NexusDescriptor;
+
+namespace {
+/// Returns the keys in after that are not in before
+std::vector<std::string> added(std::vector<std::string> before,
+                               std::vector<std::string> after) {
+  std::sort(before.begin(), before.end());
+  std::sort(after.begin(), after.end());
+  std::vector<std::string> keys;
+  std::set_difference(after.begin(), after.end(), before.begin(), before.end(),
+                      std::back_inserter(keys));
+  return keys;
+}
+
+/// Returns true if the algorithm can be used by Load
+bool isLoader(const std::string &name, const int version) {
+  const auto alg = AlgorithmFactory::Instance().create(name, version);
+  return boost::dynamic_pointer_cast<IFileLoader<FileDescriptor>>(alg) ||
+         boost::dynamic_pointer_cast<IFileLoader<NexusDescriptor>>(alg);
+}
+
+/// Adds the aliases and workspace method of an algorithm to the lines
+void addAttachments(const std::string &name, const int version,
+                    std::set<std::string> &lines) {
+  const auto alg = AlgorithmFactory::Instance().create(name, version);
+  alg->initialize();
+  std::istringstream aliases(alg->alias());
+  std::string alias;
+  while (aliases >> alias)
+    lines.insert("AlgorithmAlias " + alias + "=" + name);
+  const auto method = alg->workspaceMethodName();
+  if (method.empty())
+    return;
+  std::string line = "WorkspaceMethod " + method + "=" + name + "," +
+                     alg->workspaceMethodInputProperty();
+  for (const auto &type : alg->workspaceMethodOn())
+    line += "," + type;
+  lines.insert(line);
+}
+} // namespace
+
+int main(int argc, char *argv[]) {
+  if (argc != 3) {
+    std::cerr << "Usage: " << argv[0] << " <library> <manifest>\n";
+    return 1;
+  }
+  auto &algorithms = AlgorithmFactory::Instance();
+  const auto algorithmsBefore = algorithms.getKeys(true);
+
+  // Every class registered with a factory while the library, and any library
+  // it depends on that is not open yet, is opened is listed under the kind of
+  // the factory. Algorithms are listed by name below, rather than by their
+  // versioned keys.
+  std::set<std::string> lines;
+  LibraryManagerImpl::setRegistrationObserver(
+      [&lines](const std::string &kind, const std::string &name) {
+        if (kind != "Algorithm")
+          lines.insert(kind + " " + name);
+      });
+  // The factories keep instantiators from the library until exit, so it must
+  // never be closed
+  auto library = new LibraryWrapper;
+  const bool opened = library->openLibrary(argv[1]);
+  LibraryManagerImpl::setRegistrationObserver(nullptr);
+  if (!opened) {
+    std::cerr << "Cannot open " << argv[1] << "\n";
+    return 1;
+  }
+
+  std::map<std::string, int> highestVersions;
+  for (const auto &key : added(algorithmsBefore, algorithms.getKeys(true))) {
+    const auto nameVersion = algorithms.decodeName(key);
+    lines.insert("Algorithm " + nameVersion.first);
+    if (isLoader(nameVersion.first, nameVersion.second))
+      lines.insert("Loader " + nameVersion.first);
+    auto &highest = highestVersions[nameVersion.first];
+    highest = std::max(highest, nameVersion.second);
+  }
+  // mantid.simpleapi wraps the highest version of each algorithm
+  for (const auto &nameVersion : highestVersions)
+    addAttachments(nameVersion.first, nameVersion.second, lines);
+
+  std::ofstream manifest(argv[2]);
+  manifest << "# Generated from " << argv[1] << " by PluginManifest\n";
+  for (const auto &line : lines)
+    manifest << line << "\n";
+  if (!manifest) {
+    std::cerr << "Cannot write " << argv[2] << "\n";
+    return 1;
+  }
+  return 0;
+}
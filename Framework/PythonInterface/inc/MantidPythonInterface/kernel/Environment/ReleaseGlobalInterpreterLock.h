@@ -0,0 +1,57 @@
+#ifndef MANTID_PYTHONINTERFACE_RELEASEGLOBALINTERPRETERLOCK_H_
+#define MANTID_PYTHONINTERFACE_RELEASEGLOBALINTERPRETERLOCK_H_
+/**
+    Defines an RAII class for releasing the Python GIL while C++ code runs
+    on a Python created thread
+
+    Copyright &copy; 2018 ISIS Rutherford Appleton Laboratory, NScD Oak Ridge
+   National Laboratory & European Spallation Source
+
+    This file is part of Mantid.
+
+    Mantid is free software; you can redistribute it and/or modify
+    it under the terms of the GNU General Public License as published by
+    the Free Software Foundation; either version 3 of the License, or
+    (at your option) any later version.
+
+    Mantid is distributed in the hope that it will be useful,
+    but WITHOUT ANY WARRANTY; without even the implied warranty of
+    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+    GNU General Public License for more details.
+
+    You should have received a copy of the GNU General Public License
+    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+
+    File change history is stored at: <https://github.com/mantidproject/mantid>
+    Code Documentation is available at: <http://doxygen.mantidproject.org>
+*/
+#include "MantidPythonInterface/kernel/DllConfig.h"
+#include <boost/python/detail/wrap_python.hpp>
+
+namespace Mantid {
+namespace PythonInterface {
+namespace Environment {
+
+/**
+ * Defines a structure for releasing the Python GIL using the RAII pattern.
+ * It is the exception-safe equivalent of the Py_BEGIN_ALLOW_THREADS and
+ * Py_END_ALLOW_THREADS pair: the GIL is re-acquired however the scope is
+ * left. No Python objects may be touched while it is alive.
+ */
+class PYTHON_KERNEL_DLL ReleaseGlobalInterpreterLock {
+public:
+  /// Default constructor
+  ReleaseGlobalInterpreterLock();
+  /// Destructor
+  ~ReleaseGlobalInterpreterLock();
+
+private:
+  ReleaseGlobalInterpreterLock(const ReleaseGlobalInterpreterLock &);
+  /// Python threadstate saved when the GIL was released
+  PyThreadState *m_saved;
+};
+}
+}
+}
+
+#endif /* MANTID_PYTHONINTERFACE_RELEASEGLOBALINTERPRETERLOCK_H_ */
@@ -3,6 +3,8 @@
 //-----------------------------------------------------------------------------
 #include "MantidPythonInterface/api/CloneMatrixWorkspace.h"
 #include "MantidAPI/MatrixWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidPythonInterface/kernel/Environment/ReleaseGlobalInterpreterLock.h"
 
 #include <boost/python/extract.hpp>
 
@@ -16,6 +18,7 @@ namespace Mantid {
 namespace PythonInterface {
 using Mantid::API::MatrixWorkspace_sptr;
 using Mantid::API::MatrixWorkspace;
+using Environment::ReleaseGlobalInterpreterLock;
 namespace bpl = boost::python;
 
 // ----------------------------------------------------------------------------------------------------------
@@ -37,26 +40,21 @@ PyArrayObject *cloneArray(MatrixWorkspace &workspace, DataField field,
   const size_t numHist = endp1 - start;
   npy_intp stride(0);
 
-  // Find out which function we need to call to access the data
-  typedef const MantidVec &(MatrixWorkspace::*ArrayAccessFn)(const size_t)
-      const;
+  // Find out which data of a histogram we need
+  typedef const MantidVec &(HistogramData::Histogram::*ArrayAccessFn)() const;
   ArrayAccessFn dataAccesor;
-  /**
-   * Can do better than this with a templated object that knows how to access
-   * the data
-   */
   if (field == XValues) {
     stride = workspace.readX(0).size();
-    dataAccesor = &MatrixWorkspace::readX;
+    dataAccesor = &HistogramData::Histogram::readX;
   } else if (field == DxValues) {
     stride = workspace.readDx(0).size();
-    dataAccesor = &MatrixWorkspace::readDx;
+    dataAccesor = &HistogramData::Histogram::readDx;
   } else {
     stride = workspace.blocksize();
     if (field == YValues)
-      dataAccesor = &MatrixWorkspace::readY;
+      dataAccesor = &HistogramData::Histogram::readY;
     else
-      dataAccesor = &MatrixWorkspace::readE;
+      dataAccesor = &HistogramData::Histogram::readE;
   }
   npy_intp arrayDims[2] = {static_cast<npy_intp>(numHist), stride};
   PyArrayObject *nparray = reinterpret_cast<PyArrayObject *>(
@@ -66,12 +64,23 @@ PyArrayObject *cloneArray(MatrixWorkspace &workspace, DataField field,
                            nullptr, nullptr, 0, nullptr));
   double *dest = reinterpret_cast<double *>(
       PyArray_DATA(nparray)); // HEAD of the contiguous numpy data array
-  for (size_t i = start; i < endp1; ++i) {
-    const MantidVec &src = (workspace.*(dataAccesor))(i);
-    std::copy(src.begin(), src.end(), dest);
-    dest += stride; // Move the ptr to the start of the next 1D array
+
+  // Owns the array until it is returned, so an exception does not leak it
+  bpl::handle<> owner(reinterpret_cast<PyObject *>(nparray));
+
+  // Copy the rows in parallel. Each thread takes its own copy of the
+  // histogram, which shares the data of the workspace, so that the data
+  // stays valid even if the workspace generates it on demand.
+  {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    PARALLEL_FOR_IF(Kernel::threadSafe(workspace))
+    for (int64_t i = 0; i < static_cast<int64_t>(numHist); ++i) {
+      const auto histogram = workspace.histogram(start + i);
+      const MantidVec &src = (histogram.*(dataAccesor))();
+      std::copy(src.begin(), src.end(), dest + i * stride);
+    }
   }
-  return nparray;
+  return reinterpret_cast<PyArrayObject *>(owner.release());
 }
 }
 
@@ -35,9 +35,14 @@ namespace {
  * @param self :: Enables it to be called as a member function on the
  * AlgorithmFactory class
  * @param includeHidden :: If true hidden algorithms are included
+ * @param openDeferred :: If false, plugin libraries whose loading was deferred
+ * are not opened and their algorithms are not included
  */
-dict getRegisteredAlgorithms(AlgorithmFactoryImpl &self, bool includeHidden) {
-  std::vector<std::string> keys = self.getKeys(includeHidden);
+dict getRegisteredAlgorithms(AlgorithmFactoryImpl &self, bool includeHidden,
+                             bool openDeferred) {
+  std::vector<std::string> keys = openDeferred
+                                      ? self.getKeys(includeHidden)
+                                      : self.getOpenedKeys(includeHidden);
   const size_t nkeys = keys.size();
   dict inventory;
   for (size_t i = 0; i < nkeys; ++i) {
@@ -74,6 +79,31 @@ list getDescriptors(AlgorithmFactoryImpl &self, bool includeHidden) {
   return pyDescriptors;
 }
 
+/**
+ * Describe the algorithms in plugin libraries that have not been opened yet
+ * as a python list of dictionaries with the keys name, aliases, method,
+ * method_input_property and method_on.
+ * @param self :: An instance of AlgorithmFactory.
+ */
+list getDeferredAlgorithms(AlgorithmFactoryImpl &self) {
+  list pyDescriptors;
+  for (const auto &descr : self.getDeferredAlgorithms()) {
+    list aliases, methodOn;
+    for (const auto &alias : descr.aliases)
+      aliases.append(alias);
+    for (const auto &type : descr.methodOn)
+      methodOn.append(type);
+    dict pyDescr;
+    pyDescr["name"] = descr.name;
+    pyDescr["aliases"] = aliases;
+    pyDescr["method"] = descr.methodName;
+    pyDescr["method_input_property"] = descr.methodInputProperty;
+    pyDescr["method_on"] = methodOn;
+    pyDescriptors.append(pyDescr);
+  }
+  return pyDescriptors;
+}
+
 //------------------------------------------------------------------------------
 // Python algorithm subscription
 //------------------------------------------------------------------------------
@@ -154,8 +184,13 @@ void export_AlgorithmFactory() {
                             "an option to specify the version"))
 
       .def("getRegisteredAlgorithms", &getRegisteredAlgorithms,
-           (arg("self"), arg("include_hidden")),
-           "Returns a Python dictionary of currently registered algorithms")
+           (arg("self"), arg("include_hidden"), arg("open_deferred") = true),
+           "Returns a Python dictionary of currently registered algorithms. "
+           "If open_deferred is False, plugin libraries that have not been "
+           "opened yet are left closed and their algorithms are omitted")
+      .def("getDeferredAlgorithms", &getDeferredAlgorithms, arg("self"),
+           "Returns a list of dictionaries describing the algorithms in "
+           "plugin libraries that have not been opened yet")
       .def("highestVersion", &AlgorithmFactoryImpl::highestVersion,
            (arg("self"), arg("algorithm_name")),
            "Returns the highest version of the named algorithm. Throws "
@@ -1,8 +1,13 @@
 #include "MantidDataObjects/EventList.h"
 #include "MantidPythonInterface/kernel/GetPointer.h"
 #include <boost/python/class.hpp>
+#include <boost/python/extract.hpp>
 #include <boost/python/register_ptr_to_python.hpp>
 
+#define PY_ARRAY_UNIQUE_SYMBOL DATAOBJECTS_ARRAY_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
+
 using namespace boost::python;
 using namespace Mantid::DataObjects;
 
@@ -13,6 +18,74 @@ void addEventToEventList(EventList &self, double tof,
                          Mantid::Types::Core::DateAndTime pulsetime) {
   self.addEventQuickly(Mantid::Types::Event::TofEvent(tof, pulsetime));
 }
+
+/// The numpy type of a field of the events
+int fieldTypenum(const EventField field) {
+  switch (field) {
+  case EventField::Tof:
+    return NPY_DOUBLE;
+  case EventField::PulseTime:
+    return NPY_INT64;
+  default:
+    return NPY_FLOAT;
+  }
+}
+
+/**
+ * Wrap one field of the events in a numpy array without copying them. The
+ * array keeps the Python object of the list alive but becomes invalid if
+ * events are added to or removed from the list.
+ * @param self :: The Python object of an EventList
+ * @param field :: The field of the events to wrap
+ * @param writable :: If true the array can modify the events
+ * @return A 1D numpy array looking at the events
+ */
+object wrapField(const object &self, const EventField field,
+                 const bool writable) {
+  EventList &events = extract<EventList &>(self)();
+  auto layout = events.fieldLayout(field);
+  if (writable) // Clears the cached histogram and the sort order
+    layout.data = events.mutableFieldLayout(field).data;
+  npy_intp dims[1] = {static_cast<npy_intp>(layout.size)};
+  if (!layout.data)
+    return object(handle<>(PyArray_SimpleNew(1, dims, fieldTypenum(field))));
+  npy_intp strides[1] = {static_cast<npy_intp>(layout.stride)};
+  const int flags = writable ? NPY_ARRAY_ALIGNED | NPY_ARRAY_WRITEABLE
+                             : NPY_ARRAY_ALIGNED;
+  PyObject *nparray =
+      PyArray_New(&PyArray_Type, 1, dims, fieldTypenum(field), strides,
+                  const_cast<char *>(layout.data), 0, flags, nullptr);
+  // The array steals a reference to its base object
+  Py_INCREF(self.ptr());
+  PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(nparray),
+                        self.ptr());
+  return object(handle<>(nparray));
+}
+
+object readTofs(const object &self) {
+  return wrapField(self, EventField::Tof, false);
+}
+object readPulseTimes(const object &self) {
+  return wrapField(self, EventField::PulseTime, false);
+}
+object readWeights(const object &self) {
+  return wrapField(self, EventField::Weight, false);
+}
+object readErrorsSquared(const object &self) {
+  return wrapField(self, EventField::ErrorSquared, false);
+}
+object dataTofs(const object &self) {
+  return wrapField(self, EventField::Tof, true);
+}
+object dataPulseTimes(const object &self) {
+  return wrapField(self, EventField::PulseTime, true);
+}
+object dataWeights(const object &self) {
+  return wrapField(self, EventField::Weight, true);
+}
+object dataErrorsSquared(const object &self) {
+  return wrapField(self, EventField::ErrorSquared, true);
+}
 }
 
 void export_EventList() {
@@ -22,5 +95,34 @@ void export_EventList() {
       "EventList")
       .def("addEventQuickly", &addEventToEventList,
            args("self", "tof", "pulsetime"),
-           "Create TofEvent and add to EventList.");
+           "Create TofEvent and add to EventList.")
+      .def("readTofs", &readTofs, args("self"),
+           "Creates a read-only numpy wrapper around the original TOFs of the "
+           "events. It is invalidated by adding or removing events.")
+      .def("readPulseTimes", &readPulseTimes, args("self"),
+           "Creates a read-only numpy wrapper around the original pulse times "
+           "of the events, in nanoseconds since 1990-01-01. It is invalidated "
+           "by adding or removing events.")
+      .def("readWeights", &readWeights, args("self"),
+           "Creates a read-only numpy wrapper around the original weights of "
+           "weighted events. It is invalidated by adding or removing events.")
+      .def("readErrorsSquared", &readErrorsSquared, args("self"),
+           "Creates a read-only numpy wrapper around the original squared "
+           "errors of weighted events. It is invalidated by adding or "
+           "removing events.")
+      .def("dataTofs", &dataTofs, args("self"),
+           "Creates a writable numpy wrapper around the original TOFs of the "
+           "events and marks them as unsorted. It is invalidated by adding or "
+           "removing events.")
+      .def("dataPulseTimes", &dataPulseTimes, args("self"),
+           "Creates a writable numpy wrapper around the original pulse times "
+           "of the events, in nanoseconds since 1990-01-01, and marks them as "
+           "unsorted. It is invalidated by adding or removing events.")
+      .def("dataWeights", &dataWeights, args("self"),
+           "Creates a writable numpy wrapper around the original weights of "
+           "weighted events. It is invalidated by adding or removing events.")
+      .def("dataErrorsSquared", &dataErrorsSquared, args("self"),
+           "Creates a writable numpy wrapper around the original squared "
+           "errors of weighted events. It is invalidated by adding or "
+           "removing events.");
 }
@@ -1,20 +1,145 @@
 #include "MantidDataObjects/EventWorkspace.h"
+#include "MantidKernel/MultiThreaded.h"
+#include "MantidPythonInterface/kernel/Environment/ReleaseGlobalInterpreterLock.h"
 #include "MantidPythonInterface/kernel/GetPointer.h"
 #include "MantidPythonInterface/kernel/Registry/RegisterWorkspacePtrToPython.h"
 
 #include <boost/python/class.hpp>
 #include <boost/python/object/inheritance.hpp>
+#include <boost/python/tuple.hpp>
+
+#define PY_ARRAY_UNIQUE_SYMBOL DATAOBJECTS_ARRAY_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
 
 using Mantid::API::IEventWorkspace;
+using Mantid::DataObjects::EventList;
 using Mantid::DataObjects::EventWorkspace;
+using Mantid::DataObjects::WeightedEvent;
+using Mantid::DataObjects::WeightedEventNoTime;
+using Mantid::PythonInterface::Environment::ReleaseGlobalInterpreterLock;
+using Mantid::Types::Event::TofEvent;
 using namespace Mantid::PythonInterface::Registry;
 using namespace boost::python;
 
 GET_POINTER_SPECIALIZATION(EventWorkspace)
 
+namespace {
+/// Pointers to the next event to write in each of the flat arrays
+struct EventColumns {
+  double *tof;
+  int64_t *pulseTime;
+  double *weight;
+};
+
+void copyEvent(const TofEvent &event, EventColumns &out) {
+  *out.tof++ = event.tof();
+  *out.pulseTime++ = event.pulseTime().totalNanoseconds();
+  *out.weight++ = 1.0;
+}
+
+void copyEvent(const WeightedEvent &event, EventColumns &out) {
+  *out.tof++ = event.tof();
+  *out.pulseTime++ = event.pulseTime().totalNanoseconds();
+  *out.weight++ = event.weight();
+}
+
+void copyEvent(const WeightedEventNoTime &event, EventColumns &out) {
+  *out.tof++ = event.tof();
+  *out.pulseTime++ = 0;
+  *out.weight++ = event.weight();
+}
+
+template <typename T>
+void copyEvents(const std::vector<T> &events, EventColumns out) {
+  for (const auto &event : events)
+    copyEvent(event, out);
+}
+
+/// Create a 1D numpy array of the given type owning its data
+object newArray(const npy_intp size, const int typenum) {
+  npy_intp dims[1] = {size};
+  return object(handle<>(PyArray_SimpleNew(1, dims, typenum)));
+}
+
+template <typename T> T *arrayData(const object &nparray) {
+  return static_cast<T *>(
+      PyArray_DATA(reinterpret_cast<PyArrayObject *>(nparray.ptr())));
+}
+
+/**
+ * Copies the events of all spectra into flat numpy arrays. The spectra are
+ * copied in parallel without holding the GIL.
+ * @param self :: A reference to the calling object
+ * @return A tuple (tofs, pulseTimes, weights, offsets). The events of
+ * workspace index i are found between offsets[i] and offsets[i + 1]. Pulse
+ * times are in nanoseconds since 1990-01-01, and are zero for events without
+ * pulse times. Events without weights have a weight of 1.
+ */
+tuple extractEvents(const EventWorkspace &self) {
+  const auto numHist = static_cast<npy_intp>(self.getNumberHistograms());
+  object offsets = newArray(numHist + 1, NPY_INT64);
+  auto offsetData = arrayData<int64_t>(offsets);
+  offsetData[0] = 0;
+  for (npy_intp i = 0; i < numHist; ++i)
+    offsetData[i + 1] = offsetData[i] + self.getSpectrum(i).getNumberEvents();
+
+  const auto numEvents = static_cast<npy_intp>(offsetData[numHist]);
+  object tofs = newArray(numEvents, NPY_DOUBLE);
+  object pulseTimes = newArray(numEvents, NPY_INT64);
+  object weights = newArray(numEvents, NPY_DOUBLE);
+  auto tofData = arrayData<double>(tofs);
+  auto pulseTimeData = arrayData<int64_t>(pulseTimes);
+  auto weightData = arrayData<double>(weights);
+
+  {
+    ReleaseGlobalInterpreterLock releaseGIL;
+    PARALLEL_FOR_IF(Mantid::Kernel::threadSafe(self))
+    for (npy_intp i = 0; i < numHist; ++i) {
+      const EventList &events = self.getSpectrum(i);
+      const auto start = offsetData[i];
+      const EventColumns out{tofData + start, pulseTimeData + start,
+                             weightData + start};
+      switch (events.getEventType()) {
+      case Mantid::API::TOF:
+        copyEvents(events.getEvents(), out);
+        break;
+      case Mantid::API::WEIGHTED:
+        copyEvents(events.getWeightedEvents(), out);
+        break;
+      case Mantid::API::WEIGHTED_NOTIME:
+        copyEvents(events.getWeightedEventsNoTime(), out);
+        break;
+      }
+    }
+  }
+
+  return make_tuple(tofs, pulseTimes, weights, offsets);
+}
+
+/**
+ * Generates the histograms of the spectra in parallel without holding the
+ * GIL, so that reading them afterwards finds them cached.
+ * @param self :: A reference to the calling object
+ */
+void fillMRU(const EventWorkspace &self) {
+  ReleaseGlobalInterpreterLock releaseGIL;
+  self.fillMRU();
+}
+}
+
 void export_EventWorkspace() {
   class_<EventWorkspace, bases<IEventWorkspace>, boost::noncopyable>(
-      "EventWorkspace", no_init);
+      "EventWorkspace", no_init)
+      .def("extractEvents", &extractEvents, args("self"),
+           "Extracts (copies) the events of all spectra into flat numpy "
+           "arrays, returned as a tuple (tofs, pulseTimes, weights, offsets). "
+           "The events of workspace index i are between offsets[i] and "
+           "offsets[i + 1]. Pulse times are in nanoseconds since 1990-01-01.")
+      .def("fillMRU", &fillMRU, args("self"),
+           "Generates the histograms of the spectra in parallel and caches "
+           "them, as far as the histogram cache allows. Call before reading "
+           "the Y or E of many spectra one after the other.");
 
   // register pointers
   RegisterWorkspacePtrToPython<EventWorkspace>();
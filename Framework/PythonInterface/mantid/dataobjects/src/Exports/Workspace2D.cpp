@@ -25,7 +25,13 @@
 #include <boost/python/make_constructor.hpp>
 #include <boost/python/tuple.hpp>
 
+#define PY_ARRAY_UNIQUE_SYMBOL DATAOBJECTS_ARRAY_API
+#define NO_IMPORT_ARRAY
+#include <numpy/arrayobject.h>
+
 using Mantid::API::MatrixWorkspace;
+using Mantid::HistogramData::HistogramX;
+using Mantid::Kernel::cow_ptr;
 using Mantid::DataObjects::Workspace2D;
 using Mantid::SpectrumDefinition;
 using namespace Mantid::PythonInterface::Registry;
@@ -167,6 +173,47 @@ public:
   }
 };
 
+namespace {
+/// Destructor of a capsule holding a reference to X data
+void releaseX(PyObject *capsule) {
+  delete static_cast<cow_ptr<HistogramX> *>(
+      PyCapsule_GetPointer(capsule, nullptr));
+}
+
+/**
+ * Wrap the X data shared by all spectra in a read-only 2D numpy array
+ * without copying it. Every row of the array looks at the same data, which
+ * the array keeps alive, so it is not affected by later changes to the
+ * workspace. Y and E cannot be wrapped like this, as every spectrum stores
+ * them in a separate vector; extractY() and extractE() copy them.
+ * @param self :: A reference to the calling object
+ * @return A numpy array of shape (number of histograms, number of X values)
+ * @throws std::invalid_argument if the spectra do not share their X data
+ */
+PyObject *readXBlock(const Workspace2D &self) {
+  const auto numHist = self.getNumberHistograms();
+  if (numHist == 0)
+    throw std::invalid_argument("The workspace has no spectra");
+  auto x = self.sharedX(0);
+  for (size_t i = 1; i < numHist; ++i) {
+    if (!(self.sharedX(i) == x))
+      throw std::invalid_argument("The spectra do not share their X data, "
+                                  "use extractX() to copy it instead");
+  }
+  npy_intp dims[2] = {static_cast<npy_intp>(numHist),
+                      static_cast<npy_intp>(x->size())};
+  npy_intp strides[2] = {0, sizeof(double)};
+  PyObject *nparray = PyArray_New(
+      &PyArray_Type, 2, dims, NPY_DOUBLE, strides,
+      const_cast<double *>(x->rawData().data()), 0, NPY_ARRAY_ALIGNED, nullptr);
+  PyObject *owner = PyCapsule_New(new cow_ptr<HistogramX>(x), nullptr,
+                                  &releaseX);
+  // The array steals the reference to its base object
+  PyArray_SetBaseObject(reinterpret_cast<PyArrayObject *>(nparray), owner);
+  return nparray;
+}
+}
+
 boost::shared_ptr<Mantid::API::Workspace> makeWorkspace2D() {
   return boost::make_shared<Workspace2D>();
 }
@@ -174,7 +221,12 @@ boost::shared_ptr<Mantid::API::Workspace> makeWorkspace2D() {
 void export_Workspace2D() {
   class_<Workspace2D, bases<MatrixWorkspace>, boost::noncopyable>("Workspace2D")
       .def_pickle(Workspace2DPickleSuite())
-      .def("__init__", boost::python::make_constructor(&makeWorkspace2D));
+      .def("__init__", boost::python::make_constructor(&makeWorkspace2D))
+      .def("readXBlock", &readXBlock, args("self"),
+           "Creates a read-only 2D numpy wrapper around the X data shared by "
+           "all spectra, without copying it. Raises ValueError if the spectra "
+           "do not share their X data. Y and E are only available as copies, "
+           "from extractY() and extractE().");
 
   // register pointers
   RegisterWorkspacePtrToPython<Workspace2D>();
@@ -0,0 +1,21 @@
+#include "MantidPythonInterface/kernel/Environment/ReleaseGlobalInterpreterLock.h"
+
+namespace Mantid {
+namespace PythonInterface {
+namespace Environment {
+
+/**
+ * Releases the GIL held by this thread, saving its Python threadstate
+ */
+ReleaseGlobalInterpreterLock::ReleaseGlobalInterpreterLock()
+    : m_saved(PyEval_SaveThread()) {}
+
+/**
+ * Re-acquires the GIL and restores the saved Python threadstate
+ */
+ReleaseGlobalInterpreterLock::~ReleaseGlobalInterpreterLock() {
+  PyEval_RestoreThread(m_saved);
+}
+}
+}
+}
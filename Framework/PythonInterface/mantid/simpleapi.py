@@ -24,6 +24,7 @@ from __future__ import (absolute_import, division,
 import six
 from six import iteritems
 from collections import OrderedDict, namedtuple
+import inspect as _inspect
 import os
 
 from . import api as _api
@@ -1285,8 +1286,11 @@ def _mockup(plugins):
 
     # Start with the loaded C++ algorithms
     from mantid.api import AlgorithmFactory
-    cppalgs = AlgorithmFactory.getRegisteredAlgorithms(True)
+    cppalgs = AlgorithmFactory.getRegisteredAlgorithms(True, False)
     create_fake_functions(cppalgs.keys())
+    # and those in plugin libraries that have not been opened yet
+    for descriptor in AlgorithmFactory.getDeferredAlgorithms():
+        create_fake_functions([descriptor["name"]] + descriptor["aliases"])
 
     # Now the plugins
     for plugin in plugins:
@@ -1311,7 +1315,8 @@ def _translate():
     # on different algorithms, which is an error
     new_methods = {}
 
-    algs = AlgorithmFactory.getRegisteredAlgorithms(True)
+    # Plugin libraries that have not been opened yet are left closed
+    algs = AlgorithmFactory.getRegisteredAlgorithms(True, False)
     algorithm_mgr = AlgorithmManager
     for name, versions in iteritems(algs):
         if specialization_exists(name):
@@ -1341,11 +1346,79 @@ def _translate():
         _create_algorithm_dialog(name, max(versions), algm_object)
         new_functions.append(name)
 
+    # The algorithms of plugin libraries that have not been opened yet are
+    # wrapped using their manifests. The library is opened on first use.
+    for descriptor in AlgorithmFactory.getDeferredAlgorithms():
+        name = descriptor["name"]
+        if specialization_exists(name):
+            continue
+        algorithm_wrapper = _create_deferred_algorithm_function(descriptor)
+        method_name = descriptor["method"]
+        if len(method_name) > 0:
+            if new_methods.get(method_name, name) != name:
+                raise RuntimeError("simpleapi: Trying to attach '%s' as method to point to '%s' algorithm but "
+                                   "it has already been attached to point to the '%s' algorithm."
+                                   % (method_name, name, new_methods[method_name]))
+            _api._workspaceops.attach_func_as_method(method_name, algorithm_wrapper,
+                                                     descriptor["method_input_property"],
+                                                     descriptor["method_on"])
+            new_methods[method_name] = name
+        if name not in new_functions:
+            new_functions.append(name)
+
     return new_functions
 
 # -------------------------------------------------------------------------------------------------------------
 
 
+def _create_deferred_algorithm_function(descriptor):
+    """
+        Create placeholder functions for an algorithm whose plugin library has
+        not been opened yet. The first call of any of them opens the library
+        and replaces them with the functions created by _create_algorithm_function
+        and _create_algorithm_dialog, which the call is forwarded to.
+        :param descriptor: A dictionary describing the algorithm, as returned by
+                           AlgorithmFactory.getDeferredAlgorithms()
+        :returns: The placeholder for the algorithm function
+    """
+    from mantid.api import AlgorithmFactory, AlgorithmManager
+    name = descriptor["name"]
+    wrappers = {}
+
+    def translate():
+        if not wrappers:
+            # Opens the library providing the algorithm
+            version = AlgorithmFactory.highestVersion(name)
+            algm_object = AlgorithmManager.createUnmanaged(name, version)
+            algm_object.initialize()
+            wrappers[name] = _create_algorithm_function(name, version, algm_object)
+            _create_algorithm_dialog(name, version, algm_object)
+            wrappers[name + "Dialog"] = globals()[name + "Dialog"]
+        return wrappers
+
+    def create_placeholder(func_name, target, doc):
+        def placeholder(*args, **kwargs):
+            if target == name:
+                # Keep the frame with the assignment for the output names
+                kwargs.setdefault("__LHS_FRAME_OBJECT__", _inspect.currentframe().f_back)
+            return translate()[target](*args, **kwargs)
+        placeholder.__name__ = func_name
+        placeholder.__doc__ = doc
+        globals()[func_name] = placeholder
+        return placeholder
+
+    doc = "Runs the {0} algorithm. Its plugin library is opened on first use.".format(name)
+    algorithm_wrapper = create_placeholder(name, name, doc)
+    dialog_doc = "\n\n{0} dialog".format(name)
+    create_placeholder(name + "Dialog", name + "Dialog", dialog_doc)
+    for alias in descriptor["aliases"]:
+        globals()[alias] = algorithm_wrapper
+        globals()[alias + "Dialog"] = globals()[name + "Dialog"]
+    return algorithm_wrapper
+
+# -------------------------------------------------------------------------------------------------------------
+
+
 def _attach_algorithm_func_as_method(method_name, algorithm_wrapper, algm_object):
     """
         Attachs the given algorithm free function to those types specified by the algorithm
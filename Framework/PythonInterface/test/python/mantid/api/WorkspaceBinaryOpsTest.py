@@ -1,7 +1,7 @@
 from __future__ import (absolute_import, division, print_function)
 
 from mantid.api import mtd
-from mantid.simpleapi import CreateSampleWorkspace
+from mantid.simpleapi import CreateMDHistoWorkspace, CreateSampleWorkspace
 import unittest
 
 
@@ -34,5 +34,36 @@ class WorkspaceBinaryOpsTest(unittest.TestCase):
         ws_ads += 1
         self.assertTrue(mtd.doesExist('ws_ads'))
 
+    def test_chained_ops_on_md_histo_workspaces(self):
+        for name, signal in (('a', 5.0), ('b', 1.0), ('c', 2.0)):
+            CreateMDHistoWorkspace(SignalInput=[signal] * 4, ErrorInput=[1.0] * 4,
+                                   Dimensionality=1, Extents='0,4', NumberOfBins=4,
+                                   Names='x', Units='u', OutputWorkspace=name)
+        a, b, c = mtd['a'], mtd['b'], mtd['c']
+        result = (a - b) / c
+        for signal in result.getSignalArray():
+            self.assertAlmostEqual(signal, 2.0)
+        for signal in a.getSignalArray():
+            self.assertAlmostEqual(signal, 5.0)
+        self.assertFalse(any(name.startswith('__python_op_tmp')
+                             for name in mtd.getObjectNames()))
+
+    def test_temporary_returned_from_function_is_not_overwritten(self):
+        def difference(a, b):
+            return a - b
+        ws = CreateSampleWorkspace(StoreInADS=True)
+        diff = difference(ws, ws)
+        self.assertAlmostEqual((diff * 2 + 1).readY(0)[0], 1.0)
+        self.assertAlmostEqual(diff.readY(0)[0], 0.0)
+
+    def test_temporary_in_list_is_not_overwritten(self):
+        def difference(a, b):
+            return a - b
+        ws = CreateSampleWorkspace(StoreInADS=True)
+        diffs = [difference(ws, ws) for _ in range(2)]
+        self.assertAlmostEqual((diffs[0] + 1).readY(0)[0], 1.0)
+        self.assertAlmostEqual(diffs[0].readY(0)[0], 0.0)
+        self.assertAlmostEqual(diffs[1].readY(0)[0], 0.0)
+
 if __name__ == '__main__':
     unittest.main()
@@ -3,6 +3,8 @@ from __future__ import (absolute_import, division, print_function)
 
 import unittest
 
+import numpy as np
+
 from mantid.kernel import DateAndTime
 from mantid.api import EventType
 from mantid.dataobjects import EventList
@@ -22,6 +24,37 @@ class EventListTest(unittest.TestCase):
         self.assertEquals(el.getTofs()[0], float(0.123))
         self.assertEquals(el.getPulseTimes()[0], DateAndTime(42))
 
+    def test_readTofs_is_a_read_only_view(self):
+        el = EventList()
+        el.addEventQuickly(1.5, DateAndTime(42))
+        el.addEventQuickly(2.5, DateAndTime(43))
+        tofs = el.readTofs()
+        self.assertTrue(isinstance(tofs, np.ndarray))
+        np.testing.assert_array_equal(tofs, [1.5, 2.5])
+        self.assertFalse(tofs.flags.writeable)
+        self.assertRaises(ValueError, tofs.__setitem__, 0, 0.0)
+        np.testing.assert_array_equal(el.readPulseTimes(), [42, 43])
+
+    def test_dataTofs_writes_to_the_events(self):
+        el = EventList()
+        el.addEventQuickly(1.5, DateAndTime(42))
+        tofs = el.dataTofs()
+        tofs *= 2.0
+        self.assertEquals(el.getTofs()[0], 3.0)
+
+    def test_weights_of_weighted_events(self):
+        el = EventList()
+        el.addEventQuickly(1.5, DateAndTime(42))
+        self.assertRaises(ValueError, el.readWeights)
+        el.switchTo(EventType.WEIGHTED)
+        el.dataWeights()[0] = 2.0
+        self.assertEquals(el.getWeights()[0], 2.0)
+        np.testing.assert_array_equal(el.readErrorsSquared(), [1.0])
+
+    def test_views_of_empty_list(self):
+        el = EventList()
+        self.assertEquals(len(el.readTofs()), 0)
+
 
 if __name__ == '__main__':
     unittest.main()
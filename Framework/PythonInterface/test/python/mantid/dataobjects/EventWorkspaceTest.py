@@ -0,0 +1,39 @@
+# pylint: disable=invalid-name, too-many-public-methods
+from __future__ import (absolute_import, division, print_function)
+
+import unittest
+
+import numpy as np
+
+from testhelpers import WorkspaceCreationHelper
+
+
+class EventWorkspaceTest(unittest.TestCase):
+
+    def test_extractEvents(self):
+        ws = WorkspaceCreationHelper.createEventWorkspace2(3, 10)
+        tofs, pulse_times, weights, offsets = ws.extractEvents()
+        self.assertEquals(len(offsets), ws.getNumberHistograms() + 1)
+        self.assertEquals(offsets[-1], ws.getNumberEvents())
+        self.assertEquals(len(tofs), ws.getNumberEvents())
+        self.assertEquals(len(pulse_times), ws.getNumberEvents())
+        np.testing.assert_array_equal(weights, 1.0)
+        for index in range(ws.getNumberHistograms()):
+            spectrum = slice(offsets[index], offsets[index + 1])
+            np.testing.assert_array_equal(tofs[spectrum],
+                                          ws.getSpectrum(index).getTofs())
+            np.testing.assert_array_equal(pulse_times[spectrum],
+                                          ws.getSpectrum(index).readPulseTimes())
+
+    def test_fillMRU_keeps_the_histograms(self):
+        ws = WorkspaceCreationHelper.createEventWorkspace2(3, 10)
+        indices = range(ws.getNumberHistograms())
+        expected = [np.array(ws.readY(index)) for index in indices]
+        ws.clearMRU()
+        ws.fillMRU()
+        for index in indices:
+            np.testing.assert_array_equal(ws.readY(index), expected[index])
+
+
+if __name__ == '__main__':
+    unittest.main()
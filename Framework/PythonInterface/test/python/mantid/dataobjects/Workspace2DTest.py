@@ -0,0 +1,38 @@
+# pylint: disable=invalid-name, too-many-public-methods
+from __future__ import (absolute_import, division, print_function)
+
+import unittest
+
+import numpy as np
+
+from mantid.simpleapi import CreateWorkspace
+
+
+class Workspace2DTest(unittest.TestCase):
+
+    def test_readXBlock_wraps_shared_x(self):
+        ws = CreateWorkspace(DataX=[1., 2., 3.], DataY=[1., 2., 3., 4.], NSpec=2,
+                             StoreInADS=False)
+        x = ws.readXBlock()
+        self.assertEquals(x.shape, (2, 3))
+        self.assertFalse(x.flags.writeable)
+        np.testing.assert_array_equal(x, ws.extractX())
+        # Rows look at the same data
+        self.assertEquals(x.strides[0], 0)
+
+    def test_readXBlock_keeps_data_after_workspace_changes(self):
+        ws = CreateWorkspace(DataX=[1., 2., 3.], DataY=[1., 2., 3., 4.], NSpec=2,
+                             StoreInADS=False)
+        x = ws.readXBlock()
+        ws.setX(0, np.array([4., 5., 6.]))
+        ws = None
+        np.testing.assert_array_equal(x[1], [1., 2., 3.])
+
+    def test_readXBlock_throws_if_x_is_not_shared(self):
+        ws = CreateWorkspace(DataX=[1., 2., 3., 4.], DataY=[1., 2.], NSpec=2,
+                             StoreInADS=False)
+        self.assertRaises(ValueError, ws.readXBlock)
+
+
+if __name__ == '__main__':
+    unittest.main()
@@ -107,3 +107,22 @@ function ( CLEAN_ORPHANED_PYC_FILES ROOT_DIR )
     endforeach()
   endif()
 endfunction()
+
+#######################################################################
+
+# NAME: ADD_PLUGIN_MANIFEST
+# Write the manifest listing the algorithms, file loaders and other classes
+# a framework plugin library registers with the framework factories after it
+# is built and install it next to the library. The manifest allows the
+# library to be opened only when one of these is first used. A library whose
+# manifest lists nothing is opened at start-up.
+#   Parameters:
+#      TARGET - The name of the plugin library target
+function ( ADD_PLUGIN_MANIFEST TARGET )
+  set ( _manifest $<TARGET_FILE:${TARGET}>.plugin-manifest )
+  add_dependencies ( ${TARGET} PluginManifest )
+  add_custom_command ( TARGET ${TARGET} POST_BUILD
+                       COMMAND PluginManifest $<TARGET_FILE:${TARGET}> ${_manifest}
+                       COMMENT "Writing plugin manifest for ${TARGET}" )
+  install ( FILES ${_manifest} DESTINATION ${PLUGINS_DIR} )
+endfunction()